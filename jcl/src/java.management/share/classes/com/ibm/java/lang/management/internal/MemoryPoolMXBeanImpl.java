@@ -121,6 +121,22 @@ public class MemoryPoolMXBeanImpl implements MemoryPoolMXBean {
 		return this.getPreCollectionUsageImpl(getID(), MemoryUsage.class, memUsageConstructor);
 	}
 
+	/**
+	 * @return the number of bytes of the memory pool whose pages were returned to the
+	 *         operating system, as of the end of the most recent collection.
+	 */
+	private native long getReleasedMemoryImpl(int id);
+
+	/**
+	 * To satisfy com.ibm.lang.management.MemoryPoolMXBean.
+	 * 
+	 * @return the number of bytes of the memory pool whose pages were returned to the
+	 *         operating system, as of the end of the most recent collection.
+	 */
+	public long getReleasedMemory() {
+		return this.getReleasedMemoryImpl(getID());
+	}
+
 	/**
 	 * @return the collection usage threshold in bytes. The default value as set
 	 *         by the virtual machine will be zero.
@@ -136,4 +136,20 @@ public interface MemoryPoolMXBean extends java.lang.management.MemoryPoolMXBean
 	 */
 	public MemoryUsage getPreCollectionUsage();
 
+	/**
+	 * Returns the number of bytes of this memory pool which the garbage collector
+	 * has returned to the operating system, as of the end of the most recent
+	 * garbage collection. Those bytes are still committed to the pool but are no
+	 * longer resident in physical memory until the pool uses them again.
+	 * <p>
+	 * The method will return zero if the virtual machine does not release the
+	 * memory of this pool.
+	 * </p>
+	 *
+	 * @return the number of bytes of this pool released to the operating system
+	 */
+	public default long getReleasedMemory() {
+		return 0L;
+	}
+
 }
@@ -413,7 +413,7 @@ TR_OptimizationPlan* TR::DefaultCompilationStrategy::processInterpreterSample(TR
                         curMsg += sprintf(curMsg, " already queued");
                     if (compInfo && (compInfo->compBudgetSupport() || compInfo->dynamicThreadPriority())) {
                         fe->acquireCompilationLock();
-                        int32_t n = compInfo->promoteMethodInAsyncQueue(j9method, 0);
+                        int32_t n = compInfo->promoteMethodInAsyncQueue(j9method, 0, logSampling);
                         fe->releaseCompilationLock();
                         if (logSampling) {
                             if (n > 0)
@@ -963,7 +963,7 @@ TR_OptimizationPlan* TR::DefaultCompilationStrategy::processJittedSample(TR_Meth
             if (!recompile && compInfo && compInfo->getLowPriorityCompQueue().hasLowPriorityRequest()
                 && compInfo->canProcessLowPriorityRequest()) {
                 // wake up the compilation thread
-                compInfo->getCompilationMonitor()->notifyAll();
+                compInfo->notifyCompilationThreads();
             }
             if (recompile) {
                 // Method is being recompiled because it is truly hot;
@@ -126,6 +126,7 @@ public:
     void setCompInfo(TR::CompilationInfo* compInfo) { _compInfo = compInfo; }
     bool hasLowPriorityRequest() const { return (_firstLPQentry != NULL); }
     TR_MethodToBeCompiled* getFirstLPQRequest() const { return _firstLPQentry; }
+    bool hasEagerAOTLoadRequest() const { return (_lastEagerAOTLoadLPQentry != NULL); }
     TR_MethodToBeCompiled* extractFirstLPQRequest();
     TR_MethodToBeCompiled* findAndDequeueFromLPQ(
         TR::IlGeneratorMethodDetails& details, uint8_t reason, TR_J9VMBase* fe, bool& dequeued);
@@ -133,6 +134,12 @@ public:
     bool createLowPriorityCompReqAndQueueIt(TR::IlGeneratorMethodDetails& details, void* startPC, uint8_t reason);
     bool addFirstTimeCompReqToLPQ(J9Method* j9method, uint8_t reason);
     bool addUpgradeReqToLPQ(TR_MethodToBeCompiled*);
+    bool addEagerAOTLoadReqToLPQ(J9Method* j9method);
+    uint32_t getNumEagerAOTLoadsQueued() const { return _STAT_compReqQueuedForEagerAOTLoad; }
+    bool isEagerAOTLoadLimitReached() const
+    {
+        return _STAT_compReqQueuedForEagerAOTLoad >= (uint32_t)TR::Options::_eagerAOTLoadLimit;
+    }
     int32_t getLowPriorityQueueSize() const { return _sizeLPQ; }
     int32_t getLPQWeight() const { return _LPQWeight; }
     void increaseLPQWeightBy(uint8_t weight) { _LPQWeight += (int32_t)weight; }
@@ -174,6 +181,7 @@ private:
     TR::CompilationInfo* _compInfo;
     TR_MethodToBeCompiled* _firstLPQentry; // first entry of low priority queue
     TR_MethodToBeCompiled* _lastLPQentry; // last entry of low priority queue
+    TR_MethodToBeCompiled* _lastEagerAOTLoadLPQentry; // eager AOT loads are kept at the front of the LPQ
     int32_t _sizeLPQ; // size of low priority queue
     int32_t _LPQWeight; // weight of low priority queue
     uint32_t _threshold;
@@ -190,9 +198,11 @@ private:
     uint32_t _STAT_LPQcompFromIprofiler; // first time compilations coming from LPQ
     uint32_t _STAT_LPQcompFromInterpreter;
     uint32_t _STAT_LPQcompUpgrade;
+    uint32_t _STAT_LPQcompEagerAOTLoad;
     // stats written by application threads
     uint32_t _STAT_compReqQueuedByInterpreter;
     uint32_t _STAT_numFailedToEnqueueInLPQ;
+    uint32_t _STAT_compReqQueuedForEagerAOTLoad;
 }; // TR_LowPriorityCompQueue
 
 // Definition of compilation queue to hold JProfiling candidates
@@ -580,16 +590,22 @@ public:
         TR_YesNoMaybe methodIsInSharedCache);
 
     void queueEntry(TR_MethodToBeCompiled* entry);
+    void dequeueEntry(TR_MethodToBeCompiled* entry);
+    TR_MethodToBeCompiled* findQueuedEntry(TR::IlGeneratorMethodDetails& details, TR_FrontEnd* fe);
+    TR_MethodToBeCompiled* findQueuedEntryForMethod(J9Method* method); // ignores DLT requests
     void recycleCompilationEntry(TR_MethodToBeCompiled* cur);
     TR_MethodToBeCompiled* adjustCompilationEntryAndRequeue(TR::IlGeneratorMethodDetails& details,
         TR_PersistentMethodInfo* methodInfo, TR_Hotness newOptLevel, bool useProfiling, CompilationPriority priority,
         TR_J9VMBase* fe);
     void changeCompReqFromAsyncToSync(J9Method* method);
-    int32_t promoteMethodInAsyncQueue(J9Method* method, void* pc);
+    int32_t promoteMethodInAsyncQueue(J9Method* method, void* pc, bool computePosition = false);
     TR_MethodToBeCompiled* getNextMethodToBeCompiled(
         TR::CompilationInfoPerThread* compInfoPT, bool compThreadCameOutOfSleep, TR_CompThreadActions*);
     TR_MethodToBeCompiled* peekNextMethodToBeCompiled();
     TR_MethodToBeCompiled* getMethodQueue() { return _methodQueue; }
+    void printCompMonitorStats();
+    bool notifyIdleCompThread();
+    void notifyCompilationThreads();
     int32_t getOverallCompCpuUtilization() const
     {
         return _overallCompCpuUtilization;
@@ -915,6 +931,7 @@ public:
 
     TR_LowPriorityCompQueue& getLowPriorityCompQueue() { return _lowPriorityCompilationScheduler; }
     bool canProcessLowPriorityRequest();
+    void scheduleEagerAOTLoad(J9Method* method);
     TR_CompilationErrorCode scheduleLPQAndBumpCount(TR::IlGeneratorMethodDetails& details, TR_J9VMBase* fe);
 
     TR_JProfilingQueue& getJProfilingCompQueue() { return _JProfilingQueue; }
@@ -980,6 +997,26 @@ private:
 
     static const size_t DLT_HASHSIZE = 123;
 
+    // The main compilation queue is a doubly linked list sorted by descending priority.
+    // To avoid walking it with the compilation monitor in hand, each priority present
+    // in the queue gets a lane that remembers the last entry of that priority, and all
+    // queued entries are hashed by J9Method into _methodQueueIndex.
+    static const int32_t MAX_COMP_QUEUE_LANES = 16;
+    static const size_t COMP_QUEUE_INDEX_SIZE = 1024; // must be a power of 2
+
+    struct CompQueueLane {
+        TR_MethodToBeCompiled* _tail; // last queued entry with this priority
+        uint16_t _priority;
+    };
+
+    static uint16_t compQueueIndexBucket(J9Method* method)
+    {
+        return (uint16_t)((((uintptr_t)method) >> 3) & (COMP_QUEUE_INDEX_SIZE - 1));
+    }
+    int32_t findCompQueueLane(uint16_t priority);
+    void updateCompMonitorHoldTime();
+    void removeCompQueueLane(int32_t laneIndex);
+
     static TR::CompilationInfo* _compilationRuntime;
 
     TR::CompilationInfoPerThread*
@@ -987,6 +1024,9 @@ private:
     TR::CompilationInfoPerThread* _compInfoForDiagnosticCompilationThread; // compinfo for dump compilation thread
     TR::CompilationInfoPerThreadBase* _compInfoForCompOnAppThread; // This is NULL for separate compilation thread
     TR_MethodToBeCompiled* _methodQueue;
+    TR_MethodToBeCompiled* _methodQueueIndex[COMP_QUEUE_INDEX_SIZE]; // queued entries hashed by J9Method
+    CompQueueLane _compQueueLanes[MAX_COMP_QUEUE_LANES]; // sorted by descending priority
+    int32_t _numCompQueueLanes;
     TR_MethodToBeCompiled* _methodPool;
     int32_t _methodPoolSize; // shouldn't this and _methodPool be static?
 
@@ -1060,6 +1100,16 @@ private:
     uint32_t _statNumJProfilingBodies;
     uint32_t _statNumRecompilationForBodiesWithJProfiling;
     uint32_t _statNumMethodsFromJProfilingQueue;
+    // Compilation monitor contention statistics; times are in hires clock ticks
+    // and are only maintained for acquireCompMonitor/releaseCompMonitor pairs
+    uint64_t _compMonitorAcquireTime; // when the outermost acquireCompMonitor succeeded
+    int32_t _compMonitorNestingLevel;
+    uint32_t _statCompMonitorAcquires;
+    uint32_t _statCompMonitorContendedAcquires;
+    uint64_t _statCompMonitorWaitTime;
+    uint64_t _statCompMonitorMaxWaitTime;
+    uint64_t _statCompMonitorHoldTime;
+    uint64_t _statCompMonitorMaxHoldTime;
     uint32_t _statTotalAotQueryTime;
     uint32_t _statTotalAotRelocationTime;
 
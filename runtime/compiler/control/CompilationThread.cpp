@@ -81,6 +81,7 @@
 #include "runtime/CodeCacheManager.hpp"
 #include "runtime/J9VMAccess.hpp"
 #include "runtime/RelocationRuntime.hpp"
+#include "runtime/RelocationRuntimeLogger.hpp"
 #include "runtime/J9Profiler.hpp"
 #include "control/CompilationRuntime.hpp"
 #include "env/j9method.h"
@@ -664,6 +665,12 @@ TR::CompilationInfoPerThread::CompilationInfoPerThread(
     _compThreadPriority = J9THREAD_PRIORITY_USER_MAX;
     _compThreadMonitor = TR::Monitor::create("JIT-CompThreadMonitor-??");
     _lastCompilationDuration = 0;
+    _statNumRequestsDequeued = 0;
+    _statTotalQueueTime = 0;
+    _statMaxQueueTime = 0;
+    memset(_statQueueTimeHistogram, 0, sizeof(_statQueueTimeHistogram));
+    _waitingOnEmptyQueue = false;
+    _emptyQueueWaitNotified = false;
 
     // name the thread
     //
@@ -1035,32 +1042,124 @@ void TR::CompilationInfo::addCompilationTraceEntry(
 
 void TR::CompilationInfo::acquireCompMonitor(J9VMThread* vmThread) // used when we know we have a compilation monitor
 {
-    getCompilationMonitor()->enter();
+    PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+    if (getCompilationMonitor()->try_enter() != 0) {
+        // Contended acquire; measure how long we stay blocked
+        uint64_t waitStart = j9time_hires_clock();
+        getCompilationMonitor()->enter();
+        uint64_t waitTime = j9time_hires_clock() - waitStart;
+        _statCompMonitorContendedAcquires++;
+        _statCompMonitorWaitTime += waitTime;
+        if (waitTime > _statCompMonitorMaxWaitTime)
+            _statCompMonitorMaxWaitTime = waitTime;
+    }
+    if (_compMonitorNestingLevel++ == 0) {
+        _statCompMonitorAcquires++;
+        _compMonitorAcquireTime = j9time_hires_clock();
+    }
     addCompilationTraceEntry(vmThread, OP_HasAcquiredCompilationMonitor);
 }
 
 void TR::CompilationInfo::releaseCompMonitor(J9VMThread* vmThread) // used when we know we have a compilation monitor
 {
     addCompilationTraceEntry(vmThread, OP_WillReleaseCompilationMonitor);
+    if (_compMonitorNestingLevel > 0 && --_compMonitorNestingLevel == 0)
+        updateCompMonitorHoldTime();
     getCompilationMonitor()->exit();
 }
 
+void TR::CompilationInfo::updateCompMonitorHoldTime()
+{
+    PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+    uint64_t holdTime = j9time_hires_clock() - _compMonitorAcquireTime;
+    _statCompMonitorHoldTime += holdTime;
+    if (holdTime > _statCompMonitorMaxHoldTime)
+        _statCompMonitorMaxHoldTime = holdTime;
+}
+
 void TR::CompilationInfo::waitOnCompMonitor(J9VMThread* vmThread)
 {
+    // Waiting gives up the monitor, so other threads must not see our nesting level
+    int32_t nestingLevel = _compMonitorNestingLevel;
+    if (nestingLevel > 0)
+        updateCompMonitorHoldTime();
+    _compMonitorNestingLevel = 0;
     addCompilationTraceEntry(vmThread, OP_WillWaitOnCompilationMonitor);
     getCompilationMonitor()->wait();
     addCompilationTraceEntry(vmThread, OP_HasFinishedWaitingOnCompilationMonitor);
+    _compMonitorNestingLevel = nestingLevel;
+    if (nestingLevel > 0) {
+        PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+        _compMonitorAcquireTime = j9time_hires_clock();
+    }
 }
 
 intptr_t TR::CompilationInfo::waitOnCompMonitorTimed(J9VMThread* vmThread, int64_t millis, int32_t nanos)
 {
     intptr_t retCode;
+    int32_t nestingLevel = _compMonitorNestingLevel;
+    if (nestingLevel > 0)
+        updateCompMonitorHoldTime();
+    _compMonitorNestingLevel = 0;
     addCompilationTraceEntry(vmThread, OP_WillWaitOnCompilationMonitor);
     retCode = getCompilationMonitor()->wait_timed(millis, nanos);
     addCompilationTraceEntry(vmThread, OP_HasFinishedWaitingOnCompilationMonitor);
+    _compMonitorNestingLevel = nestingLevel;
+    if (nestingLevel > 0) {
+        PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+        _compMonitorAcquireTime = j9time_hires_clock();
+    }
     return retCode;
 }
 
+//------------------------- printCompMonitorStats ----------------------------
+// Report how long threads waited for, and held, the compilation monitor.
+// Only acquireCompMonitor/releaseCompMonitor pairs are accounted for.
+//----------------------------------------------------------------------------
+void TR::CompilationInfo::printCompMonitorStats()
+{
+    PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+    TR_VerboseLog::writeLineLocked(TR_Vlog_INFO,
+        "Compilation monitor: acquires=%u contended=%u waitTime=%llu usec (max %llu usec) holdTime=%llu usec (max "
+        "%llu usec) peakQueueSize=%d",
+        _statCompMonitorAcquires, _statCompMonitorContendedAcquires,
+        j9time_hires_delta(0, _statCompMonitorWaitTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
+        j9time_hires_delta(0, _statCompMonitorMaxWaitTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
+        j9time_hires_delta(0, _statCompMonitorHoldTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
+        j9time_hires_delta(0, _statCompMonitorMaxHoldTime, J9PORT_TIME_DELTA_IN_MICROSECONDS), getPeakMethodQueueSize());
+}
+
+//------------------------- notifyIdleCompThread -----------------------------
+// Wake one compilation thread sleeping on an empty queue, if there is one.
+// Unlike a notify() of the comp monitor this cannot wake a thread that is
+// not waiting for work. Must have compilation monitor in hand.
+//----------------------------------------------------------------------------
+bool TR::CompilationInfo::notifyIdleCompThread()
+{
+    for (uint8_t i = 0; i < getNumTotalCompilationThreads(); i++) {
+        TR::CompilationInfoPerThread* curCompThreadInfoPT = _arrayOfCompilationInfoPerThread[i];
+        if (curCompThreadInfoPT && curCompThreadInfoPT->isWaitingOnEmptyQueue()) {
+            curCompThreadInfoPT->notifyEmptyQueueWaiter();
+            return true;
+        }
+    }
+    return false;
+}
+
+//----------------------- notifyCompilationThreads ---------------------------
+// Wake all compilation threads, both those waiting on the comp monitor and
+// those sleeping on an empty queue. Must have compilation monitor in hand.
+//----------------------------------------------------------------------------
+void TR::CompilationInfo::notifyCompilationThreads()
+{
+    getCompilationMonitor()->notifyAll();
+    for (uint8_t i = 0; i < getNumTotalCompilationThreads(); i++) {
+        TR::CompilationInfoPerThread* curCompThreadInfoPT = _arrayOfCompilationInfoPerThread[i];
+        if (curCompThreadInfoPT && curCompThreadInfoPT->isWaitingOnEmptyQueue())
+            curCompThreadInfoPT->notifyEmptyQueueWaiter();
+    }
+}
+
 void TR::CompilationInfo::acquireCompilationLock()
 {
     if (useSeparateCompilationThread() && _compilationMonitor) {
@@ -1226,6 +1325,23 @@ bool TR::CompilationInfo::dynamicThreadPriority()
 //----------------------------- enqueueCompReqToLPQ ------------------------
 void TR_LowPriorityCompQueue::enqueueCompReqToLPQ(TR_MethodToBeCompiled* compReq)
 {
+    if (compReq->_reqFromSecondaryQueue == TR_MethodToBeCompiled::REASON_EAGER_AOT_LOAD) {
+        // add after the other eager AOT loads, ahead of any ordinary request
+        if (_lastEagerAOTLoadLPQentry) {
+            compReq->_next = _lastEagerAOTLoadLPQentry->_next;
+            _lastEagerAOTLoadLPQentry->_next = compReq;
+        } else {
+            compReq->_next = _firstLPQentry;
+            _firstLPQentry = compReq;
+        }
+        if (!compReq->_next)
+            _lastLPQentry = compReq;
+        _lastEagerAOTLoadLPQentry = compReq;
+        _sizeLPQ++;
+        increaseLPQWeightBy(compReq->_weight);
+        return;
+    }
+
     // add at the end of queue
     if (_lastLPQentry)
         _lastLPQentry->_next = compReq;
@@ -1259,8 +1375,11 @@ bool TR_LowPriorityCompQueue::createLowPriorityCompReqAndQueueIt(
     // Determine entry weight
     J9Method* j9method = details.getMethod();
     J9ROMMethod* romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(j9method);
-    compReq->_weight = (J9ROMMETHOD_HAS_BACKWARDS_BRANCHES(romMethod)) ? TR::CompilationInfo::WARM_LOOPY_WEIGHT
-                                                                       : TR::CompilationInfo::WARM_LOOPLESS_WEIGHT;
+    if (reason == TR_MethodToBeCompiled::REASON_EAGER_AOT_LOAD)
+        compReq->_weight = TR::Options::_weightOfAOTLoad;
+    else
+        compReq->_weight = (J9ROMMETHOD_HAS_BACKWARDS_BRANCHES(romMethod)) ? TR::CompilationInfo::WARM_LOOPY_WEIGHT
+                                                                           : TR::CompilationInfo::WARM_LOOPLESS_WEIGHT;
     // add at the end of queue
     enqueueCompReqToLPQ(compReq);
     incStatsReqQueuedToLPQ(reason);
@@ -1290,6 +1409,21 @@ bool TR_LowPriorityCompQueue::addUpgradeReqToLPQ(TR_MethodToBeCompiled* compReq)
         compReq->getMethodDetails(), compReq->_newStartPC, TR_MethodToBeCompiled::REASON_UPGRADE);
 }
 
+//------------------------ addEagerAOTLoadReqToLPQ ----------------------
+// This method is used during startup for interpreted methods that have an
+// AOT body in the shared class cache. The body is validated and relocated
+// by an idle compilation thread before the invocation count of the method
+// expires, so that the application thread does not wait for the AOT load.
+// The number of such requests is capped by TR::Options::_eagerAOTLoadLimit
+// Must be called with compilation monitor in hand
+//-----------------------------------------------------------------------
+bool TR_LowPriorityCompQueue::addEagerAOTLoadReqToLPQ(J9Method* j9method)
+{
+    if (isEagerAOTLoadLimitReached())
+        return false;
+    return addFirstTimeCompReqToLPQ(j9method, TR_MethodToBeCompiled::REASON_EAGER_AOT_LOAD);
+}
+
 bool TR::CompilationInfo::canProcessLowPriorityRequest()
 {
     // To avoid overhead cycling through all the threads, we should first
@@ -1302,6 +1436,13 @@ bool TR::CompilationInfo::canProcessLowPriorityRequest()
     if (getMethodQueueSize() != 0)
         return false;
 
+    // Eager AOT loads are cheap and are meant to be performed by all idle
+    // compilation threads in parallel, so we do not wait for idle CPU.
+    // They are queued ahead of all other LPQ requests, so the request
+    // that will be extracted next is an eager AOT load
+    if (getLowPriorityCompQueue().hasEagerAOTLoadRequest())
+        return true;
+
     // To process a request from the low priority queue we need to have
     // (1) no other compilation in progress (not required if TR_ConcurrentLPQ is enabled)
     // (2) some idle CPU
@@ -1332,6 +1473,34 @@ bool TR::CompilationInfo::canProcessLowPriorityRequest()
         getJvmCpuEntitlement() - getCpuUtil()->getVmCpuUsage() > 50); // at least half a processor should be empty
 }
 
+//------------------------ scheduleEagerAOTLoad ----------------------
+// Executed by application threads when the invocation count of a method
+// with an AOT body in the shared class cache is initialized during startup
+//--------------------------------------------------------------------
+void TR::CompilationInfo::scheduleEagerAOTLoad(J9Method* method)
+{
+    // Read without the compilation monitor: the number of queued eager AOT loads
+    // only grows, so once the limit is reached it stays reached and every other
+    // method found in the SCC can skip the monitor. A stale read only means the
+    // limit is checked again below, under the monitor.
+    if (getLowPriorityCompQueue().isEagerAOTLoadLimitReached())
+        return;
+
+    getCompilationMonitor()->enter();
+    bool enqueued = getLowPriorityCompQueue().addEagerAOTLoadReqToLPQ(method);
+    // Wake up all the sleeping compilation threads; they will process the
+    // eager AOT loads in parallel while the main queue is empty
+    if (enqueued && getNumCompThreadsJobless() > 0 && canProcessLowPriorityRequest())
+        notifyCompilationThreads();
+    getCompilationMonitor()->exit();
+
+    if (enqueued && TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCompileRequest)) {
+        TR_VerboseLog::writeLineLocked(TR_Vlog_CR, "t=%u Eager AOT load request to LPQ for j9m=%p LPQ_SZ=%d",
+            (uint32_t)getPersistentInfo()->getElapsedTime(), method,
+            getLowPriorityCompQueue().getLowPriorityQueueSize());
+    }
+}
+
 int64_t TR::CompilationInfo::getCpuTimeSpentInCompilation()
 {
     I_64 totalTime = 0;
@@ -1479,7 +1648,6 @@ void TR::CompilationInfo::invalidateRequestsForNativeMethods(J9Class* clazz, J9V
 
     // if compiling on app thread, there is no compilation queue
     TR_MethodToBeCompiled* cur = _methodQueue;
-    TR_MethodToBeCompiled* prev = NULL;
     while (cur) {
         TR_MethodToBeCompiled* next = cur->_next;
         J9Method* method = cur->getMethodDetails().getMethod();
@@ -1499,17 +1667,12 @@ void TR::CompilationInfo::invalidateRequestsForNativeMethods(J9Class* clazz, J9V
             }
 
             // detach from queue
-            if (prev)
-                prev->_next = cur->_next;
-            else
-                _methodQueue = cur->_next;
+            dequeueEntry(cur);
             updateCompQueueAccountingOnDequeue(cur);
             // decrease the queue weight
             decreaseQueueWeightBy(cur->_weight);
             // put back into the pool
             recycleCompilationEntry(cur);
-        } else {
-            prev = cur;
         }
         cur = next;
     }
@@ -1564,7 +1727,6 @@ void TR::CompilationInfo::invalidateRequestsForUnloadedMethods(
     } // end for
     // if compilin on app thread, there is no compilation queue
     TR_MethodToBeCompiled* cur = _methodQueue;
-    TR_MethodToBeCompiled* prev = NULL;
     bool verboseDetails = TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseHookDetails);
     while (cur) {
         TR_MethodToBeCompiled* next = cur->_next;
@@ -1599,20 +1761,13 @@ void TR::CompilationInfo::invalidateRequestsForUnloadedMethods(
                     }
                 }
                 // detach from queue
-                if (prev)
-                    prev->_next = cur->_next;
-                else
-                    _methodQueue = cur->_next;
+                dequeueEntry(cur);
                 updateCompQueueAccountingOnDequeue(cur);
                 // decrease the queue weight
                 decreaseQueueWeightBy(cur->_weight);
                 // put back into the pool
                 recycleCompilationEntry(cur);
-            } else {
-                prev = cur;
             }
-        } else {
-            prev = cur;
         }
         cur = next;
     }
@@ -1862,7 +2017,7 @@ void TR::CompilationInfo::purgeMethodQueue(TR_CompilationErrorCode errorCode)
 
     while (_methodQueue) {
         TR_MethodToBeCompiled* cur = _methodQueue;
-        _methodQueue = cur->_next;
+        dequeueEntry(cur);
         updateCompQueueAccountingOnDequeue(cur);
         // decrease the queue weight
         decreaseQueueWeightBy(cur->_weight);
@@ -2416,6 +2571,12 @@ void TR::CompilationInfo::stopCompilationThreads()
         return;
     }
 
+    if (TR::Options::isAnyVerboseOptionSet(TR_VerboseCompilationThreads, TR_VerboseCompilationThreadsDetails)) {
+        printCompMonitorStats();
+        for (uint8_t i = 0; i < getNumTotalCompilationThreads(); i++)
+            _arrayOfCompilationInfoPerThread[i]->printQueueTimeStats();
+    }
+
     static char* printCompStats = feGetEnv("TR_PrintCompStats");
     if (printCompStats) {
         if (statCompErrors.samples() > 0)
@@ -2569,6 +2730,7 @@ void TR::CompilationInfo::stopCompilationThreads()
 
         fprintf(stderr, "numClassValidations: %d\n", aotStats->numClassValidations);
         fprintf(stderr, "numClassValidationsFailed: %d\n", aotStats->numClassValidationsFailed);
+        fprintf(stderr, "numClassValidationsMemoized: %d\n", aotStats->numClassValidationsMemoized);
 
         fprintf(stderr, "numVMCheckCastEvaluator (x86): %d\n", aotStats->numVMCheckCastEvaluator);
         fprintf(stderr, "numVMInstanceOfEvaluator (x86): %d\n", aotStats->numVMInstanceOfEvaluator);
@@ -2658,6 +2820,19 @@ void TR::CompilationInfo::stopCompilationThreads()
         fprintf(stderr, "numProfiledMethodGuardsValidationSucceeded: %d\n",
             aotStats->profiledMethodGuards.numSucceededValidations);
         fprintf(stderr, "-------------------------\n");
+
+        // Loads can be done by any compilation thread or by the application thread itself
+        uint32_t reloTimeHistogram[TR_RelocationRuntimeLogger::RELOCATION_TIME_HISTOGRAM_SIZE];
+        const uint32_t* histogram = reloRuntime()->reloLogger()->relocationTimeHistogram();
+        for (int32_t b = 0; b < TR_RelocationRuntimeLogger::RELOCATION_TIME_HISTOGRAM_SIZE; b++)
+            reloTimeHistogram[b] = histogram[b];
+        for (uint8_t i = 0; i < getNumTotalCompilationThreads(); i++) {
+            histogram = _arrayOfCompilationInfoPerThread[i]->reloRuntime()->reloLogger()->relocationTimeHistogram();
+            for (int32_t b = 0; b < TR_RelocationRuntimeLogger::RELOCATION_TIME_HISTOGRAM_SIZE; b++)
+                reloTimeHistogram[b] += histogram[b];
+        }
+        TR_RelocationRuntimeLogger::printRelocationTimeHistogram(reloTimeHistogram);
+        fprintf(stderr, "-------------------------\n");
     } // AOT stats
 
     if (printCompStats && (dynamicThreadPriority() || compBudgetSupport())) {
@@ -2746,7 +2921,7 @@ void TR::CompilationInfo::stopCompilationThreads()
         TR_ASSERT(curCompThreadInfoPT, "a thread's compinfo is missing\n");
 
         while (curCompThreadInfoPT->getCompilationThreadState() != COMPTHREAD_STOPPED) {
-            getCompilationMonitor()->notifyAll();
+            notifyCompilationThreads();
             waitOnCompMonitor(vmThread);
         }
     }
@@ -3035,6 +3210,41 @@ void TR::CompilationInfoPerThread::waitForWork()
     compInfo->debugPrint(compThread, "+CM\n");
 }
 
+//----------------------------- waitOnEmptyQueue ---------------------------
+// Sleep on this thread's own monitor after finding the compilation queue
+// empty. The comp monitor is released while waiting and re-acquired before
+// returning. Returns 0 if notified and J9THREAD_TIMED_OUT otherwise.
+// Must have compilation monitor in hand.
+//--------------------------------------------------------------------------
+intptr_t TR::CompilationInfoPerThread::waitOnEmptyQueue(int64_t millis)
+{
+    intptr_t monitorStatus = 0;
+    // Enter our own monitor before releasing the comp monitor: a notifier holds
+    // the comp monitor and needs our monitor, so it cannot notify before we wait
+    getCompThreadMonitor()->enter();
+    _emptyQueueWaitNotified = false;
+    _waitingOnEmptyQueue = true;
+    _compInfo.releaseCompMonitor(getCompilationThread());
+    if (!_emptyQueueWaitNotified)
+        monitorStatus = getCompThreadMonitor()->wait_timed(millis, 0);
+    getCompThreadMonitor()->exit();
+    _compInfo.acquireCompMonitor(getCompilationThread());
+    _waitingOnEmptyQueue = false;
+    return monitorStatus;
+}
+
+//-------------------------- notifyEmptyQueueWaiter ------------------------
+// Wake this thread from waitOnEmptyQueue(). Must have compilation monitor in hand.
+//--------------------------------------------------------------------------
+void TR::CompilationInfoPerThread::notifyEmptyQueueWaiter()
+{
+    _waitingOnEmptyQueue = false;
+    getCompThreadMonitor()->enter();
+    _emptyQueueWaitNotified = true;
+    getCompThreadMonitor()->notifyAll();
+    getCompThreadMonitor()->exit();
+}
+
 void TR::CompilationInfoPerThread::doSuspend()
 {
     _compInfo.setSuspendThreadDueToLowPhysicalMemory(false);
@@ -3049,6 +3259,42 @@ void TR::CompilationInfoPerThread::doSuspend()
     _compInfo.acquireCompMonitor(getCompilationThread());
 }
 
+//------------------------- updateQueueTimeStats ---------------------------
+// Record how long the given request waited in the queue before this thread
+// picked it up. Must have compilation monitor in hand.
+//--------------------------------------------------------------------------
+void TR::CompilationInfoPerThread::updateQueueTimeStats(TR_MethodToBeCompiled& entry)
+{
+    uint64_t now = _compInfo.getPersistentInfo()->getElapsedTime();
+    uint64_t queueTime = now > entry._entryTime ? now - entry._entryTime : 0;
+    _statNumRequestsDequeued++;
+    _statTotalQueueTime += queueTime;
+    if (queueTime > _statMaxQueueTime)
+        _statMaxQueueTime = queueTime;
+
+    int32_t bucket = 0;
+    const int32_t lastBucket = sizeof(_statQueueTimeHistogram) / sizeof(_statQueueTimeHistogram[0]) - 1;
+    while (bucket < lastBucket && queueTime >= ((uint64_t)1 << bucket))
+        bucket++;
+    _statQueueTimeHistogram[bucket]++;
+}
+
+void TR::CompilationInfoPerThread::printQueueTimeStats()
+{
+    if (_statNumRequestsDequeued == 0)
+        return;
+    TR_VerboseLog::vlogAcquire();
+    TR_VerboseLog::writeLine(TR_Vlog_INFO,
+        "compThread %d dequeued %u requests: avgQueueTime=%llu ms maxQueueTime=%llu ms histogram(ms):",
+        getCompThreadId(), _statNumRequestsDequeued, _statTotalQueueTime / _statNumRequestsDequeued,
+        _statMaxQueueTime);
+    const int32_t numBuckets = sizeof(_statQueueTimeHistogram) / sizeof(_statQueueTimeHistogram[0]);
+    for (int32_t i = 0; i < numBuckets - 1; i++)
+        TR_VerboseLog::write(" <%d:%u", 1 << i, _statQueueTimeHistogram[i]);
+    TR_VerboseLog::write(" >=%d:%u", 1 << (numBuckets - 2), _statQueueTimeHistogram[numBuckets - 1]);
+    TR_VerboseLog::vlogRelease();
+}
+
 J9::J9SegmentCache TR::CompilationInfoPerThread::initializeSegmentCache(J9::J9SegmentProvider& segmentProvider)
 {
     try {
@@ -3118,7 +3364,7 @@ void TR::CompilationInfoPerThread::processEntries()
                 setCompilationThreadState(COMPTHREAD_WAITING);
                 setLastTimeThreadWentToSleep(compInfo->getPersistentInfo()->getElapsedTime());
                 int64_t waitTimeMillis = 256;
-                intptr_t monitorStatus = compInfo->waitOnCompMonitorTimed(compThread, waitTimeMillis, 0);
+                intptr_t monitorStatus = waitOnEmptyQueue(waitTimeMillis);
                 if (getCompilationThreadState() == COMPTHREAD_WAITING) {
                     /*
                      * A status of 0 indicates that 'the monitor has been waited on, notified, and reobtained.'
@@ -3248,6 +3494,7 @@ void TR::CompilationInfoPerThread::processEntry(
     J9Method* method = details.getMethod();
 
     setMethodBeingCompiled(&entry); // must have compilation monitor
+    updateQueueTimeStats(entry);
 
     // Increase main queue weight while still holding compilation monitor
     if (entry._reqFromSecondaryQueue || entry._reqFromJProfilingQueue)
@@ -3495,7 +3742,7 @@ void TR::CompilationInfoPerThread::processEntry(
         // we wanted to avoid two concurrent hot requests) we need to wake them
         // now as a preventive measure. Worst case scenario they will go back to sleep
         if (compInfo->getNumCompThreadsJobless() > 0) {
-            compInfo->getCompilationMonitor()->notifyAll();
+            compInfo->notifyCompilationThreads();
             if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCompilationThreads)) {
                 TR_VerboseLog::writeLineLocked(TR_Vlog_INFO,
                     "t=%6u compThread %d notifying other sleeping comp threads. Jobless=%d",
@@ -3521,6 +3768,26 @@ void TR::CompilationInfoPerThread::processEntry(
     }
 }
 
+bool TR::CompilationInfoPerThread::canPerformEagerAOTLoad(TR_MethodToBeCompiled& entry)
+{
+#if defined(J9VM_INTERP_AOT_RUNTIME_SUPPORT) && defined(J9VM_OPT_SHARED_CLASSES) \
+    && (defined(TR_HOST_X86) || defined(TR_HOST_POWER) || defined(TR_HOST_S390) || defined(TR_HOST_ARM))
+    J9Method* method = entry.getMethodDetails().getMethod();
+    J9VMThread* vmThread = getCompilationThread();
+    J9JavaVM* javaVM = _jitConfig->javaVM;
+    if (!TR::Options::sharedClassCache() || TR::Options::getAOTCmdLineOptions()->getOption(TR_NoLoadAOT)
+        || !javaVM->sharedClassConfig->existsCachedCodeForROMMethod(vmThread, J9_ROM_METHOD_FROM_RAM_METHOD(method)))
+        return false;
+    TR_JitPrivateConfig* privateConfig = static_cast<TR_JitPrivateConfig*>(_jitConfig->privateConfig);
+    if (privateConfig->aotValidHeader == TR_yes)
+        return true;
+    TR_J9SharedCacheVM* fe = (TR_J9SharedCacheVM*)TR_J9VMBase::get(_jitConfig, vmThread, TR_J9VMBase::AOT_VM);
+    return privateConfig->aotValidHeader == TR_maybe && reloRuntime()->validateAOTHeader(javaVM, fe, vmThread);
+#else
+    return false;
+#endif
+}
+
 bool TR::CompilationInfoPerThread::shouldPerformCompilation(TR_MethodToBeCompiled& entry)
 {
     TR::CompilationInfo* compInfo = getCompilationInfo();
@@ -3552,10 +3819,19 @@ bool TR::CompilationInfoPerThread::shouldPerformCompilation(TR_MethodToBeCompile
                 {
                     if (compInfo->getInvocationCount(method) > 0) // Valid invocation counter
                     {
+                        if (entry._reqFromSecondaryQueue == TR_MethodToBeCompiled::REASON_EAGER_AOT_LOAD) {
+                            // Only load the AOT body; if it cannot be used, let the invocation
+                            // count trigger an ordinary compilation later
+                            doCompile = canPerformEagerAOTLoad(entry);
+                            if (doCompile)
+                                entry._methodIsInSharedCache = TR_yes;
+                        } else {
+                            doCompile = true;
+                        }
                         // FIXME: is this safe here?
                         // What if the method is  about to be compiled?
-                        compInfo->setJ9MethodVMExtra(method, J9_JIT_QUEUED_FOR_COMPILATION);
-                        doCompile = true;
+                        if (doCompile)
+                            compInfo->setJ9MethodVMExtra(method, J9_JIT_QUEUED_FOR_COMPILATION);
                     }
                 } else // compiled body
                 {
@@ -3644,9 +3920,8 @@ TR_MethodToBeCompiled* TR::CompilationInfo::addMethodToBeCompiled(TR::IlGenerato
 #endif
 
     // Add this method to the queue of methods waiting to be compiled.
-    TR_MethodToBeCompiled *cur = NULL, *prev = NULL;
+    TR_MethodToBeCompiled* cur = NULL;
     uint32_t queueWeight = 0; // QW
-    int32_t numEntries = 0;
 
     // See if the method is already in the queue or is already being compiled
     //
@@ -3674,12 +3949,7 @@ TR_MethodToBeCompiled* TR::CompilationInfo::addMethodToBeCompiled(TR::IlGenerato
         }
     }
 
-    for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next) {
-        numEntries++;
-        queueWeight += cur->_weight;
-        if (cur->getMethodDetails().sameAs(details, fe))
-            break;
-    }
+    cur = findQueuedEntry(details, fe);
 
     // NOTE: we do not need to search the methodPool since we cannot reach here if an entry
     // for the compilation of this method is already in the pool.  Things are put in the pool
@@ -3699,10 +3969,14 @@ TR_MethodToBeCompiled* TR::CompilationInfo::addMethodToBeCompiled(TR::IlGenerato
         if (pc)
             cur->_oldStartPC = pc;
 
-        // If the priority has increased, use the new priority
+        // If the priority has increased, use the new priority.
+        // The entry must then move to the lane of its new priority.
         //
-        if (cur->_priority < priority)
+        bool priorityIncreased = cur->_priority < priority;
+        if (priorityIncreased) {
+            dequeueEntry(cur);
             cur->_priority = priority;
+        }
         // If the optimization level is higher, just upgrade
         // (unless the methods has excessive complexity)
         //
@@ -3718,33 +3992,37 @@ TR_MethodToBeCompiled* TR::CompilationInfo::addMethodToBeCompiled(TR::IlGenerato
         }
         // If the position in the queue is still correct, just return
         //
-        if (!prev || prev->_priority >= cur->_priority)
+        if (!priorityIncreased)
             return cur;
-
-        // Must re-position in the queue
-        //
-        prev->_next = cur->_next; // take it out of the queue
     }
 
     // If method is not yet in the queue prepare the queue entry
     //
     else {
-        if (queueWeight != _queueWeight) // QW
-        {
-            if (TR::Options::isAnyVerboseOptionSet())
+        // Self-check of the queue bookkeeping. The lookup above no longer walks
+        // the queue and a walk under the comp monitor is too expensive for every
+        // request, so only check when the discrepancy can be reported.
+        if (TR::Options::isAnyVerboseOptionSet()) {
+            int32_t numEntries = 0;
+            for (TR_MethodToBeCompiled* entry = _methodQueue; entry; entry = entry->_next) {
+                numEntries++;
+                queueWeight += entry->_weight;
+            }
+            if (queueWeight != _queueWeight) // QW
+            {
                 TR_VerboseLog::writeLineLocked(TR_Vlog_INFO,
                     "Discrepancy for queue weight while adding to queue: computed=%u recorded=%u\n", queueWeight,
                     _queueWeight);
-            // correction
-            _queueWeight = queueWeight;
-        }
-        if (numEntries != _numQueuedMethods) {
-            if (TR::Options::isAnyVerboseOptionSet())
+                // correction
+                _queueWeight = queueWeight;
+            }
+            if (numEntries != _numQueuedMethods) {
                 TR_VerboseLog::writeLineLocked(TR_Vlog_INFO,
                     "Discrepancy for queue size while adding to queue: Before adding numEntries=%d  "
                     "_numQueuedMethods=%d\n",
                     numEntries, _numQueuedMethods);
-            TR_ASSERT(false, "Discrepancy for queue size while adding to queue");
+                TR_ASSERT(false, "Discrepancy for queue size while adding to queue");
+            }
         }
 
         cur = getCompilationQueueEntry();
@@ -3915,7 +4193,9 @@ TR_MethodToBeCompiled* TR::CompilationInfo::addMethodToBeCompiled(TR::IlGenerato
 
 //--------------------------- queueEntry ---------------------------------
 // Insert the compilation request in the queue at the appropriate place
-// based on its priority. Must have compilationQueueMonitor in hanb
+// based on its priority. Must have compilationQueueMonitor in hand.
+// The insertion point is the tail of the lane for the entry's priority or,
+// if that lane is empty, the tail of the closest lane of higher priority.
 //------------------------------------------------------------------------
 void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled* entry)
 {
@@ -3923,18 +4203,120 @@ void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled* entry)
 
     entry->_freeTag |= ENTRY_QUEUED;
 
-    if (!_methodQueue || _methodQueue->_priority < entry->_priority) {
-        entry->_next = _methodQueue;
+    int32_t laneIndex = findCompQueueLane(entry->_priority);
+    bool laneExists = laneIndex < _numCompQueueLanes && _compQueueLanes[laneIndex]._priority == entry->_priority;
+    TR_MethodToBeCompiled* prev = NULL;
+    if (laneExists)
+        prev = _compQueueLanes[laneIndex]._tail;
+    else if (laneIndex > 0)
+        prev = _compQueueLanes[laneIndex - 1]._tail;
+
+    // Skip over entries whose priority could not be given a lane because
+    // we ran out of lanes. In the common case this loop does not iterate.
+    TR_MethodToBeCompiled* next = prev ? prev->_next : _methodQueue;
+    while (next && next->_priority >= entry->_priority) {
+        prev = next;
+        next = next->_next;
+    }
+
+    entry->_prev = prev;
+    entry->_next = next;
+    if (prev)
+        prev->_next = entry;
+    else
         _methodQueue = entry;
-    } else {
-        for (TR_MethodToBeCompiled* prev = _methodQueue;; prev = prev->_next) {
-            if (!prev->_next || prev->_next->_priority < entry->_priority) {
-                entry->_next = prev->_next;
-                prev->_next = entry;
-                break;
-            }
-        }
+    if (next)
+        next->_prev = entry;
+
+    if (laneExists) {
+        _compQueueLanes[laneIndex]._tail = entry;
+    } else if (_numCompQueueLanes < MAX_COMP_QUEUE_LANES) {
+        memmove(&_compQueueLanes[laneIndex + 1], &_compQueueLanes[laneIndex],
+            (_numCompQueueLanes - laneIndex) * sizeof(CompQueueLane));
+        _compQueueLanes[laneIndex]._priority = entry->_priority;
+        _compQueueLanes[laneIndex]._tail = entry;
+        _numCompQueueLanes++;
+    }
+
+    uint16_t bucket = compQueueIndexBucket(entry->getMethodDetails().getMethod());
+    entry->_queueIndexBucket = bucket;
+    entry->_nextInQueueIndex = _methodQueueIndex[bucket];
+    _methodQueueIndex[bucket] = entry;
+}
+
+//--------------------------- dequeueEntry -------------------------------
+// Detach the given entry from the compilation queue, its priority lane
+// and the J9Method index. Must have compilationQueueMonitor in hand.
+// Queue accounting is the responsibility of the caller.
+//------------------------------------------------------------------------
+void TR::CompilationInfo::dequeueEntry(TR_MethodToBeCompiled* entry)
+{
+    TR_ASSERT(entry->_prev || _methodQueue == entry, "dequeuing an entry which is not in the queue\n");
+
+    int32_t laneIndex = findCompQueueLane(entry->_priority);
+    if (laneIndex < _numCompQueueLanes && _compQueueLanes[laneIndex]._tail == entry) {
+        if (entry->_prev && entry->_prev->_priority == entry->_priority)
+            _compQueueLanes[laneIndex]._tail = entry->_prev;
+        else
+            removeCompQueueLane(laneIndex);
     }
+
+    if (entry->_prev)
+        entry->_prev->_next = entry->_next;
+    else
+        _methodQueue = entry->_next;
+    if (entry->_next)
+        entry->_next->_prev = entry->_prev;
+
+    TR_MethodToBeCompiled** link = &_methodQueueIndex[entry->_queueIndexBucket];
+    while (*link && *link != entry)
+        link = &(*link)->_nextInQueueIndex;
+    TR_ASSERT(*link, "entry %p missing from the compilation queue index\n", entry);
+    if (*link)
+        *link = entry->_nextInQueueIndex;
+
+    entry->_next = NULL;
+    entry->_prev = NULL;
+    entry->_nextInQueueIndex = NULL;
+}
+
+int32_t TR::CompilationInfo::findCompQueueLane(uint16_t priority)
+{
+    // Lanes are sorted by descending priority; return the first one
+    // that does not have a higher priority than the one given
+    int32_t laneIndex = 0;
+    while (laneIndex < _numCompQueueLanes && _compQueueLanes[laneIndex]._priority > priority)
+        laneIndex++;
+    return laneIndex;
+}
+
+void TR::CompilationInfo::removeCompQueueLane(int32_t laneIndex)
+{
+    _numCompQueueLanes--;
+    memmove(&_compQueueLanes[laneIndex], &_compQueueLanes[laneIndex + 1],
+        (_numCompQueueLanes - laneIndex) * sizeof(CompQueueLane));
+}
+
+//--------------------------- findQueuedEntry ----------------------------
+// Search the compilation queue (not the threads) for a request matching
+// the given details. Must have compilationQueueMonitor in hand.
+//------------------------------------------------------------------------
+TR_MethodToBeCompiled* TR::CompilationInfo::findQueuedEntry(TR::IlGeneratorMethodDetails& details, TR_FrontEnd* fe)
+{
+    TR_MethodToBeCompiled* cur = _methodQueueIndex[compQueueIndexBucket(details.getMethod())];
+    for (; cur; cur = cur->_nextInQueueIndex)
+        if (cur->getMethodDetails().sameAs(details, fe))
+            return cur;
+    return NULL;
+}
+
+TR_MethodToBeCompiled* TR::CompilationInfo::findQueuedEntryForMethod(J9Method* method)
+{
+    TR_MethodToBeCompiled* cur = _methodQueueIndex[compQueueIndexBucket(method)];
+    for (; cur; cur = cur->_nextInQueueIndex)
+        if (!cur->isDLTCompile() && method == cur->getMethodDetails().getMethod())
+            return cur;
+    return NULL;
 }
 
 //--------------------------------- requeue ----------------------------------
@@ -3973,11 +4355,7 @@ TR_MethodToBeCompiled* TR::CompilationInfo::adjustCompilationEntryAndRequeue(TR:
     }
 
     // Search the queue for my method
-    TR_MethodToBeCompiled *cur, *prev;
-    for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next) {
-        if (cur->getMethodDetails().sameAs(details, fe))
-            break;
-    }
+    TR_MethodToBeCompiled* cur = findQueuedEntry(details, fe);
     if (cur) {
         // here define the list of exclusions
         bool exclude = cur->getMethodDetails().isNewInstanceThunk()
@@ -3992,10 +4370,7 @@ TR_MethodToBeCompiled* TR::CompilationInfo::adjustCompilationEntryAndRequeue(TR:
 
             if (cur->_priority < priority) {
                 // take the method out
-                if (prev)
-                    prev->_next = cur->_next;
-                else
-                    _methodQueue = cur->_next;
+                dequeueEntry(cur);
                 // put it back at its proper place
                 cur->_priority = priority;
                 queueEntry(cur);
@@ -4006,7 +4381,14 @@ TR_MethodToBeCompiled* TR::CompilationInfo::adjustCompilationEntryAndRequeue(TR:
     return cur;
 }
 
-int32_t TR::CompilationInfo::promoteMethodInAsyncQueue(J9Method* method, void* pc)
+//------------------------- promoteMethodInAsyncQueue ------------------------
+// Move an async request to the front of the async requests. Returns 0 if the
+// method is being compiled, a positive value if the request was promoted and a
+// negative value otherwise. Finding the position of the request means walking
+// the queue, so the magnitude is the position only when computePosition is set.
+// Must have compilation monitor in hand.
+//----------------------------------------------------------------------------
+int32_t TR::CompilationInfo::promoteMethodInAsyncQueue(J9Method* method, void* pc, bool computePosition)
 {
     // See if the method is already in the queue or is already being compiled
     //
@@ -4022,46 +4404,40 @@ int32_t TR::CompilationInfo::promoteMethodInAsyncQueue(J9Method* method, void* p
         }
     }
 
-    int i = 0;
-    TR_MethodToBeCompiled *cur, *prev;
-    for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next) {
-        if (!cur->isDLTCompile() && method == cur->getMethodDetails().getMethod())
-            break;
-        i++;
+    TR_MethodToBeCompiled* cur = findQueuedEntryForMethod(method);
+
+    // The position of the request in the queue is reported to the caller
+    int32_t i = 1;
+    if (computePosition) {
+        if (cur) {
+            i = 0;
+            for (TR_MethodToBeCompiled* prev = cur->_prev; prev; prev = prev->_prev)
+                i++;
+        } else {
+            i = _numQueuedMethods;
+        }
     }
 
-    if (!cur || !prev || cur->_priority >= CP_ASYNC_MAX || prev->_priority >= CP_ASYNC_MAX)
+    // Nothing to do if the request is already at the front of the async requests
+    if (!cur || !cur->_prev || cur->_priority >= CP_ASYNC_MAX || cur->_prev->_priority >= CP_ASYNC_MAX)
         return -i;
     changeCompThreadPriority(J9THREAD_PRIORITY_MAX, 9);
     _statNumQueuePromotions++;
 #ifdef STATS
     fprintf(stderr, "Promoting method in queue QSZ=%d\n", getMethodQueueSize());
 #endif
+    // take the method out and put it back in the CP_ASYNC_MAX lane
+    dequeueEntry(cur);
     cur->_priority = CP_ASYNC_MAX;
-
-    // take the method out
-    prev->_next = cur->_next;
-    // find insertion point
-    if (_methodQueue->_priority < CP_ASYNC_MAX) // common case
-    {
-        cur->_next = _methodQueue;
-        _methodQueue = cur;
-        // FIXME: how about the compilation lag
-    } else {
-        for (prev = _methodQueue; prev->_next; prev = prev->_next)
-            if (prev->_next->_priority < CP_ASYNC_MAX) {
-                cur->_next = prev->_next;
-                prev->_next = cur;
-                break;
-            }
-    }
+    queueEntry(cur);
+    // FIXME: how about the compilation lag
     return i;
 }
 
 void TR::CompilationInfo::changeCompReqFromAsyncToSync(J9Method* method)
 {
 
-    TR_MethodToBeCompiled *cur = NULL, *prev = NULL;
+    TR_MethodToBeCompiled* cur = NULL;
     // See if the method is already in the queue or is already being compiled
     //
     for (uint8_t i = 0; i < getNumUsableCompilationThreads(); i++) {
@@ -4079,22 +4455,15 @@ void TR::CompilationInfo::changeCompReqFromAsyncToSync(J9Method* method)
         }
     }
     if (!cur) {
-        for (cur = _methodQueue; cur; prev = cur, cur = cur->_next)
-            if (!cur->isDLTCompile() && method == cur->getMethodDetails().getMethod())
-                break;
+        cur = findQueuedEntryForMethod(method);
         // Check if this is an asynchronous request
         //
         if (cur && cur->_priority <= CP_ASYNC_MAX) {
             // Take the method out, increase its priority and insert it at the proper place
             //
+            dequeueEntry(cur);
             cur->_priority = CP_SYNC_NORMAL;
-            if (prev) {
-                prev->_next = cur->_next;
-                queueEntry(cur);
-            } else // method already at the top of the queue
-            {
-                // Nothing to do
-            }
+            queueEntry(cur);
         } else {
             cur = NULL; // prevent further processing
         }
@@ -4129,10 +4498,7 @@ TR_MethodToBeCompiled* TR::CompilationInfo::requestExistsInCompilationQueue(
             return curCompThreadInfoPT->getMethodBeingCompiled();
     }
 
-    for (TR_MethodToBeCompiled* cur = _methodQueue; cur; cur = cur->_next)
-        if (cur->getMethodDetails().sameAs(details, fe))
-            return cur;
-    return NULL;
+    return findQueuedEntry(details, fe);
 }
 
 TR_MethodToBeCompiled* TR::CompilationInfo::peekNextMethodToBeCompiled()
@@ -4166,7 +4532,7 @@ TR_MethodToBeCompiled* TR::CompilationInfo::getNextMethodToBeCompiled(
             _methodQueue->_methodIsInSharedCache == TR_yes) // very cheap relocation
         {
             m = _methodQueue;
-            _methodQueue = _methodQueue->_next;
+            dequeueEntry(m);
         }
         // Check if we need to throttle
         else if (exceedsCompCpuEntitlement() == TR_yes && !compThreadCameOutOfSleep
@@ -4185,16 +4551,15 @@ TR_MethodToBeCompiled* TR::CompilationInfo::getNextMethodToBeCompiled(
             _methodQueue->_weight < TR::Options::_expensiveCompWeight) // This is a cheaper comp
         {
             m = _methodQueue;
-            _methodQueue = _methodQueue->_next;
+            dequeueEntry(m);
         } else // scan for a cold/warm method
         {
-            TR_MethodToBeCompiled* prev = _methodQueue;
-            for (m = _methodQueue->_next; m; prev = m, m = m->_next) {
+            for (m = _methodQueue->_next; m; m = m->_next) {
                 if (m->_optimizationPlan->getOptLevel() <= warm || // cheaper comp
                     m->_priority >= CP_SYNC_MIN || // sync comp
                     m->_methodIsInSharedCache == TR_yes) // very cheap relocation
                 {
-                    prev->_next = m->_next;
+                    dequeueEntry(m);
                     break;
                 }
             }
@@ -5027,17 +5392,11 @@ void* TR::CompilationInfo::compileOnSeparateThread(J9VMThread* vmThread, TR::IlG
         if (!async)
             changeCompReqFromAsyncToSync(method);
         else {
-            TR_MethodToBeCompiled *reqMe, *prevReq;
-            for (prevReq = NULL, reqMe = _methodQueue; reqMe; prevReq = reqMe, reqMe = reqMe->_next) {
-                if (!reqMe->isDLTCompile() && reqMe->getMethodDetails().getMethod() == method)
-                    break;
-            }
+            TR_MethodToBeCompiled* reqMe = findQueuedEntryForMethod(method);
             if (reqMe && reqMe->_priority < CP_ASYNC_ABOVE_NORMAL) {
+                dequeueEntry(reqMe);
                 reqMe->_priority = CP_ASYNC_ABOVE_NORMAL;
-                if (prevReq && prevReq->_priority < CP_ASYNC_ABOVE_NORMAL) {
-                    prevReq->_next = reqMe->_next;
-                    queueEntry(reqMe);
-                }
+                queueEntry(reqMe);
             }
         }
     }
@@ -5086,15 +5445,22 @@ void* TR::CompilationInfo::compileOnSeparateThread(J9VMThread* vmThread, TR::IlG
         // is waiting on comp monitor because it wants the avoid two hot concurrent compilations
         // (if the really active comp thread gets suspended we remain with just one comp thread
         // sleeping and no notification will be sent)
-        if (getMethodQueueSize() <= 1
-            || getNumCompThreadsJobless()
-                > 0) // send notification if any thread is sleeping on comp monitor waiting for suitable work
+        if (getNumCompThreadsJobless()
+            > 0) // send notification if any thread is sleeping on comp monitor waiting for suitable work
         {
             debugPrint(vmThread, "\tnotifying the compilation thread of the compile request\n");
-            getCompilationMonitor()->notifyAll();
+            notifyCompilationThreads();
+            debugPrint(vmThread, "ntfy-CM\n");
+        } else if (getMethodQueueSize() <= 1) {
+            // Compilation threads that found the queue empty sleep on their own monitors,
+            // so one of them can be woken without waking every waiter of the comp monitor.
+            // A single notify() of the comp monitor is not enough: waitOnCompiler(), shutdown
+            // and throttled compilation threads also wait there and could take the notification.
+            debugPrint(vmThread, "\tnotifying one compilation thread of the compile request\n");
+            if (!notifyIdleCompThread())
+                getCompilationMonitor()->notifyAll();
             debugPrint(vmThread, "ntfy-CM\n");
         }
-        // TODO find a way to wake up only one compilation thread
 
         // Release the compilation monitor
         //
@@ -5121,7 +5487,7 @@ void* TR::CompilationInfo::compileOnSeparateThread(J9VMThread* vmThread, TR::IlG
         if (dynamicThreadPriority())
             changeCompThreadPriority(J9THREAD_PRIORITY_MAX, 11);
         debugPrint(vmThread, "\tnotifying the compilation thread of the compile request\n");
-        getCompilationMonitor()->notifyAll();
+        notifyCompilationThreads();
         debugPrint(vmThread, "ntfy-CM\n");
 
         // Temporary sanity check
@@ -5447,8 +5813,10 @@ TR_MethodMetaData* TR::CompilationInfoPerThreadBase::installAotCachedMethod(J9VM
         if (entry) {
             entry->_compErrCode = returnCode;
             entry->setAotCodeToBeRelocated(NULL); // reset if relocation failed
-            entry->_tryCompilingAgain = _compInfo.shouldRetryCompilation(
-                entry, compiler); // this will set entry->_doNotUseAotCodeFromSharedCache = true;
+            // A failed eager AOT load is not retried as a compilation
+            entry->_tryCompilingAgain = entry->_reqFromSecondaryQueue != TR_MethodToBeCompiled::REASON_EAGER_AOT_LOAD
+                && _compInfo.shouldRetryCompilation(
+                    entry, compiler); // this will set entry->_doNotUseAotCodeFromSharedCache = true;
 
             // Feature [Defect 172216/180384]: Implement hints for failed AOT validations.  The idea is that the failed
             // validations are due to the fact that AOT methods are loaded at a lower count than when they were compiled
@@ -5962,6 +6330,16 @@ void* TR::CompilationInfoPerThreadBase::postCompilationTasks(J9VMThread* vmThrea
         TR_ASSERT(0, "Should never have compiled replaced method %p", method);
         metaData = 0;
         entry->_compErrCode = compilationKilledByClassReplacement;
+    } else if (entry->_reqFromSecondaryQueue == TR_MethodToBeCompiled::REASON_EAGER_AOT_LOAD && !metaData) {
+        // An eager AOT load that could not be performed is neither retried nor turned into
+        // a compilation, and the method must not be marked as failed. Give the method its
+        // invocation count back so that it is compiled as usual once the count expires
+        entry->_tryCompilingAgain = false;
+        if (TR::CompilationInfo::getJ9MethodVMExtra(method) == J9_JIT_QUEUED_FOR_COMPILATION) {
+            J9ROMMethod* romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(method);
+            TR::CompilationInfo::setInvocationCount(
+                method, getCount(romMethod, TR::Options::getCmdLineOptions(), TR::Options::getAOTCmdLineOptions()));
+        }
     } else if (TR::CompilationInfo::shouldRetryCompilation(entry, _compiler)) {
         startPC = entry->_oldStartPC; // startPC == oldStartPC means compilation failure
         entry->_tryCompilingAgain = true;
@@ -6195,7 +6573,12 @@ void* TR::CompilationInfoPerThreadBase::compile(
         CompileParameters compParam(this, _vm, vmThread, reloRuntime, entry->_optimizationPlan, regionSegmentProvider,
             dispatchRegion, trMemory, TR::CompileIlGenRequest(entry->getMethodDetails()));
 
-        if ((TR::Options::canJITCompile() || canDoRelocatableCompile || entry->_aotCodeToBeRelocated)
+        if (entry->_reqFromSecondaryQueue == TR_MethodToBeCompiled::REASON_EAGER_AOT_LOAD
+            && !entry->_aotCodeToBeRelocated) {
+            // The AOT body was invalidated after the request was queued.
+            // An eager AOT load never falls back to a compilation
+            entry->_compErrCode = compilationNotNeeded;
+        } else if ((TR::Options::canJITCompile() || canDoRelocatableCompile || entry->_aotCodeToBeRelocated)
 #if defined(TR_HOST_ARM)
             && !TR::Options::getCmdLineOptions()->getOption(TR_FullSpeedDebug)
 #endif
@@ -9535,6 +9918,7 @@ uint64_t TR::CompilationInfo::computeFreePhysicalLimitAndAbortCompilationIfLow(
 TR_LowPriorityCompQueue::TR_LowPriorityCompQueue()
     : _firstLPQentry(NULL)
     , _lastLPQentry(NULL)
+    , _lastEagerAOTLoadLPQentry(NULL)
     , _sizeLPQ(0)
     , _LPQWeight(0)
     , _trackingEnabled(false)
@@ -9547,8 +9931,10 @@ TR_LowPriorityCompQueue::TR_LowPriorityCompQueue()
     , _STAT_LPQcompFromIprofiler(0)
     , _STAT_LPQcompFromInterpreter(0)
     , _STAT_LPQcompUpgrade(0)
+    , _STAT_LPQcompEagerAOTLoad(0)
     , _STAT_compReqQueuedByInterpreter(0)
     , _STAT_numFailedToEnqueueInLPQ(0)
+    , _STAT_compReqQueuedForEagerAOTLoad(0)
 {}
 
 void TR_LowPriorityCompQueue::startTrackingIProfiledCalls(int32_t threshold)
@@ -9645,7 +10031,7 @@ void TR_LowPriorityCompQueue::tryToScheduleCompilation(J9VMThread* vmThread, J9M
                         // we may have to notify a sleeping thread or activate a new one
                         if (enqueued && _compInfo->canProcessLowPriorityRequest()) {
                             if (_compInfo->getNumCompThreadsJobless() > 0) {
-                                _compInfo->getCompilationMonitor()->notifyAll();
+                                _compInfo->notifyCompilationThreads();
                                 if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseCompilationThreads)) {
                                     TR_VerboseLog::writeLineLocked(TR_Vlog_INFO,
                                         "t=%6u LPQ logic waking up a sleeping comp thread. Jobless=%d",
@@ -9777,6 +10163,9 @@ void TR_LowPriorityCompQueue::incStatsCompFromLPQ(uint8_t reason)
     case TR_MethodToBeCompiled::REASON_UPGRADE:
         _STAT_LPQcompUpgrade++;
         break;
+    case TR_MethodToBeCompiled::REASON_EAGER_AOT_LOAD:
+        _STAT_LPQcompEagerAOTLoad++;
+        break;
     default:
         TR_ASSERT(false, "No other known reason for LPQ compilations\n");
     }
@@ -9794,6 +10183,9 @@ void TR_LowPriorityCompQueue::incStatsReqQueuedToLPQ(uint8_t reason)
     case TR_MethodToBeCompiled::REASON_UPGRADE:
         _STAT_compReqQueuedByJIT++;
         break;
+    case TR_MethodToBeCompiled::REASON_EAGER_AOT_LOAD:
+        _STAT_compReqQueuedForEagerAOTLoad++;
+        break;
     default:
         TR_ASSERT(false, "No other known reason for LPQ compilations\n");
     }
@@ -9809,6 +10201,8 @@ void TR_LowPriorityCompQueue::printStats() const
     fprintf(stderr, "   Comps.  from LPQ = %4u (Sources: IProfiler=%3u Interpreter=%3u JIT=%3u)\n",
         _STAT_LPQcompFromIprofiler + _STAT_LPQcompFromInterpreter + _STAT_LPQcompUpgrade, _STAT_LPQcompFromIprofiler,
         _STAT_LPQcompFromInterpreter, _STAT_LPQcompUpgrade);
+    fprintf(stderr, "   Eager AOT loads  = %4u (queued=%u)\n", _STAT_LPQcompEagerAOTLoad,
+        _STAT_compReqQueuedForEagerAOTLoad);
 
     fprintf(stderr, "   Conflicts        = %4u (tried to cache j9method that didn't have space)\n", _STAT_conflict);
     fprintf(stderr, "   Stale entries    = %4u\n", _STAT_staleScrubbed); // we want very few of these, hopefully 0
@@ -9840,6 +10234,8 @@ void TR_LowPriorityCompQueue::invalidateRequestsForUnloadedMethods(J9Class* unlo
                     _firstLPQentry = cur->_next;
                 if (cur == _lastLPQentry)
                     _lastLPQentry = prev;
+                if (cur == _lastEagerAOTLoadLPQentry)
+                    _lastEagerAOTLoadLPQentry = prev;
                 _sizeLPQ--;
                 decreaseLPQWeightBy(cur->_weight);
 
@@ -9863,6 +10259,7 @@ void TR_LowPriorityCompQueue::purgeLPQ()
         _compInfo->recycleCompilationEntry(cur);
     }
     _lastLPQentry = NULL;
+    _lastEagerAOTLoadLPQentry = NULL;
 }
 
 TR_MethodToBeCompiled* TR_LowPriorityCompQueue::extractFirstLPQRequest()
@@ -9874,6 +10271,8 @@ TR_MethodToBeCompiled* TR_LowPriorityCompQueue::extractFirstLPQRequest()
     decreaseLPQWeightBy(m->_weight);
     if (!_firstLPQentry)
         _lastLPQentry = 0;
+    if (m == _lastEagerAOTLoadLPQentry)
+        _lastEagerAOTLoadLPQentry = NULL;
     return m;
 }
 
@@ -9899,6 +10298,8 @@ TR_MethodToBeCompiled* TR_LowPriorityCompQueue::findAndDequeueFromLPQ(
                     _firstLPQentry = cur->_next;
                 if (cur == _lastLPQentry)
                     _lastLPQentry = prev;
+                if (cur == _lastEagerAOTLoadLPQentry)
+                    _lastEagerAOTLoadLPQentry = prev;
                 _sizeLPQ--;
                 decreaseLPQWeightBy(cur->_weight);
                 dequeued = true;
@@ -9939,8 +10340,19 @@ TR_CompilationErrorCode TR::CompilationInfo::scheduleLPQAndBumpCount(
             // Place request in LPQ if it doesn't already exist
             bool queued = true;
             if (entry) {
-                // Change the reason so that when the counter expires again we move the entry to the main queue
-                entry->_reqFromSecondaryQueue = TR_MethodToBeCompiled::REASON_LOW_COUNT_EXPIRED;
+                if (entry->_reqFromSecondaryQueue == TR_MethodToBeCompiled::REASON_EAGER_AOT_LOAD) {
+                    // Requeue the entry behind the eager AOT loads, which must stay at the front of the LPQ
+                    bool detached = false;
+                    getLowPriorityCompQueue().findAndDequeueFromLPQ(
+                        details, TR_MethodToBeCompiled::REASON_EAGER_AOT_LOAD, fe, detached);
+                    TR_ASSERT(detached, "We must have detached the eager AOT load we found");
+                    entry->_next = NULL;
+                    entry->_reqFromSecondaryQueue = TR_MethodToBeCompiled::REASON_LOW_COUNT_EXPIRED;
+                    getLowPriorityCompQueue().enqueueCompReqToLPQ(entry);
+                } else {
+                    // Change the reason so that when the counter expires again we move the entry to the main queue
+                    entry->_reqFromSecondaryQueue = TR_MethodToBeCompiled::REASON_LOW_COUNT_EXPIRED;
+                }
             } else // try to queue
             {
                 queued = getLowPriorityCompQueue().addFirstTimeCompReqToLPQ(
@@ -289,7 +289,11 @@ public:
     void processEntries();
     void processEntry(TR_MethodToBeCompiled& entry, J9::J9SegmentProvider& scratchSegmentProvider);
     bool shouldPerformCompilation(TR_MethodToBeCompiled& entry);
+    bool canPerformEagerAOTLoad(TR_MethodToBeCompiled& entry);
     void waitForWork();
+    intptr_t waitOnEmptyQueue(int64_t millis);
+    bool isWaitingOnEmptyQueue() const { return _waitingOnEmptyQueue; }
+    void notifyEmptyQueueWaiter();
     void doSuspend();
     void suspendCompilationThread();
     void resumeCompilationThread();
@@ -306,6 +310,8 @@ public:
     void setLastCompilationDuration(int32_t t) { _lastCompilationDuration = t; }
     bool isDiagnosticThread() const { return _isDiagnosticThread; }
     CpuSelfThreadUtilization& getCompThreadCPU() { return _compThreadCPU; }
+    void updateQueueTimeStats(TR_MethodToBeCompiled& entry);
+    void printQueueTimeStats();
 
 private:
     J9::J9SegmentCache initializeSegmentCache(J9::J9SegmentProvider& segmentProvider);
@@ -322,6 +328,15 @@ private:
     bool _initializationSucceeded;
     bool _isDiagnosticThread;
     CpuSelfThreadUtilization _compThreadCPU;
+    // Time (ms) requests handled by this thread spent in the queue; guarded by the compilation monitor
+    uint32_t _statNumRequestsDequeued;
+    uint64_t _statTotalQueueTime;
+    uint64_t _statMaxQueueTime;
+    uint32_t _statQueueTimeHistogram[8]; // buckets of <1, <2, <4, ... <64, >=64 ms
+    // A thread that found the queue empty sleeps on its own _compThreadMonitor so that a
+    // new request can wake exactly one such thread instead of all waiters of the comp monitor
+    bool _waitingOnEmptyQueue; // guarded by the compilation monitor
+    bool _emptyQueueWaitNotified; // guarded by _compThreadMonitor
 }; // CompilationInfoPerThread
 
 } // namespace TR
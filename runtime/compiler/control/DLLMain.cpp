@@ -496,8 +496,10 @@ IDATA J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 #if defined(J9VM_INTERP_PROFILING_BYTECODES)
             TR_IProfiler* iProfiler = fe->getIProfiler();
             if (iProfiler) {
-                J9VMThread* iProfilerThread = iProfiler->getIProfilerThread();
-                if (iProfilerThread) {
+                for (int32_t i = 0; i < iProfiler->getNumIProfilerThreads(); i++) {
+                    J9VMThread* iProfilerThread = iProfiler->getIProfilerThread(i);
+                    if (!iProfilerThread)
+                        continue;
                     vm->internalVMFunctions->initializeAttachedThread(curThread, "IProfiler", vm->systemThreadGroupRef,
                         ((iProfilerThread->privateFlags & J9_PRIVATE_FLAGS_DAEMON_THREAD) != 0), iProfilerThread);
                     if ((curThread->currentException != NULL) || (curThread->threadObject == NULL)) {
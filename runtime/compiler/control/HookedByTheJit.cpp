@@ -400,6 +400,7 @@ static void jitHookInitializeSendTarget(J9HookInterface** hook, UDATA eventNum,
     }
 
     int32_t count = -1; // means we didn't set the value yet
+    bool eagerAOTLoad = false; // load the AOT body from the SCC before the count expires
 
     // compile BigDecimal methods containing DFP stubs right away
     // we want to encode an initial count of 0 for those methods
@@ -459,6 +460,11 @@ static void jitHookInitializeSendTarget(J9HookInterface** hook, UDATA eventNum,
                     }
                     count = scount;
                     compInfo->incrementNumMethodsFoundInSharedCache();
+                    // An AOT body means the method was hot in a previous run; during startup
+                    // let idle compilation threads load it before the application needs it
+                    if (TR::Options::_eagerAOTLoadLimit > 0 && jitConfig->javaVM->phase != J9VM_PHASE_NOT_STARTUP
+                        && !optionsAOT->getOption(TR_NoLoadAOT))
+                        eagerAOTLoad = true;
                 }
                 // AOT Body not in SCC, so scount was not set
                 else if (!TR::Options::getCountsAreProvidedByUser()) {
@@ -572,6 +578,12 @@ static void jitHookInitializeSendTarget(J9HookInterface** hook, UDATA eventNum,
 
     TR::CompilationInfo::setInitialInvocationCountUnsynchronized(method, count);
 
+    // Must be done after the count is set because LPQ requests are discarded for methods without a valid count.
+    // eagerAOTLoad is only set when an AOT body was found in the SCC above, so methods without one never
+    // reach scheduleEagerAOTLoad and its compilation monitor
+    if (eagerAOTLoad && count > 0)
+        compInfo->scheduleEagerAOTLoad(method);
+
     if (TR::Options::getJITCmdLineOptions()->getOption(TR_DumpInitialMethodNamesAndCounts)
         || TR::Options::getAOTCmdLineOptions()->getOption(TR_DumpInitialMethodNamesAndCounts)) {
         bool containsInfo = sharedCacheContainsProfilingInfoForMethod(vmThread, compInfo, method);
@@ -130,6 +130,7 @@ int32_t J9::Options::_iprofilerReactivateThreshold = 10;
 int32_t J9::Options::_iprofilerIntToTotalSampleRatio = 2;
 int32_t J9::Options::_iprofilerSamplesBeforeTurningOff = 1000000; // samples
 int32_t J9::Options::_iprofilerNumOutstandingBuffers = 10;
+int32_t J9::Options::_iprofilerNumThreads = 1;
 int32_t J9::Options::_iprofilerBufferMaxPercentageToDiscard = 0;
 int32_t J9::Options::_iProfilerBufferInterarrivalTimeToExitDeepIdle = 5000; // 5 seconds
 int32_t J9::Options::_iprofilerBufferSize = 1024;
@@ -179,6 +180,7 @@ int32_t J9::Options::_waitTimeToStartIProfiler = 1000; // ms
 int32_t J9::Options::_compilationDelayTime = 0; // sec; 0 means disabled
 
 int32_t J9::Options::_invocationThresholdToTriggerLowPriComp = 250;
+int32_t J9::Options::_eagerAOTLoadLimit = 0; // disabled by default
 
 int32_t J9::Options::_aotMethodThreshold = 200;
 int32_t J9::Options::_aotMethodCompilesThreshold = 200;
@@ -715,6 +717,10 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         (intptrj_t)&TR::Options::_disableIProfilerClassUnloadThreshold, 0, "F%d", NOT_IN_SUBSET },
     { "dltPostponeThreshold=", "M<nnn>\tNumber of dlt attepts inv. count for a method is seen not advancing",
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_dltPostponeThreshold, 0, "F%d", NOT_IN_SUBSET },
+    { "eagerAOTLoadLimit=",
+        "M<nnn>\tMax number of AOT bodies from the shared class cache that are loaded during startup "
+        "before their first invocation. 0 (default) disables eager AOT loads",
+        TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_eagerAOTLoadLimit, 0, "F%d", NOT_IN_SUBSET },
     { "exclude=", "D<xxx>\tdo not compile methods beginning with xxx", TR::Options::limitOption, 1, 0, "P%s" },
     { "expensiveCompWeight=", "M<nnn>\tweight of a comp request to be considered expensive",
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_expensiveCompWeight, 0, "F%d", NOT_IN_SUBSET },
@@ -849,6 +855,8 @@ TR::OptionTable OMR::Options::_feOptions[] = {
         "allowed in the system. Specify 0 to disable this optimization",
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_iprofilerNumOutstandingBuffers, 0, "F%d",
         NOT_IN_SUBSET },
+    { "iprofilerNumThreads=", "O<nnn>\tnumber of threads that parse interpreter profiling buffers (1-8)",
+        TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_iprofilerNumThreads, 0, "F%d", NOT_IN_SUBSET },
     { "iprofilerOffDivisionFactor=", "O<nnn>\tCounts Division factor when IProfiler is Off",
         TR::Options::setStaticNumeric, (intptrj_t)&TR::Options::_IprofilerOffDivisionFactor, 0, "F%d", NOT_IN_SUBSET },
     { "iprofilerOffSubtractionFactor=", "O<nnn>\tCounts Subtraction factor when IProfiler is Off",
@@ -165,6 +165,7 @@ public:
     static int32_t _iprofilerIntToTotalSampleRatio;
     static int32_t _iprofilerSamplesBeforeTurningOff;
     static int32_t _iprofilerNumOutstandingBuffers;
+    static int32_t _iprofilerNumThreads;
     static int32_t _iprofilerBufferMaxPercentageToDiscard;
     static int32_t _iProfilerBufferInterarrivalTimeToExitDeepIdle; // ms
     static int32_t _iprofilerBufferSize; // iprofilerbuffer size in kb
@@ -248,6 +249,8 @@ public:
 
     static int32_t _invocationThresholdToTriggerLowPriComp; // we trigger an LPQ comp req only if the method
                                                             // was invoked at least this many times
+    static int32_t _eagerAOTLoadLimit; // max number of AOT bodies loaded ahead of their first invocation during
+                                       // startup; 0 means disabled
     static int32_t _aotMethodThreshold; // when number of methods found in shared cache exceeds this threshold
                                         // we stop AOTing new methods to be put in shared cache UNLESS
     static int32_t _aotMethodCompilesThreshold; // we have already AOT compiled at least this many methods
@@ -53,6 +53,9 @@ void TR_MethodToBeCompiled::initialize(TR::IlGeneratorMethodDetails& details, vo
     _methodDetails = TR::IlGeneratorMethodDetails::clone(_methodDetailsStorage, details);
     _optimizationPlan = optimizationPlan;
     _next = NULL;
+    _prev = NULL;
+    _nextInQueueIndex = NULL;
+    _queueIndexBucket = 0;
     _oldStartPC = oldStartPC;
     _newStartPC = NULL;
     _priority = p;
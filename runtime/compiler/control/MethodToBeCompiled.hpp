@@ -47,7 +47,13 @@ struct J9JITConfig;
 struct J9VMThread;
 
 struct TR_MethodToBeCompiled {
-    enum LPQ_REASON { REASON_NONE = 0, REASON_IPROFILER_CALLS, REASON_LOW_COUNT_EXPIRED, REASON_UPGRADE };
+    enum LPQ_REASON {
+        REASON_NONE = 0,
+        REASON_IPROFILER_CALLS,
+        REASON_LOW_COUNT_EXPIRED,
+        REASON_UPGRADE,
+        REASON_EAGER_AOT_LOAD
+    };
     static int16_t _globalIndex;
     static TR_MethodToBeCompiled* allocate(J9JITConfig* jitConfig);
     void shutdown();
@@ -65,6 +71,8 @@ struct TR_MethodToBeCompiled {
     void setAotCodeToBeRelocated(const void* m);
 
     TR_MethodToBeCompiled* _next;
+    TR_MethodToBeCompiled* _prev; // only valid while the entry is in the main compilation queue
+    TR_MethodToBeCompiled* _nextInQueueIndex; // chain of queued entries that hash to the same J9Method bucket
     TR::IlGeneratorMethodDetails _methodDetailsStorage;
     TR::IlGeneratorMethodDetails* _methodDetails;
     void* _oldStartPC;
@@ -116,6 +124,7 @@ struct TR_MethodToBeCompiled {
     uint8_t _weight; // Up to 256 levels of weight
     bool _hasIncrementedNumCompThreadsCompilingHotterMethods;
     uint8_t _jitStateWhenQueued;
+    uint16_t _queueIndexBucket; // bucket of the compilation queue index this entry was hashed into
 }; // TR_MethodToBeCompiled
 
 #endif // METHODTOBECOMPILED_HPP
@@ -2608,13 +2608,9 @@ bool TR_J9VMBase::isQueuedForVeryHotOrScorching(TR_ResolvedMethod* calleeMethod,
     _compInfo->acquireCompMonitor(_vmThread);
     // Check again in case another thread has already upgraded this request
 
-    for (TR_MethodToBeCompiled* cur = TR::CompilationController::getCompilationInfo()->getMethodQueue(); cur;
-         cur = cur->_next) {
-        if (cur->getMethodDetails().sameAs(details, this)) {
-            isQueuedForVeryHotOrScorching = cur->_optimizationPlan->getOptLevel() >= veryHot;
-            break;
-        }
-    }
+    TR_MethodToBeCompiled* cur = TR::CompilationController::getCompilationInfo()->findQueuedEntry(details, this);
+    if (cur)
+        isQueuedForVeryHotOrScorching = cur->_optimizationPlan->getOptLevel() >= veryHot;
 
     _compInfo->releaseCompMonitor(_vmThread);
     return isQueuedForVeryHotOrScorching;
@@ -69,8 +69,10 @@
 #include "ilgen/J9ByteCodeIterator.hpp"
 #include "runtime/IProfiler.hpp"
 #include "runtime/J9Profiler.hpp"
+#include "AtomicSupport.hpp"
 
-#define BC_HASH_TABLE_SIZE 34501 // 131071// 34501
+#define BC_HASH_TABLE_INITIAL_SIZE 16384 // must be a power of two
+#define BC_HASH_TABLE_SLOT_ALIGNMENT 64 // cache line
 #undef IPROFILER_CONTENDED_LOCKING
 #define ALLOC_HASH_TABLE_SIZE 1201
 #define TEST_verbose 0
@@ -101,7 +103,7 @@ const uint32_t INVALID_BYTECODE_INDEX = ~0;
 extern "C" int32_t getCount(J9ROMMethod* romMethod, TR::Options* optionsJIT, TR::Options* optionsAOT);
 
 static J9PortLibrary* staticPortLib = NULL;
-static uint32_t memoryConsumed = 0;
+static volatile uintptr_t memoryConsumed = 0; // updated by several threads, use VM_AtomicSupport::add
 
 static void printHashedCallSite(TR_IPHashedCallSite* hcs, ::FILE* fout = stderr, void* tag = NULL)
 {
@@ -498,11 +500,11 @@ void TR_IProfiler::persistIprofileInfo(
     }
 }
 
-uint32_t TR_IProfiler::getProfilerMemoryFootprint() { return memoryConsumed; }
+uint32_t TR_IProfiler::getProfilerMemoryFootprint() { return (uint32_t)memoryConsumed; }
 
 void* TR_IProfiler::operator new(size_t size) throw()
 {
-    memoryConsumed += (int32_t)size;
+    VM_AtomicSupport::add(&memoryConsumed, size);
     void* alloc = jitPersistentAlloc(size);
     return alloc;
 }
@@ -522,20 +524,23 @@ TR_IProfiler::TR_IProfiler(J9JITConfig* jitConfig)
     , _globalAllocationCount(0)
     , _maxCallFrequency(0)
     , _iprofilerThread(0)
-    , _iprofilerOSThread(NULL)
+    , _numIProfilerThreads(0)
+    , _numIProfilerThreadsAlive(0)
+    , _iprofilerThreadsStopRequested(false)
     , _workingBufferTail(NULL)
     , _numOutstandingBuffers(0)
     , _numRequests(1)
     , _numRequestsSkipped(0)
     , _numRequestsHandedToIProfilerThread(0)
+    , _numRequestsInvalidated(0)
     , _iprofilerThreadExitFlag(0)
     , _iprofilerMonitor(NULL)
-    , _crtProfilingBuffer(NULL)
-    , _iprofilerThreadAttachAttempted(false)
     , _iprofilerNumRecords(0)
 {
     PORT_ACCESS_FROM_JITCONFIG(jitConfig);
 
+    memset(_iprofilerThreads, 0, sizeof(_iprofilerThreads));
+
     _iprofilerBufferSize = (uint32_t)jitConfig->iprofilerBufferSize; // J9_PROFILING_BUFFER_SIZE;
     _portLib = jitConfig->javaVM->portLibrary;
     _vm = TR_J9VMBase::get(jitConfig, 0);
@@ -551,11 +556,16 @@ TR_IProfiler::TR_IProfiler(J9JITConfig* jitConfig)
     _hashTableMonitor = TR::Monitor::create("JIT-InterpreterProfilingMonitor");
 
     // bytecode hashtable
-    _bcHashTable
-        = (TR_IPBytecodeHashTableEntry**)jitPersistentAlloc(BC_HASH_TABLE_SIZE * sizeof(TR_IPBytecodeHashTableEntry*));
-    if (_bcHashTable != NULL)
-        memset(_bcHashTable, 0, BC_HASH_TABLE_SIZE * sizeof(TR_IPBytecodeHashTableEntry*));
-    else
+    _bcHashTable = allocateBCHashTable(BC_HASH_TABLE_INITIAL_SIZE);
+    _numBCHashTableEntries = 0;
+    _numBCHashTableGrowths = 0;
+    _bcHashTableGrowthFailed = false;
+    for (uint32_t i = 0; i < BC_HASH_TABLE_NUM_STRIPES; i++) {
+        _bcHashTableStripeLocks[i] = TR::Monitor::create("JIT-IProfilerBCHashTableStripeMonitor");
+        if (!_bcHashTableStripeLocks[i])
+            _isIProfilingEnabled = false;
+    }
+    if (_bcHashTable == NULL)
         _isIProfilingEnabled = false;
 
 #if defined(EXPERIMENTAL_IPROFILER)
@@ -600,7 +610,13 @@ bool TR_IProfiler::isCallGraphProfilingEnabled()
     return _enableCGProfiling && !_compInfo->getPersistentInfo()->isClassLoadingPhase();
 }
 
-inline int32_t TR_IProfiler::bcHash(uintptrj_t pc) { return (int32_t)((pc & 0x7FFFFFFF) % BC_HASH_TABLE_SIZE); }
+// Bytecode pcs are dense within a method, so mix the bits (Fibonacci hashing)
+// before the result gets masked down to a power of two table size.
+inline uint32_t TR_IProfiler::bcHash(uintptrj_t pc)
+{
+    uint64_t h = (uint64_t)pc * (uint64_t)0x9E3779B97F4A7C15ULL;
+    return (uint32_t)(h >> 32);
+}
 
 inline int32_t TR_IProfiler::allocHash(uintptrj_t pc) { return (int32_t)((pc & 0x7FFFFFFF) % ALLOC_HASH_TABLE_SIZE); }
 
@@ -910,13 +926,75 @@ bool TR_IProfiler::addSampleData(TR_IPBytecodeHashTableEntry* entry, uintptrj_t
     return false;
 }
 
-TR_IPBytecodeHashTableEntry* TR_IProfiler::searchForSample(uintptrj_t pc, int32_t bucket)
+TR_IPBCHashTable* TR_IProfiler::allocateBCHashTable(uint32_t size)
 {
-    TR_IPBytecodeHashTableEntry* entry;
+    TR_ASSERT((size & (size - 1)) == 0, "bytecode hashtable size %u must be a power of two", size);
+    size_t allocatedBytes = sizeof(TR_IPBCHashTable) + size * sizeof(TR_IPBCHashSlot) + BC_HASH_TABLE_SLOT_ALIGNMENT;
+    TR_IPBCHashTable* table = (TR_IPBCHashTable*)jitPersistentAlloc(allocatedBytes);
+    if (!table)
+        return NULL;
+    VM_AtomicSupport::add(&memoryConsumed, allocatedBytes);
+
+    uintptrj_t slots = (uintptrj_t)(table + 1);
+    slots = (slots + BC_HASH_TABLE_SLOT_ALIGNMENT - 1) & ~(uintptrj_t)(BC_HASH_TABLE_SLOT_ALIGNMENT - 1);
+    table->_slots = (TR_IPBCHashSlot*)slots;
+    memset(table->_slots, 0, size * sizeof(TR_IPBCHashSlot));
+    table->_size = size;
+    table->_mask = size - 1;
+    table->_allocatedBytes = allocatedBytes;
+    table->_retired = NULL;
+    return table;
+}
+
+// Called without holding any stripe lock. Does nothing if another thread has
+// already replaced the outgrown table. If the new table cannot be allocated,
+// growth is disabled for good so that inserts stop taking all stripe locks.
+void TR_IProfiler::growBCHashTable(TR_IPBCHashTable* outgrownTable)
+{
+    for (uint32_t i = 0; i < BC_HASH_TABLE_NUM_STRIPES; i++)
+        _bcHashTableStripeLocks[i]->enter();
+
+    TR_IPBCHashTable* oldTable = _bcHashTable;
+    if (oldTable == outgrownTable && !_bcHashTableGrowthFailed) {
+        TR_IPBCHashTable* newTable = allocateBCHashTable(oldTable->_size * 2);
+        if (newTable) {
+            // No insertion can be in progress because we hold all stripe locks
+            for (uint32_t i = 0; i < oldTable->_size; i++) {
+                TR_IPBCHashSlot* oldSlot = oldTable->_slots + i;
+                if (!oldSlot->_entry)
+                    continue;
+                uint32_t index = bcHash(oldSlot->_pc) & newTable->_mask;
+                while (newTable->_slots[index]._entry)
+                    index = (index + 1) & newTable->_mask;
+                newTable->_slots[index]._entry = oldSlot->_entry;
+                newTable->_slots[index]._pc = oldSlot->_pc;
+            }
+            newTable->_retired = oldTable;
+            VM_AtomicSupport::writeBarrier();
+            _bcHashTable = newTable;
+            _numBCHashTableGrowths++;
+        } else {
+            _bcHashTableGrowthFailed = true;
+        }
+    }
 
-    for (entry = _bcHashTable[bucket]; entry; entry = entry->getNext()) {
-        if (pc == entry->getPC())
-            return entry;
+    for (int32_t i = BC_HASH_TABLE_NUM_STRIPES - 1; i >= 0; i--)
+        _bcHashTableStripeLocks[i]->exit();
+}
+
+TR_IPBytecodeHashTableEntry* TR_IProfiler::searchForSample(uintptrj_t pc, TR_IPBCHashTable* table)
+{
+    uint32_t index = bcHash(pc) & table->_mask;
+    for (uint32_t probes = 0; probes < table->_size; probes++) {
+        TR_IPBCHashSlot* slot = table->_slots + index;
+        uintptrj_t slotPC = slot->_pc;
+        if (slotPC == pc) {
+            VM_AtomicSupport::readBarrier();
+            return slot->_entry;
+        }
+        if (!slot->_entry)
+            break;
+        index = (index + 1) & table->_mask;
     }
 
     return NULL;
@@ -937,11 +1015,11 @@ TR_IPBCDataAllocation* TR_IProfiler::searchForAllocSample(uintptrj_t pc, int32_t
     return NULL;
 }
 
-TR_IPBytecodeHashTableEntry* TR_IProfiler::findOrCreateEntry(int32_t bucket, uintptrj_t pc, bool addIt)
+TR_IPBytecodeHashTableEntry* TR_IProfiler::findOrCreateEntry(uintptrj_t pc, bool addIt)
 {
     TR_IPBytecodeHashTableEntry* entry = NULL;
 
-    entry = searchForSample(pc, bucket);
+    entry = searchForSample(pc, _bcHashTable);
     // if we are just searching and we didn't find profile data for the
     // method just go back
     if (!addIt)
@@ -950,6 +1028,29 @@ TR_IPBytecodeHashTableEntry* TR_IProfiler::findOrCreateEntry(int32_t bucket, uin
     if (entry)
         return entry;
 
+    TR::Monitor* stripeLock = bcHashTableStripeLock(pc);
+    stripeLock->enter();
+    TR_IPBCHashTable* table = _bcHashTable;
+    // Keep the load factor below 3/4, otherwise linear probing degrades quickly
+    while (!_bcHashTableGrowthFailed && (_numBCHashTableEntries + 1) * 4 > table->_size * 3) {
+        stripeLock->exit();
+        growBCHashTable(table);
+        stripeLock->enter();
+        table = _bcHashTable;
+    }
+    // Out of memory; keep filling the table we have, but never completely
+    if ((_numBCHashTableEntries + 1) * 16 > table->_size * 15) {
+        stripeLock->exit();
+        return NULL;
+    }
+
+    // Another thread may have added this pc while we were not holding the stripe lock
+    entry = searchForSample(pc, table);
+    if (entry) {
+        stripeLock->exit();
+        return entry;
+    }
+
     // Create a new hash table entry
     U_8 byteCode = *(U_8*)pc;
     if (isCompact(byteCode))
@@ -961,12 +1062,26 @@ TR_IPBytecodeHashTableEntry* TR_IProfiler::findOrCreateEntry(int32_t bucket, uin
             entry = new TR_IPBCDataCallGraph(pc);
     }
 
-    if (!entry)
+    if (!entry) {
+        stripeLock->exit();
         return NULL;
+    }
 
-    entry->setNext(_bcHashTable[bucket]);
-    FLUSH_MEMORY(TR::Compiler->target.isSMP());
-    _bcHashTable[bucket] = entry;
+    // Entries for other stripes may be inserted concurrently, so slots are claimed
+    // with compare-and-swap. The pc is published last; readers skip the slot until then.
+    uint32_t index = bcHash(pc) & table->_mask;
+    while (true) {
+        TR_IPBCHashSlot* slot = table->_slots + index;
+        if (!slot->_entry
+            && 0 == VM_AtomicSupport::lockCompareExchange((uintptr_t*)&slot->_entry, 0, (uintptr_t)entry)) {
+            VM_AtomicSupport::writeBarrier();
+            slot->_pc = pc;
+            break;
+        }
+        index = (index + 1) & table->_mask;
+    }
+    VM_AtomicSupport::add((uintptr_t*)&_numBCHashTableEntries, 1);
+    stripeLock->exit();
 
     return entry;
 }
@@ -1023,7 +1138,7 @@ TR_IPMethodHashTableEntry* TR_IProfiler::findOrCreateMethodEntry(
         entry->add((TR_OpaqueMethodBlock*)callerMethod, (TR_OpaqueMethodBlock*)calleeMethod, pcIndex);
     } else // create a new hash table entry
     {
-        memoryConsumed += (int32_t)sizeof(TR_IPMethodHashTableEntry);
+        VM_AtomicSupport::add(&memoryConsumed, sizeof(TR_IPMethodHashTableEntry));
         entry = (TR_IPMethodHashTableEntry*)jitPersistentAlloc(sizeof(TR_IPMethodHashTableEntry));
         if (entry) {
             memset(entry, 0, sizeof(TR_IPMethodHashTableEntry));
@@ -1176,8 +1291,9 @@ TR_IPBytecodeHashTableEntry* TR_IProfiler::persistentProfilingSample(
 
             if (store) {
                 // Create a new IProfiler hashtable entry and copy the data from the SCC
-                TR_IPBytecodeHashTableEntry* newEntry = findOrCreateEntry(bcHash(pc), pc, true);
-                newEntry->loadFromPersistentCopy(store, comp, cacheOffset);
+                TR_IPBytecodeHashTableEntry* newEntry = findOrCreateEntry(pc, true);
+                if (newEntry)
+                    newEntry->loadFromPersistentCopy(store, comp, cacheOffset);
                 return newEntry;
             }
         }
@@ -1262,7 +1378,7 @@ TR_IPBytecodeHashTableEntry* TR_IProfiler::profilingSample(
 
         U_8 bytecode = *(U_8*)pc;
         // Find the pc in the IProfiler/bytecode hashtable
-        TR_IPBytecodeHashTableEntry* currentEntry = findOrCreateEntry(bcHash(pc), pc, false);
+        TR_IPBytecodeHashTableEntry* currentEntry = findOrCreateEntry(pc, false);
         TR_IPBytecodeHashTableEntry* persistentEntry = NULL;
         TR_IPBytecodeHashTableEntry* entry = currentEntry;
         TR_IPBCDataStorageHeader* persistentEntryStore = NULL;
@@ -1375,10 +1491,12 @@ TR_IPBytecodeHashTableEntry* TR_IProfiler::profilingSample(
             if (!currentEntry || (currentEntry->getData() == (uintptr_t)NULL)) {
                 if (persistentEntry && (persistentEntry->getData())) {
                     _STATS_IPEntryChoosePersistent++;
-                    currentEntry = findOrCreateEntry(bcHash(pc), pc, true);
-                    currentEntry->copyFromEntry(persistentEntry, comp);
-                    // Remember that we already looked into the SCC for this PC
-                    currentEntry->setPersistentEntryRead();
+                    currentEntry = findOrCreateEntry(pc, true);
+                    if (currentEntry) {
+                        currentEntry->copyFromEntry(persistentEntry, comp);
+                        // Remember that we already looked into the SCC for this PC
+                        currentEntry->setPersistentEntryRead();
+                    }
                     return currentEntry;
                 }
             }
@@ -1450,7 +1568,7 @@ int32_t TR_IPBCDataEightWords::getSumSwitchCount()
 TR_IPBytecodeHashTableEntry* TR_IProfiler::profilingSample(
     uintptrj_t pc, uintptrj_t data, bool addIt, bool isRIData, uint32_t freq)
 {
-    TR_IPBytecodeHashTableEntry* entry = findOrCreateEntry(bcHash(pc), pc, addIt);
+    TR_IPBytecodeHashTableEntry* entry = findOrCreateEntry(pc, addIt);
 
     if (entry && addIt) {
         if (invalidateEntryIfInconsistent(entry))
@@ -2319,6 +2437,8 @@ void TR_IProfiler::outputStats()
     }
     fprintf(stderr, "IProfiler: Number of records processed=%llu\n", _iprofilerNumRecords);
     fprintf(stderr, "IProfiler: Number of hashtable entries=%u\n", countEntries());
+    fprintf(stderr, "IProfiler: Number of hashtable slots=%u (grown %u times)\n", _bcHashTable->_size,
+        _numBCHashTableGrowths);
     checkMethodHashTable();
 }
 
@@ -2326,12 +2446,12 @@ void* TR_IPBytecodeHashTableEntry::alignedPersistentAlloc(size_t size)
 {
 #if defined(TR_HOST_64BIT)
     size += 4;
-    memoryConsumed += (int32_t)size;
+    VM_AtomicSupport::add(&memoryConsumed, size);
     void* address = (void*)jitPersistentAlloc(size);
 
     return (void*)(((uintptrj_t)address + 4) & ~0x7);
 #else
-    memoryConsumed += (int32_t)size;
+    VM_AtomicSupport::add(&memoryConsumed, size);
     return jitPersistentAlloc(size);
 #endif
 }
@@ -2922,55 +3042,45 @@ void TR_IProfiler::printAllocationReport()
 uint32_t TR_IProfiler::releaseAllEntries()
 {
     uint32_t count = 0;
-    for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++) {
-        for (TR_IPBytecodeHashTableEntry* entry = _bcHashTable[bucket]; entry; entry = entry->getNext()) {
-            if (entry->asIPBCDataCallGraph() && entry->asIPBCDataCallGraph()->isLocked()) {
-                count++;
-                entry->asIPBCDataCallGraph()->releaseEntry();
-            }
+    TR_IPBCHashTable* table = _bcHashTable;
+    for (uint32_t i = 0; i < table->_size; i++) {
+        TR_IPBytecodeHashTableEntry* entry = table->_slots[i]._entry;
+        if (entry && entry->asIPBCDataCallGraph() && entry->asIPBCDataCallGraph()->isLocked()) {
+            count++;
+            entry->asIPBCDataCallGraph()->releaseEntry();
         }
     }
     return count;
 }
 
-uint32_t TR_IProfiler::countEntries()
-{
-    uint32_t count = 0;
-    for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++)
-        for (TR_IPBytecodeHashTableEntry* entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
-            count++;
-    return count;
-}
+uint32_t TR_IProfiler::countEntries() { return (uint32_t)_numBCHashTableEntries; }
 
 // helper functions for replay
 //
 void TR_IProfiler::setupEntriesInHashTable(TR_IProfiler* ip)
 {
-    for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++) {
-        TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket], *prevEntry = NULL;
+    TR_IPBCHashTable* table = _bcHashTable;
+    for (uint32_t i = 0; i < table->_size; i++) {
+        TR_IPBytecodeHashTableEntry* entry = table->_slots[i]._entry;
+        if (!entry)
+            continue;
 
-        while (entry) {
-            uintptrj_t pc = entry->getPC();
-
-            if (pc == 0 || pc == 0xffffffff) {
-                printf("invalid pc for entry %p %p\n", entry, pc);
-                fflush(stdout);
-                prevEntry = entry;
-                entry = entry->getNext();
-                continue;
-            }
+        uintptrj_t pc = entry->getPC();
 
-            TR_IPBytecodeHashTableEntry* newEntry = ip->findOrCreateEntry(bucket, pc, true);
-            // check for entries corresponding to
-            // unloaded methods, findOrCreateEntry will
-            // return NULL above. its ok to ignore these entries
-            // as they are invalid anyway
-            //
-            if (newEntry)
-                ip->copyDataFromEntry(entry, newEntry, NULL);
-            prevEntry = entry;
-            entry = entry->getNext();
+        if (pc == 0 || pc == 0xffffffff) {
+            printf("invalid pc for entry %p %p\n", entry, pc);
+            fflush(stdout);
+            continue;
         }
+
+        TR_IPBytecodeHashTableEntry* newEntry = ip->findOrCreateEntry(pc, true);
+        // check for entries corresponding to
+        // unloaded methods, findOrCreateEntry will
+        // return NULL above. its ok to ignore these entries
+        // as they are invalid anyway
+        //
+        if (newEntry)
+            ip->copyDataFromEntry(entry, newEntry, NULL);
     }
     printf("Finished adding entries from core to new iprofiler\n");
 }
@@ -3164,7 +3274,8 @@ bool TR_IProfiler::getCallerWeight(TR_OpaqueMethodBlock* calleeMethod, TR_Opaque
 
 static int32_t J9THREAD_PROC iprofilerThreadProc(void* entryarg)
 {
-    J9JITConfig* jitConfig = (J9JITConfig*)entryarg;
+    TR_IProfilerThreadInfo* threadInfo = (TR_IProfilerThreadInfo*)entryarg;
+    J9JITConfig* jitConfig = threadInfo->_jitConfig;
     J9JavaVM* vm = jitConfig->javaVM;
     TR_J9VMBase* fe = TR_J9VM::get(jitConfig, 0);
     TR_IProfiler* iProfiler = fe->getIProfiler();
@@ -3174,11 +3285,14 @@ static int32_t J9THREAD_PROC iprofilerThreadProc(void* entryarg)
     int rc = vm->internalVMFunctions->internalAttachCurrentThread(vm, &iprofilerThread, NULL,
         J9_PRIVATE_FLAGS_DAEMON_THREAD | J9_PRIVATE_FLAGS_NO_OBJECT | J9_PRIVATE_FLAGS_SYSTEM_THREAD
             | J9_PRIVATE_FLAGS_ATTACHED_THREAD,
-        iProfiler->getIProfilerOSThread());
+        threadInfo->_osThread);
     iProfiler->getIProfilerMonitor()->enter();
-    iProfiler->setAttachAttempted(true);
-    if (rc == JNI_OK)
-        iProfiler->setIProfilerThread(iprofilerThread);
+    threadInfo->_attachAttempted = true;
+    if (rc == JNI_OK) {
+        threadInfo->_vmThread = iprofilerThread;
+        if (threadInfo->_index == 0)
+            iProfiler->setIProfilerThread(iprofilerThread);
+    }
     iProfiler->getIProfilerMonitor()->notifyAll();
     iProfiler->getIProfilerMonitor()->exit();
     if (rc != JNI_OK)
@@ -3189,19 +3303,18 @@ static int32_t J9THREAD_PROC iprofilerThreadProc(void* entryarg)
         (*vm->javaOffloadSwitchOnWithReasonFunc)(iprofilerThread, J9_JNI_OFFLOAD_SWITCH_JIT_IPROFILER_THREAD);
 #endif
 
-    j9thread_set_name(j9thread_self(), "JIT IProfiler");
+    // Keep the historical name when there is a single IProfiler thread; otherwise tell the threads apart
+    if (TR::Options::_iprofilerNumThreads > 1)
+        sprintf(threadInfo->_name, "JIT IProfiler Thread-%d", threadInfo->_index);
+    else
+        strcpy(threadInfo->_name, "JIT IProfiler");
+    j9thread_set_name(j9thread_self(), threadInfo->_name);
 
-    iProfiler->processWorkingQueue();
+    iProfiler->processWorkingQueue(threadInfo);
 
     vm->internalVMFunctions->DetachCurrentThread((JavaVM*)vm);
-    iProfiler->setIProfilerThread(NULL);
     iProfiler->getIProfilerMonitor()->enter();
-    // free the special buffer because we don't need it anymore
-    if (iProfiler->getCrtProfilingBuffer()) {
-        j9mem_free_memory(iProfiler->getCrtProfilingBuffer());
-        iProfiler->setCrtProfilingBuffer(NULL);
-    }
-    iProfiler->setIProfilerThreadExitFlag();
+    iProfiler->iprofilerThreadExiting(threadInfo);
     iProfiler->getIProfilerMonitor()->notifyAll();
     j9thread_exit((J9ThreadMonitor*)iProfiler->getIProfilerMonitor()->getVMMonitor());
 
@@ -3215,6 +3328,16 @@ static int32_t J9THREAD_PROC iprofilerThreadProc(void* entryarg)
     return 0;
 }
 
+// Must be called with the iprofilerMonitor in hand
+void TR_IProfiler::iprofilerThreadExiting(TR_IProfilerThreadInfo* threadInfo)
+{
+    threadInfo->_vmThread = NULL;
+    if (threadInfo->_index == 0)
+        setIProfilerThread(NULL);
+    if (--_numIProfilerThreadsAlive == 0)
+        _iprofilerThreadExitFlag = 1;
+}
+
 void TR_IProfiler::startIProfilerThread(J9JavaVM* javaVM)
 {
     PORT_ACCESS_FROM_PORT(_portLib);
@@ -3224,19 +3347,40 @@ void TR_IProfiler::startIProfilerThread(J9JavaVM* javaVM)
 
     _iprofilerMonitor = TR::Monitor::create("JIT-iprofilerMonitor");
     if (_iprofilerMonitor) {
-        // create the thread for interpreter profiling
-        if (javaVM->internalVMFunctions->createThreadWithCategory(&_iprofilerOSThread,
-                TR::Options::_profilerStackSize << 10, priority, 0, &iprofilerThreadProc, javaVM->jitConfig,
-                J9THREAD_CATEGORY_SYSTEM_JIT_THREAD)) {
-            j9tty_printf(PORTLIB, "Error: Unable to create iprofiler thread\n");
+        int32_t numThreads = TR::Options::_iprofilerNumThreads;
+        if (numThreads < 1)
+            numThreads = 1;
+        else if (numThreads > MAX_IPROFILER_THREADS)
+            numThreads = MAX_IPROFILER_THREADS;
+        int32_t numThreadsCreated = 0;
+        // create the threads for interpreter profiling
+        for (int32_t i = 0; i < numThreads; i++) {
+            TR_IProfilerThreadInfo* threadInfo = _iprofilerThreads + i;
+            threadInfo->_jitConfig = javaVM->jitConfig;
+            threadInfo->_index = i;
+            if (javaVM->internalVMFunctions->createThreadWithCategory(&threadInfo->_osThread,
+                    TR::Options::_profilerStackSize << 10, priority, 0, &iprofilerThreadProc, threadInfo,
+                    J9THREAD_CATEGORY_SYSTEM_JIT_THREAD)) {
+                j9tty_printf(PORTLIB, "Error: Unable to create iprofiler thread\n");
+                break;
+            }
+            numThreadsCreated++;
+        }
+
+        if (numThreadsCreated == 0) {
             TR::Options::getCmdLineOptions()->setOption(TR_DisableIProfilerThread);
             // TODO:destroy the monitor that was created (_iprofilerMonitor)
             _iprofilerMonitor = NULL;
-        } else // Must wait here until the thread gets created; otherwise an early shutdown
-        { // does not know whether or not to destroy the thread
+        } else // Must wait here until the threads get created; otherwise an early shutdown
+        { // does not know whether or not to destroy the threads
             _iprofilerMonitor->enter();
-            while (!getAttachAttempted())
-                _iprofilerMonitor->wait();
+            for (int32_t i = 0; i < numThreadsCreated; i++) {
+                while (!_iprofilerThreads[i]._attachAttempted)
+                    _iprofilerMonitor->wait();
+                if (_iprofilerThreads[i]._vmThread)
+                    _numIProfilerThreadsAlive++;
+            }
+            _numIProfilerThreads = numThreadsCreated;
             _iprofilerMonitor->exit();
         }
     } else {
@@ -3274,33 +3418,18 @@ void TR_IProfiler::deallocateIProfilerBuffers()
 
 void TR_IProfiler::stopIProfilerThread()
 {
-    PORT_ACCESS_FROM_PORT(_portLib);
     if (!_iprofilerMonitor)
         return; // possible if the IProfiler thread was never created
     _iprofilerMonitor->enter();
-    if (!getIProfilerThread()) // We could not create the iprofilerThread
+    if (_numIProfilerThreadsAlive == 0) // We could not create any iprofilerThread
     {
         _iprofilerMonitor->exit();
         return;
     }
 
-    // get a special buffer which will be used as a signal to stop iprofilerThread
-    //
-    IProfilerBuffer* specialProfilingBuffer = NULL;
-    if (!_freeBufferList.isEmpty()) {
-        specialProfilingBuffer = _freeBufferList.pop();
-    } else if (!_workingBufferList.isEmpty()) {
-        specialProfilingBuffer = _workingBufferList.pop();
-        _numOutstandingBuffers--;
-        if (_workingBufferList.isEmpty())
-            _workingBufferTail = NULL;
-    } else {
-        specialProfilingBuffer = (IProfilerBuffer*)j9mem_allocate_memory(sizeof(IProfilerBuffer), J9MEM_CATEGORY_JIT);
-        if (specialProfilingBuffer)
-            specialProfilingBuffer->setBuffer(NULL);
-    }
-
-    // Deallocate all outstanding buffers
+    // Tell the iprofiler threads to stop; from now on java threads will not post
+    // any more buffers, so the buffers still waiting in the queue can be dropped
+    _iprofilerThreadsStopRequested = true;
     while (!_workingBufferList.isEmpty()) {
         IProfilerBuffer* profilingBuffer = _workingBufferList.pop();
         _numOutstandingBuffers--;
@@ -3308,24 +3437,33 @@ void TR_IProfiler::stopIProfilerThread()
     }
     _workingBufferTail = NULL;
 
-    // Add the special request
-    if (specialProfilingBuffer) {
-        if (specialProfilingBuffer->getBuffer())
-            j9mem_free_memory(specialProfilingBuffer->getBuffer());
-        specialProfilingBuffer->setBuffer(NULL);
-        specialProfilingBuffer->setSize(0);
-        _workingBufferList.add(specialProfilingBuffer);
-        _workingBufferTail = specialProfilingBuffer;
-        // wait for the iprofilerThread to stop
-        while (!_iprofilerThreadExitFlag) {
-            _iprofilerMonitor->notifyAll();
-            _iprofilerMonitor->wait();
-        }
+    // wait for all the iprofiler threads to stop
+    while (!_iprofilerThreadExitFlag) {
+        _iprofilerMonitor->notifyAll();
+        _iprofilerMonitor->wait();
     }
 
+    if (TR::Options::getCmdLineOptions()->getOption(TR_VerboseInterpreterProfiling))
+        printIProfilerThreadStats();
+
     _iprofilerMonitor->exit();
 }
 
+void TR_IProfiler::printIProfilerThreadStats()
+{
+    TR_VerboseLog::vlogAcquire();
+    TR_VerboseLog::writeLine(TR_Vlog_IPROFILER,
+        "IProfiler buffers: requests=%llu skipped=%llu queued=%llu dropped from queue by class unloading=%llu",
+        _numRequests, _numRequestsSkipped, _numRequestsHandedToIProfilerThread, _numRequestsInvalidated);
+    for (int32_t i = 0; i < _numIProfilerThreads; i++) {
+        TR_IProfilerThreadInfo* threadInfo = _iprofilerThreads + i;
+        TR_VerboseLog::writeLine(TR_Vlog_IPROFILER,
+            "IProfiler thread %d: buffers parsed=%llu discarded=%llu records=%llu", threadInfo->_index,
+            threadInfo->_statBuffersParsed, threadInfo->_statBuffersDiscarded, threadInfo->_statRecordsParsed);
+    }
+    TR_VerboseLog::vlogRelease();
+}
+
 // The following method is executed by the app thread and tries to post a
 // iprofiling buffer to the working queue, so that the iprofiling thread
 // can process it
@@ -3337,8 +3475,9 @@ bool TR_IProfiler::postIprofilingBufferToWorkingQueue(J9VMThread* vmThread, cons
     if (!_iprofilerMonitor || _iprofilerMonitor->try_enter())
         return false; // Monitor is contended; better let the app thread do the processing
 
-    // If the profiling thread has already been destroyed, delegate the processing to the java thread
-    if (_iprofilerThreadExitFlag) {
+    // If the profiling threads are stopping or have already been destroyed,
+    // delegate the processing to the java thread
+    if (_iprofilerThreadsStopRequested || _iprofilerThreadExitFlag) {
         _iprofilerMonitor->exit();
         return false;
     }
@@ -3371,7 +3510,12 @@ bool TR_IProfiler::postIprofilingBufferToWorkingQueue(J9VMThread* vmThread, cons
     _numOutstandingBuffers++;
 
     //--- signal the processing thread
-    _iprofilerMonitor->notifyAll();
+    // Once all iprofiler threads have started, they are the only ones waiting
+    // on this monitor and waking one of them is enough for one buffer
+    if (_numIProfilerThreads > 1)
+        _iprofilerMonitor->notify();
+    else
+        _iprofilerMonitor->notifyAll();
     _iprofilerMonitor->exit();
     return true;
 }
@@ -3404,47 +3548,51 @@ bool TR_IProfiler::processProfilingBuffer(J9VMThread* vmThread, const U_8* dataS
     return true;
 }
 
-// This method is executed by the iprofiling thread
-void TR_IProfiler::processWorkingQueue()
+// This method is executed by the iprofiling threads
+void TR_IProfiler::processWorkingQueue(TR_IProfilerThreadInfo* threadInfo)
 {
-    PORT_ACCESS_FROM_PORT(_portLib);
+    J9VMThread* vmThread = threadInfo->_vmThread;
     // wait for something to do
     _iprofilerMonitor->enter();
     do {
-        while (_workingBufferList.isEmpty()) {
+        while (_workingBufferList.isEmpty() && !_iprofilerThreadsStopRequested) {
             // fprintf(stderr, "IProfiler thread will wait for data outstanding=%d\n", numOutstandingBuffers);
             _iprofilerMonitor->wait();
         }
+        if (_iprofilerThreadsStopRequested)
+            break;
         // We have some buffer to process
         // Dequeue the buffer to be processed
         //
-        _crtProfilingBuffer = _workingBufferList.pop();
+        IProfilerBuffer* profilingBuffer = _workingBufferList.pop();
         if (_workingBufferList.isEmpty())
             _workingBufferTail = NULL;
+        threadInfo->_crtProfilingBuffer = profilingBuffer;
 
         // We don't need the iprofiler monitor now
         _iprofilerMonitor->exit();
-        if (_crtProfilingBuffer->getSize() > 0) {
-            // process the buffer after acquiring VM access
-            acquireVMAccessNoSuspend(_iprofilerThread); // blocking. Will wait for the entire GC
-            // Check to see if GC has invalidated this buffer
-            if (_crtProfilingBuffer->isValid()) {
-                // fprintf(stderr, "IProfiler thread will process buffer %p of size %u\n", profilingBuffer->getBuffer(),
-                // profilingBuffer->getSize());
-                parseBuffer(_iprofilerThread, _crtProfilingBuffer->getBuffer(), _crtProfilingBuffer->getSize());
-                // fprintf(stderr, "IProfiler thread finished processing\n");
-            }
-            releaseVMAccess(_iprofilerThread);
-        } else // Special
-        {
-            break;
+        // process the buffer after acquiring VM access
+        acquireVMAccessNoSuspend(vmThread); // blocking. Will wait for the entire GC
+        // Check to see if GC has invalidated this buffer
+        if (profilingBuffer->isValid()) {
+            // fprintf(stderr, "IProfiler thread will process buffer %p of size %u\n", profilingBuffer->getBuffer(),
+            // profilingBuffer->getSize());
+            threadInfo->_statRecordsParsed
+                += parseBuffer(vmThread, profilingBuffer->getBuffer(), profilingBuffer->getSize());
+            threadInfo->_statBuffersParsed++;
+            // fprintf(stderr, "IProfiler thread finished processing\n");
+        } else {
+            threadInfo->_statBuffersDiscarded++;
         }
+        releaseVMAccess(vmThread);
+
         // attach the buffer to the buffer pool
         _iprofilerMonitor->enter();
-        _freeBufferList.add(_crtProfilingBuffer);
-        _crtProfilingBuffer = NULL;
+        _freeBufferList.add(profilingBuffer);
+        threadInfo->_crtProfilingBuffer = NULL;
         _numOutstandingBuffers--;
     } while (1);
+    _iprofilerMonitor->exit();
 }
 
 extern "C" void stopInterpreterProfiling(J9JITConfig* jitConfig);
@@ -3762,8 +3910,8 @@ void TR_IProfiler::jitProfileParseBuffer(J9VMThread* currentThread)
 
 //--------------------- invalidateProfilingBuffers -------------------
 // Called by GC on class unloading
-// Invalidates profiling buffers on the waiting list, but also the buffer
-// that might be currently under processing
+// Invalidates profiling buffers on the waiting list, but also the buffers
+// that might be currently under processing by the iprofiler threads
 // The method should not be called if profiling thread is not created
 // The waiting time for GC thread is very small because iprofiler thread
 // uses iprofilerMonitor in very short critical sections
@@ -3774,33 +3922,24 @@ void TR_IProfiler::invalidateProfilingBuffers() // called for class unloading
     if (!_iprofilerMonitor)
         return;
     _iprofilerMonitor->enter();
-    if (!getIProfilerThread()) {
+    if (_numIProfilerThreadsAlive == 0) {
         _iprofilerMonitor->exit();
         return;
     }
-    IProfilerBuffer* specialProfilingBuffer = NULL;
-    if (_crtProfilingBuffer && _crtProfilingBuffer->getSize() > 0) {
+    for (int32_t i = 0; i < _numIProfilerThreads; i++) {
+        IProfilerBuffer* crtProfilingBuffer = _iprofilerThreads[i]._crtProfilingBuffer;
         // mark this buffer as invalid
-        _crtProfilingBuffer->setIsInvalidated(true); // set with exclusive VM access
+        if (crtProfilingBuffer)
+            crtProfilingBuffer->setIsInvalidated(true); // set with exclusive VM access
     }
     while (!_workingBufferList.isEmpty()) {
         IProfilerBuffer* profilingBuffer = _workingBufferList.pop();
-        if (profilingBuffer->getSize() > 0) {
-            // attach the buffer to the buffer pool
-            _freeBufferList.add(profilingBuffer);
-            _numOutstandingBuffers--;
-        } else // When the iprofiler thread sees this special buffer it will exit
-        {
-            specialProfilingBuffer = profilingBuffer;
-        }
+        // attach the buffer to the buffer pool
+        _freeBufferList.add(profilingBuffer);
+        _numOutstandingBuffers--;
+        _numRequestsInvalidated++;
     }
     _workingBufferTail = NULL; // queue should be empty now
-
-    if (specialProfilingBuffer) {
-        // Put this buffer back
-        _workingBufferList.add(specialProfilingBuffer);
-        _workingBufferTail = specialProfilingBuffer;
-    }
     _iprofilerMonitor->exit();
 }
 
@@ -3824,7 +3963,7 @@ static void printCsInfo(CallSiteProfileInfo& csInfo, TR::Compilation* comp, void
 //
 void* TR_IPHashedCallSite::operator new(size_t size) throw()
 {
-    memoryConsumed += (int32_t)size;
+    VM_AtomicSupport::add(&memoryConsumed, size);
     void* alloc = jitPersistentAlloc(size);
     return alloc;
 }
@@ -4117,7 +4256,8 @@ void TR_AggregationHT::sortByNameAndPrint(TR_J9VMBase* fe)
 void TR_IProfiler::dumpIPBCDataCallGraph(J9VMThread* vmThread)
 {
     fprintf(stderr, "Dumping info ...\n");
-    TR_AggregationHT aggregationHT(BC_HASH_TABLE_SIZE);
+    TR_IPBCHashTable* table = _bcHashTable;
+    TR_AggregationHT aggregationHT(table->_size);
     if (aggregationHT.getSize() == 0) // OOM
     {
         fprintf(stderr, "Cannot allocate memory. Bailing out.\n");
@@ -4142,44 +4282,43 @@ void TR_IProfiler::dumpIPBCDataCallGraph(J9VMThread* vmThread)
     TR_J9VMBase* fe = TR_J9VMBase::get(javaVM->jitConfig, vmThread);
 
     fprintf(stderr, "Aggregating per method ...\n");
-    for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++) {
-        // fprintf(stderr, "Looking at bucket %d\n", bucket);
-        for (TR_IPBytecodeHashTableEntry* entry = _bcHashTable[bucket]; entry; entry = entry->getNext()) {
-            // Skip invalid entries
-            if (entry->isInvalid() || invalidateEntryIfInconsistent(entry))
-                continue;
-            TR_IPBCDataCallGraph* cgEntry = entry->asIPBCDataCallGraph();
-            if (cgEntry) {
-                // Get the pc and find the method this pc belongs to
-                U_8* pc = (U_8*)cgEntry->getPC();
-                // fprintf(stderr, "\tInspecting pc=%p\n", pc);
-                J9ClassLoader* loader;
-                J9ROMClass* romClass = vmFunctions->findROMClassFromPC(vmThread, (UDATA)pc, &loader);
-                if (romClass) {
-                    // J9ROMMethod * romMethod = vmFunctions->findROMMethodInROMClass(vmThread, romClass, (UDATA)pc,
-                    // NULL);
-                    J9ROMMethod* currentMethod = J9ROMCLASS_ROMMETHODS(romClass);
-                    J9ROMMethod* desiredMethod = NULL;
-                    // fprintf(stderr, "Scanning %u romMethods...\n", romClass->romMethodCount);
-                    for (U_32 i = 0; i < romClass->romMethodCount; i++) {
-                        if (((UDATA)pc >= (UDATA)currentMethod)
-                            && ((UDATA)pc < (UDATA)J9_BYTECODE_END_FROM_ROM_METHOD(currentMethod))) {
-                            // found the method
-                            desiredMethod = currentMethod;
-                            break;
-                        }
-                        currentMethod = nextROMMethod(currentMethod);
+    for (uint32_t slot = 0; slot < table->_size; slot++) {
+        // fprintf(stderr, "Looking at slot %u\n", slot);
+        TR_IPBytecodeHashTableEntry* entry = table->_slots[slot]._entry;
+        // Skip empty slots and invalid entries
+        if (!entry || entry->isInvalid() || invalidateEntryIfInconsistent(entry))
+            continue;
+        TR_IPBCDataCallGraph* cgEntry = entry->asIPBCDataCallGraph();
+        if (cgEntry) {
+            // Get the pc and find the method this pc belongs to
+            U_8* pc = (U_8*)cgEntry->getPC();
+            // fprintf(stderr, "\tInspecting pc=%p\n", pc);
+            J9ClassLoader* loader;
+            J9ROMClass* romClass = vmFunctions->findROMClassFromPC(vmThread, (UDATA)pc, &loader);
+            if (romClass) {
+                // J9ROMMethod * romMethod = vmFunctions->findROMMethodInROMClass(vmThread, romClass, (UDATA)pc,
+                // NULL);
+                J9ROMMethod* currentMethod = J9ROMCLASS_ROMMETHODS(romClass);
+                J9ROMMethod* desiredMethod = NULL;
+                // fprintf(stderr, "Scanning %u romMethods...\n", romClass->romMethodCount);
+                for (U_32 i = 0; i < romClass->romMethodCount; i++) {
+                    if (((UDATA)pc >= (UDATA)currentMethod)
+                        && ((UDATA)pc < (UDATA)J9_BYTECODE_END_FROM_ROM_METHOD(currentMethod))) {
+                        // found the method
+                        desiredMethod = currentMethod;
+                        break;
                     }
+                    currentMethod = nextROMMethod(currentMethod);
+                }
 
-                    if (desiredMethod) {
-                        // Add the information to the aggregationTable
-                        aggregationHT.add(desiredMethod, romClass, cgEntry);
-                    } else {
-                        fprintf(stderr, "pc=%p does not belong to romMethod range\n", pc);
-                    }
+                if (desiredMethod) {
+                    // Add the information to the aggregationTable
+                    aggregationHT.add(desiredMethod, romClass, cgEntry);
                 } else {
-                    fprintf(stderr, "pc=%p does not belong to a romMethod\n", pc);
+                    fprintf(stderr, "pc=%p does not belong to romMethod range\n", pc);
                 }
+            } else {
+                fprintf(stderr, "pc=%p does not belong to a romMethod\n", pc);
             }
         }
     }
@@ -297,6 +297,26 @@ public:
     void add(TR_OpaqueMethodBlock* caller, TR_OpaqueMethodBlock* callee, uint32_t pcIndex);
 };
 
+// Slot of the open addressing bytecode hashtable. The pc is kept next to the
+// entry pointer so that probing does not have to touch the entries themselves.
+// A slot whose _entry is NULL terminates a probe sequence; a slot whose _entry
+// is set but whose _pc is still 0 is being published and is skipped by readers.
+struct TR_IPBCHashSlot {
+    volatile uintptrj_t _pc;
+    TR_IPBytecodeHashTableEntry* volatile _entry;
+};
+
+// Bytecode hashtable: power of two number of slots, aligned to a cache line.
+// Tables that have been outgrown are chained through _retired and never freed,
+// because lock-free readers may still be probing them.
+struct TR_IPBCHashTable {
+    TR_IPBCHashSlot* _slots;
+    uint32_t _size;
+    uint32_t _mask;
+    size_t _allocatedBytes;
+    TR_IPBCHashTable* _retired;
+};
+
 class TR_IPBCDataFourBytes : public TR_IPBytecodeHashTableEntry {
 public:
     TR_PERSISTENT_ALLOC(TR_Memory::IPBCDataFourBytes)
@@ -495,6 +515,22 @@ private:
     volatile bool _isInvalidated;
 };
 
+// State kept for each IProfiler thread. All threads take buffers from the
+// same working queue and parse them into the shared hashtables.
+struct TR_IProfilerThreadInfo {
+    J9JITConfig* _jitConfig;
+    j9thread_t _osThread;
+    J9VMThread* _vmThread;
+    IProfilerBuffer* _crtProfilingBuffer; // profiling buffer being processed by this thread
+    int32_t _index;
+    char _name[32]; // thread name; must outlive the thread
+    volatile bool _attachAttempted;
+    // info stats only
+    uint64_t _statBuffersParsed;
+    uint64_t _statBuffersDiscarded; // invalidated by class unloading while being processed
+    uint64_t _statRecordsParsed;
+};
+
 class TR_ReadSampleRequestsStats {
     friend class TR_ReadSampleRequestsHistory;
 
@@ -605,17 +641,18 @@ public:
     uint32_t numSamplesInHistoryBuffer() const { return _readSampleRequestsHistory->numSamplesInHistoryBuffer(); }
 
 public:
+    static const int32_t MAX_IPROFILER_THREADS = 8;
+
+    // The first IProfiler thread; it is the only one that schedules low priority compilations
     J9VMThread* getIProfilerThread() { return _iprofilerThread; }
     void setIProfilerThread(J9VMThread* thread) { _iprofilerThread = thread; }
-    j9thread_t getIProfilerOSThread() { return _iprofilerOSThread; }
+    int32_t getNumIProfilerThreads() const { return _numIProfilerThreads; }
+    J9VMThread* getIProfilerThread(int32_t index) { return _iprofilerThreads[index]._vmThread; }
     TR::Monitor* getIProfilerMonitor() { return _iprofilerMonitor; }
     bool processProfilingBuffer(J9VMThread* vmThread, const U_8* dataStart, UDATA size);
-    void setAttachAttempted(bool b) { _iprofilerThreadAttachAttempted = b; }
-    void processWorkingQueue();
-    bool getAttachAttempted() const { return _iprofilerThreadAttachAttempted; }
-    IProfilerBuffer* getCrtProfilingBuffer() const { return _crtProfilingBuffer; }
-    void setCrtProfilingBuffer(IProfilerBuffer* b) { _crtProfilingBuffer = b; }
-    void setIProfilerThreadExitFlag() { _iprofilerThreadExitFlag = 1; }
+    void processWorkingQueue(TR_IProfilerThreadInfo* threadInfo);
+    void iprofilerThreadExiting(TR_IProfilerThreadInfo* threadInfo);
+    void printIProfilerThreadStats();
     void jitProfileParseBuffer(J9VMThread* vmThread);
     uint32_t getIProfilerThreadExitFlag() { return _iprofilerThreadExitFlag; }
     bool postIprofilingBufferToWorkingQueue(J9VMThread* vmThread, const U_8* dataStart, UDATA size);
@@ -653,7 +690,7 @@ private:
     TR_IPBCDataStorageHeader* getJ9SharedDataDescriptorForMethod(J9SharedDataDescriptor* descriptor,
         unsigned char* buffer, uint32_t length, TR_OpaqueMethodBlock* method, TR::Compilation* comp);
 
-    static int32_t bcHash(uintptrj_t);
+    static uint32_t bcHash(uintptrj_t);
     static int32_t allocHash(uintptrj_t);
 
     static int32_t methodHash(uintptrj_t pc);
@@ -666,7 +703,13 @@ private:
     bool acquireHashTableWriteLock(bool forceFullLock);
     void releaseHashTableWriteLock();
 
-    TR_IPBytecodeHashTableEntry* searchForSample(uintptrj_t pc, int32_t bucket);
+    TR_IPBytecodeHashTableEntry* searchForSample(uintptrj_t pc, TR_IPBCHashTable* table);
+    TR_IPBCHashTable* allocateBCHashTable(uint32_t size);
+    void growBCHashTable(TR_IPBCHashTable* outgrownTable);
+    TR::Monitor* bcHashTableStripeLock(uintptrj_t pc) const
+    {
+        return _bcHashTableStripeLocks[bcHash(pc) & (BC_HASH_TABLE_NUM_STRIPES - 1)];
+    }
     TR_IPBCDataStorageHeader* searchForPersistentSample(TR_IPBCDataStorageHeader* root, uintptrj_t pc);
     TR_IPBCDataAllocation* searchForAllocSample(uintptrj_t pc, int32_t bucket);
 
@@ -684,7 +727,7 @@ private:
         TR_IPBCDataStorageHeader* store);
 
     TR_IPBCDataAllocation* profilingAllocSample(uintptrj_t pc, uintptrj_t data, bool addIt);
-    TR_IPBytecodeHashTableEntry* findOrCreateEntry(int32_t bucket, uintptrj_t pc, bool addIt);
+    TR_IPBytecodeHashTableEntry* findOrCreateEntry(uintptrj_t pc, bool addIt);
     TR_IPBCDataAllocation* findOrCreateAllocEntry(int32_t bucket, uintptrj_t pc, bool addIt);
     uintptrj_t getProfilingData(TR_OpaqueMethodBlock* method, uint32_t byteCodeIndex, TR::Compilation*);
     uintptrj_t getProfilingData(TR::Node* node, TR::Compilation* comp);
@@ -728,7 +771,15 @@ private:
     TR_OpaqueMethodBlock* _valueProfileMethod;
 
     // bytecode hashtable
-    TR_IPBytecodeHashTableEntry** _bcHashTable;
+    // Lookups are lock free. Insertions take the stripe lock that covers the pc
+    // and claim slots with compare-and-swap, so insertions into different
+    // stripes proceed in parallel. Growing the table takes all stripe locks.
+    static const uint32_t BC_HASH_TABLE_NUM_STRIPES = 16;
+    TR_IPBCHashTable* volatile _bcHashTable;
+    TR::Monitor* _bcHashTableStripeLocks[BC_HASH_TABLE_NUM_STRIPES];
+    volatile uintptr_t _numBCHashTableEntries;
+    uint32_t _numBCHashTableGrowths;
+    bool _bcHashTableGrowthFailed;
 
 #if defined(EXPERIMENTAL_IPROFILER)
     // bytecode hashtable
@@ -744,19 +795,21 @@ private:
     bool _enableCGProfiling;
     uint32_t _globalAllocationCount;
     int32_t _maxCallFrequency;
-    j9thread_t _iprofilerOSThread;
     J9VMThread* _iprofilerThread;
+    TR_IProfilerThreadInfo _iprofilerThreads[MAX_IPROFILER_THREADS];
+    int32_t _numIProfilerThreads; // threads created by startIProfilerThread
+    int32_t _numIProfilerThreadsAlive; // threads attached and not yet exited
+    volatile bool _iprofilerThreadsStopRequested;
     TR_LinkHead0<IProfilerBuffer> _freeBufferList;
     TR_LinkHead0<IProfilerBuffer> _workingBufferList;
     IProfilerBuffer* _workingBufferTail;
-    IProfilerBuffer* _crtProfilingBuffer; // profiling buffer being processes by iprofiling thread
     TR::Monitor* _iprofilerMonitor;
     volatile int32_t _numOutstandingBuffers;
     uint64_t _numRequests;
     uint64_t _numRequestsSkipped;
     uint64_t _numRequestsHandedToIProfilerThread;
+    uint64_t _numRequestsInvalidated; // discarded from the working queue because of class unloading
     volatile uint32_t _iprofilerThreadExitFlag;
-    volatile bool _iprofilerThreadAttachAttempted;
     uint64_t _iprofilerNumRecords; // info stats only
 
     TR_IPMethodHashTableEntry** _methodHashTable;
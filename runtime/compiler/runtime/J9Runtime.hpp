@@ -222,6 +222,7 @@ typedef struct TR_AOTStats {
 
     int32_t numClassValidations;
     int32_t numClassValidationsFailed;
+    int32_t numClassValidationsMemoized;
 
     TR_FailedPerfAssumptionCode failedPerfAssumptionCode;
 
@@ -99,19 +99,35 @@ TR_RelocationRecordBinaryTemplate* TR_RelocationRecordGroup::pastLastRecord(TR_R
 int32_t TR_RelocationRecordGroup::applyRelocations(
     TR_RelocationRuntime* reloRuntime, TR_RelocationTarget* reloTarget, uint8_t* reloOrigin)
 {
-    TR_RelocationRecordBinaryTemplate* recordPointer = firstRecord(reloTarget);
     TR_RelocationRecordBinaryTemplate* endOfRecords = pastLastRecord(reloTarget);
 
-    while (recordPointer < endOfRecords) {
-        TR_RelocationRecord storage;
-        // Create a specific type of relocation record based on the information
-        // in the binary record pointed to by `recordPointer`
-        TR_RelocationRecord* reloRecord = TR_RelocationRecord::create(&storage, reloRuntime, reloTarget, recordPointer);
-        int32_t rc = handleRelocation(reloRuntime, reloTarget, reloRecord, reloOrigin);
-        if (rc != 0)
-            return rc;
+    reloRuntime->resetValidationMemo();
+
+    // Records are applied in two passes. The first pass runs the validation
+    // records that do not depend on any other record, so that a method that
+    // cannot be loaded is rejected before any of its code is patched and repeated
+    // class lookups can be served from the validation memo. Validations against
+    // an inlined call site need the site's method info, which is only filled in
+    // by the inlined method records, so they stay in the second pass with all
+    // the remaining records. The relative order of the records within each pass
+    // is preserved because symbol validation records define IDs used by later records.
+    for (int32_t pass = 0; pass < 2; pass++) {
+        bool validationPass = (pass == 0);
+        TR_RelocationRecordBinaryTemplate* recordPointer = firstRecord(reloTarget);
+        while (recordPointer < endOfRecords) {
+            TR_RelocationRecord storage;
+            // Create a specific type of relocation record based on the information
+            // in the binary record pointed to by `recordPointer`
+            TR_RelocationRecord* reloRecord
+                = TR_RelocationRecord::create(&storage, reloRuntime, reloTarget, recordPointer);
+            if (reloRecord->canApplyBeforeOtherRecords(reloTarget) == validationPass) {
+                int32_t rc = handleRelocation(reloRuntime, reloTarget, reloRecord, reloOrigin);
+                if (rc != 0)
+                    return rc;
+            }
 
-        recordPointer = reloRecord->nextBinaryRecord(reloTarget);
+            recordPointer = reloRecord->nextBinaryRecord(reloTarget);
+        }
     }
 
     return 0;
@@ -2715,6 +2731,12 @@ void TR_RelocationRecordValidateClass::preparePrivateData(
     TR_RelocationRuntime* reloRuntime, TR_RelocationTarget* reloTarget)
 {}
 
+bool TR_RelocationRecordValidateClass::canApplyBeforeOtherRecords(TR_RelocationTarget* reloTarget)
+{
+    // the constant pool of an inlined site is only known once its inlined method record has been applied
+    return inlinedSiteIndex(reloTarget) == (uintptr_t)-1;
+}
+
 bool TR_RelocationRecordValidateClass::validateClass(
     TR_RelocationRuntime* reloRuntime, TR_OpaqueClassBlock* clazz, void* classChainOrRomClass)
 {
@@ -2732,6 +2754,18 @@ int32_t TR_RelocationRecordValidateClass::applyRelocation(
 
     J9ConstantPool* cp = (J9ConstantPool*)computeNewConstantPool(reloRuntime, reloTarget, constantPool(reloTarget));
     RELO_LOG(reloRuntime->reloLogger(), 6, "\t\tapplyRelocation: cp %p\n", cp);
+
+    // The same class is often validated many times for a single method
+    uint8_t kind = _record->type(reloTarget);
+    uintptrj_t classChainOffset = classChainOffsetInSharedCache(reloTarget);
+    if (cp && reloRuntime->isValidationInMemo(kind, (uintptr_t)cp, cpIndex(reloTarget), classChainOffset)) {
+        RELO_LOG(reloRuntime->reloLogger(), 6, "\t\tapplyRelocation: validation found in memo\n");
+        TR_AOTStats* aotStats = reloRuntime->aotStats();
+        if (aotStats)
+            aotStats->numClassValidationsMemoized++;
+        return 0;
+    }
+
     TR_OpaqueClassBlock* definingClass = getClassFromCP(reloRuntime, reloTarget, (void*)cp);
     RELO_LOG(reloRuntime->reloLogger(), 6, "\t\tapplyRelocation: definingClass %p\n", definingClass);
 
@@ -2746,6 +2780,8 @@ int32_t TR_RelocationRecordValidateClass::applyRelocation(
     if (!verified) {
         RELO_LOG(reloRuntime->reloLogger(), 1, "\t\tapplyRelocation: could not verify class\n");
         returnCode = failureCode();
+    } else {
+        reloRuntime->addValidationToMemo(kind, (uintptr_t)cp, cpIndex(reloTarget), classChainOffset);
     }
 
     return returnCode;
@@ -2897,8 +2933,18 @@ int32_t TR_RelocationRecordValidateArbitraryClass::applyRelocation(
     if (aotStats)
         aotStats->numClassValidations++;
 
-    void* classChainIdentifyingLoader = reloRuntime->fej9()->sharedCache()->pointerFromOffsetInSharedCache(
-        (void*)classChainIdentifyingLoaderOffset(reloTarget));
+    uint8_t kind = _record->type(reloTarget);
+    uintptrj_t loaderOffset = classChainIdentifyingLoaderOffset(reloTarget);
+    uintptrj_t classChainOffset = classChainOffsetForClassBeingValidated(reloTarget);
+    if (reloRuntime->isValidationInMemo(kind, loaderOffset, 0, classChainOffset)) {
+        RELO_LOG(reloRuntime->reloLogger(), 6, "\t\tapplyRelocation: validation found in memo\n");
+        if (aotStats)
+            aotStats->numClassValidationsMemoized++;
+        return 0;
+    }
+
+    void* classChainIdentifyingLoader
+        = reloRuntime->fej9()->sharedCache()->pointerFromOffsetInSharedCache((void*)loaderOffset);
     RELO_LOG(reloRuntime->reloLogger(), 6, "\t\tpreparePrivateData: classChainIdentifyingLoader %p\n",
         classChainIdentifyingLoader);
 
@@ -2911,13 +2957,15 @@ int32_t TR_RelocationRecordValidateArbitraryClass::applyRelocation(
     if (classLoader) {
         uintptrj_t* classChainForClassBeingValidated
             = (uintptrj_t*)reloRuntime->fej9()->sharedCache()->pointerFromOffsetInSharedCache(
-                (void*)classChainOffsetForClassBeingValidated(reloTarget));
+                (void*)classChainOffset);
         TR_OpaqueClassBlock* clazz = reloRuntime->fej9()->sharedCache()->lookupClassFromChainAndLoader(
             classChainForClassBeingValidated, classLoader);
         RELO_LOG(reloRuntime->reloLogger(), 6, "\t\tpreparePrivateData: clazz %p\n", clazz);
 
-        if (clazz)
+        if (clazz) {
+            reloRuntime->addValidationToMemo(kind, loaderOffset, 0, classChainOffset);
             return 0;
+        }
     }
 
     if (aotStats)
@@ -487,6 +487,7 @@ public:
     virtual char* name() { return "TR_RelocationRecord"; }
 
     virtual bool isValidationRecord() { return false; }
+    virtual bool canApplyBeforeOtherRecords(TR_RelocationTarget* reloTarget) { return isValidationRecord(); }
 
     static TR_RelocationRecord* create(TR_RelocationRecord* storage, TR_RelocationRuntime* reloRuntime,
         TR_RelocationTarget* reloTarget, TR_RelocationRecordBinaryTemplate* recordPointer);
@@ -1423,6 +1424,8 @@ public:
     void setClassChainOffsetInSharedCache(TR_RelocationTarget* reloTarget, uintptrj_t classChainOffsetInSharedCache);
     uintptrj_t classChainOffsetInSharedCache(TR_RelocationTarget* reloTarget);
 
+    virtual bool isValidationRecord() { return true; }
+    virtual bool canApplyBeforeOtherRecords(TR_RelocationTarget* reloTarget);
     virtual int32_t applyRelocation(
         TR_RelocationRuntime* reloRuntime, TR_RelocationTarget* reloTarget, uint8_t* reloLocation);
     virtual void preparePrivateData(TR_RelocationRuntime* reloRuntime, TR_RelocationTarget* reloTarget);
@@ -1489,6 +1492,7 @@ public:
 
     virtual int32_t bytesInHeaderAndPayload();
 
+    virtual bool isValidationRecord() { return true; }
     virtual void preparePrivateData(TR_RelocationRuntime* reloRuntime, TR_RelocationTarget* reloTarget);
     virtual int32_t applyRelocation(
         TR_RelocationRuntime* reloRuntime, TR_RelocationTarget* reloTarget, uint8_t* reloLocation);
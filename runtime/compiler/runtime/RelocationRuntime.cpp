@@ -138,6 +138,9 @@ TR_RelocationRuntime::TR_RelocationRuntime(J9JITConfig* jitCfg)
 
     _isLoading = false;
 
+    memset(_validationMemo, 0, sizeof(_validationMemo));
+    _validationMemoEpoch = 1;
+
 #if defined(DEBUG) || defined(PROD_WITH_ASSUMES)
     _numValidations = 0;
     _numFailedValidations = 0;
@@ -675,6 +678,39 @@ TR_OpaqueClassBlock* TR_RelocationRuntime::getClassFromCP(
     return NULL;
 }
 
+void TR_RelocationRuntime::resetValidationMemo()
+{
+    // Invalidate all entries at once by moving to a new epoch
+    if (++_validationMemoEpoch == 0) {
+        memset(_validationMemo, 0, sizeof(_validationMemo));
+        _validationMemoEpoch = 1;
+    }
+}
+
+static uint32_t validationMemoIndex(uint8_t kind, uintptr_t loaderKey, uintptr_t index, uintptr_t classKey)
+{
+    uintptr_t hash = (loaderKey >> 3) ^ (classKey >> 3) ^ (index * 31) ^ kind;
+    return (uint32_t)(hash ^ (hash >> 7)) & (TR_RelocationRuntime::VALIDATION_MEMO_SIZE - 1);
+}
+
+bool TR_RelocationRuntime::isValidationInMemo(uint8_t kind, uintptr_t loaderKey, uintptr_t index, uintptr_t classKey)
+{
+    ValidationMemoEntry* entry = &_validationMemo[validationMemoIndex(kind, loaderKey, index, classKey)];
+    return entry->_epoch == _validationMemoEpoch && entry->_kind == kind && entry->_loaderKey == loaderKey
+        && entry->_index == index && entry->_classKey == classKey;
+}
+
+void TR_RelocationRuntime::addValidationToMemo(uint8_t kind, uintptr_t loaderKey, uintptr_t index, uintptr_t classKey)
+{
+    // Direct mapped; a colliding entry is simply overwritten
+    ValidationMemoEntry* entry = &_validationMemo[validationMemoIndex(kind, loaderKey, index, classKey)];
+    entry->_loaderKey = loaderKey;
+    entry->_index = index;
+    entry->_classKey = classKey;
+    entry->_kind = kind;
+    entry->_epoch = _validationMemoEpoch;
+}
+
 bool TR_RelocationRuntime::_globalValuesInitialized = false;
 
 uintptr_t TR_RelocationRuntime::_globalValueList[TR_NumGlobalValueItems] = {
@@ -213,6 +213,15 @@ public:
     void setIsLoading() { _isLoading = true; }
     void resetIsLoading() { _isLoading = false; }
 
+    // Memo of the class validations that succeeded while relocating the current method.
+    // A validation is identified by the kind of relocation record, the constant pool
+    // or class chain that determines the class loader, a cp index and the class chain
+    // (or ROM class) the resolved class is validated against
+    static const uint32_t VALIDATION_MEMO_SIZE = 64; // must be a power of two
+    void resetValidationMemo();
+    bool isValidationInMemo(uint8_t kind, uintptr_t loaderKey, uintptr_t index, uintptr_t classKey);
+    void addValidationToMemo(uint8_t kind, uintptr_t loaderKey, uintptr_t index, uintptr_t classKey);
+
     void initializeHWProfilerRecords(TR::Compilation* comp);
     void addClazzRecord(uint8_t* ia, uint32_t bcIndex, TR_OpaqueMethodBlock* method);
 
@@ -330,6 +339,16 @@ protected:
 
     bool _isLoading;
 
+    struct ValidationMemoEntry {
+        uintptr_t _loaderKey;
+        uintptr_t _index;
+        uintptr_t _classKey;
+        uint32_t _epoch; // entry is valid only if it matches _validationMemoEpoch
+        uint8_t _kind;
+    };
+    ValidationMemoEntry _validationMemo[VALIDATION_MEMO_SIZE];
+    uint32_t _validationMemoEpoch;
+
 #if 1 // defined(DEBUG) || defined(PROD_WITH_ASSUMES)
       // Detect unexpected scenarios when build has assumes
     uint32_t _numValidations;
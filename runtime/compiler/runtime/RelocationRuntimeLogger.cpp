@@ -22,6 +22,8 @@
 
 #include "runtime/RelocationRuntimeLogger.hpp"
 
+#include <stdio.h>
+#include <string.h>
 #include "jitprotos.h"
 #include "jilconsts.h"
 #include "jvminit.h"
@@ -53,6 +55,7 @@ TR_RelocationRuntimeLogger::TR_RelocationRuntimeLogger(TR_RelocationRuntime* rel
     _logLocked = false;
     _headerWasLocked = false;
     _reloStartTime = 0;
+    memset(_relocationTimeHistogram, 0, sizeof(_relocationTimeHistogram));
     setupOptions(reloRuntime->options());
     _verbose = ((jitConfig()->javaVM->verboseLevel) & VERBOSE_RELOCATIONS) != 0;
     _verbose = _logEnabled;
@@ -220,11 +223,17 @@ void TR_RelocationRuntimeLogger::relocationDump()
 
 void TR_RelocationRuntimeLogger::relocationTime()
 {
-    if (verbose()) {
-        J9JavaVM* javaVM = jitConfig()->javaVM;
-        PORT_ACCESS_FROM_JAVAVM(javaVM);
-        UDATA reloEndTime = j9time_usec_clock();
+    J9JavaVM* javaVM = jitConfig()->javaVM;
+    PORT_ACCESS_FROM_JAVAVM(javaVM);
+    UDATA reloEndTime = j9time_usec_clock();
+
+    UDATA reloTime = reloEndTime - _reloStartTime;
+    int32_t bucket = 0;
+    while (bucket < RELOCATION_TIME_HISTOGRAM_SIZE - 1 && reloTime >= ((UDATA)1 << bucket))
+        bucket++;
+    _relocationTimeHistogram[bucket]++;
 
+    if (verbose()) {
         bool wasLocked = lockLog();
         method(false);
         JITRT_PRINTF(jitConfig())
@@ -234,6 +243,17 @@ void TR_RelocationRuntimeLogger::relocationTime()
     }
 }
 
+void TR_RelocationRuntimeLogger::printRelocationTimeHistogram(const uint32_t* histogram)
+{
+    fprintf(stderr, "Relocation time histogram (usec):\n");
+    for (int32_t i = 0; i < RELOCATION_TIME_HISTOGRAM_SIZE; i++) {
+        if (i < RELOCATION_TIME_HISTOGRAM_SIZE - 1)
+            fprintf(stderr, "   < %6u: %u\n", 1U << i, histogram[i]);
+        else
+            fprintf(stderr, "  >= %6u: %u\n", 1U << (i - 1), histogram[i]);
+    }
+}
+
 void TR_RelocationRuntimeLogger::versionMismatchWarning()
 {
     char* warningMessageFormat = "AOT major/minor versions don't match the ones of running JVM: aotMajorVersion %d "
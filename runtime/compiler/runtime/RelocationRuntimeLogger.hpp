@@ -66,6 +66,12 @@ public:
     void versionMismatchWarning();
     void maxCodeOrDataSizeWarning();
 
+    // Relocation time of every loaded method is counted in bucket i if it took less than 2^i usec;
+    // the last bucket counts all the slower ones
+    static const int32_t RELOCATION_TIME_HISTOGRAM_SIZE = 16;
+    const uint32_t* relocationTimeHistogram() const { return _relocationTimeHistogram; }
+    static void printRelocationTimeHistogram(const uint32_t* histogram);
+
 private:
     void startTag(const char* tag);
     void endTag(const char* tag);
@@ -84,6 +90,7 @@ private:
     bool _verbose;
 
     UDATA _reloStartTime;
+    uint32_t _relocationTimeHistogram[RELOCATION_TIME_HISTOGRAM_SIZE];
 };
 
 #endif // RELOCATION_RUNTIME_LOGGER_INCL
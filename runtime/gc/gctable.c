@@ -30,9 +30,9 @@ J9MemoryManagerFunctions MemoryManagerFunctions = { J9AllocateIndexableObject, J
     j9gc_heap_free_memory, j9gc_heap_total_memory, j9gc_is_garbagecollection_disabled, j9gc_allsupported_memorypools,
     j9gc_allsupported_garbagecollectors, j9gc_pool_name, j9gc_garbagecollector_name, j9gc_is_managedpool_by_collector,
     j9gc_is_usagethreshold_supported, j9gc_is_collectionusagethreshold_supported, j9gc_is_local_collector,
-    j9gc_get_collector_id, j9gc_pools_memory, j9gc_pool_maxmemory, j9gc_get_gc_action, j9gc_get_gc_cause,
-    j9gc_get_private_hook_interface, gcStartupHeapManagement, gcShutdownHeapManagement, initializeMutatorModelJava,
-    cleanupMutatorModelJava,
+    j9gc_get_collector_id, j9gc_pools_memory, j9gc_pool_maxmemory, j9gc_pool_released_memory, j9gc_get_gc_action,
+    j9gc_get_gc_cause, j9gc_get_private_hook_interface, gcStartupHeapManagement, gcShutdownHeapManagement,
+    initializeMutatorModelJava, cleanupMutatorModelJava,
 #if defined(J9VM_GC_FINALIZATION)
     j9gc_finalizer_startup, j9gc_finalizer_shutdown, j9gc_wait_for_reference_processing, runFinalization,
 #endif /* J9VM_GC_FINALIZATION */
@@ -36,6 +36,7 @@
 #include "MemorySubSpace.hpp"
 #include "ObjectModel.hpp"
 #include "ReferenceChainWalkerMarkMap.hpp"
+#include "StringDeduplicator.hpp"
 #include "SublistPool.hpp"
 #include "Wildcard.hpp"
 
@@ -180,6 +181,11 @@ void MM_GCExtensions::tearDown(MM_EnvironmentBase* env)
     }
     numaCommonThreadClassNamePatterns = NULL;
 
+    if (NULL != stringDeduplicator) {
+        stringDeduplicator->kill(env);
+        stringDeduplicator = NULL;
+    }
+
     J9HookInterface** tmpHookInterface = getHookInterface();
     if ((NULL != tmpHookInterface) && (NULL != *tmpHookInterface)) {
         (*tmpHookInterface)->J9HookShutdownInterface(tmpHookInterface);
@@ -57,6 +57,7 @@ class MM_HeapMap;
 class MM_MemorySubSpace;
 class MM_ObjectAccessBarrier;
 class MM_OwnableSynchronizerObjectList;
+class MM_StringDeduplicator;
 class MM_StringTable;
 class MM_UnfinalizedObjectList;
 class MM_Wildcard;
@@ -81,6 +82,7 @@ class MM_GCExtensions : public MM_GCExtensionsBase {
 public:
     MM_StringTable*
         stringTable; /**< top level String Table structure (internally organized as a set of hash sub-tables */
+    MM_StringDeduplicator* stringDeduplicator; /**< queue of Strings to deduplicate (NULL if deduplication is off) */
 
     void* gcchkExtensions;
 
@@ -124,6 +126,11 @@ public:
 
     U_32 _stringTableListToTreeThreshold; /**< Threshold at which we start using trees instead of lists for collision
                                              resolution in the String table */
+    UDATA stringTableIndexBuckets; /**< Number of buckets in the lock-free index of the String table (0 for none) */
+    bool stringDeduplication; /**< Should the GC share the value arrays of long lived Strings with equal contents */
+    UDATA stringDeduplicationAge; /**< Region age at which balanced copy-forward queues a String for deduplication */
+    UDATA stringDeduplicationMaxCandidates; /**< Maximum number of Strings queued for deduplication by one GC */
+    UDATA stringDeduplicationBuckets; /**< Number of buckets in the table of canonical String value arrays */
 
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
     bool fvtest_forceFinalizeClassLoaders;
@@ -192,6 +199,9 @@ public:
 
     bool _HeapManagementMXBeanBackCompatibilityEnabled;
 
+    bool doAllocationSiteSampling; /**< Should sampled out-of-line allocations be attributed to their allocation site */
+    UDATA allocationSiteSamplingDepth; /**< Number of Java frames which identify an allocation site */
+
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
     MM_IdleGCManager* idleGCManager; /**< Manager which registers for VM Runtime State notification & manages free heap
                                         on notification */
@@ -200,6 +210,22 @@ public:
     double maxRAMPercent; /**< Value of -XX:MaxRAMPercentage specified by the user */
     double initialRAMPercent; /**< Value of -XX:InitialRAMPercentage specified by the user */
 
+#if defined(J9VM_GC_VLHGC)
+    UDATA tarokTargetMaxPauseTime; /**< Partial GC pause target in milliseconds, or 0 to size Eden for throughput */
+    bool tarokEnableConcurrentRefinement; /**< Should the master GC thread refine dirty cards into RSCLs between PGCs */
+    UDATA tarokConcurrentRefinementPausePercent; /**< Percentage of the PGC pause which dirty card cleaning may use
+                                                    before the concurrent refinement starts draining the backlog */
+    UDATA tarokCopyForwardPrefetchWindow; /**< Number of slots copy-forward gathers and prefetches before copying them,
+                                             or 0 to copy each slot as it is visited */
+    UDATA tarokIncrementalCompactIncrements; /**< Number of PGC increments over which the compaction work found for a
+                                                PGC is spread (1 does all of it in the PGC which found it) */
+    bool tarokReleaseColdFreeRegions; /**< Should pages of regions which stay free across GCs be returned to the OS */
+    UDATA tarokFreeRegionColdCycles; /**< Number of GCs a region must stay free for before its pages are released */
+    UDATA tarokFreeRegionReleaseMaxBytes; /**< Most bytes released at the end of one GC (an idle GC is not limited) */
+    bool tarokReleaseFreeRegionsLazily; /**< Release pages with MADV_FREE, where available, rather than MADV_DONTNEED */
+    UDATA heapResidentSavingsBytes; /**< Bytes of free regions whose pages are released, as of the end of the last GC */
+#endif /* J9VM_GC_VLHGC */
+
 protected:
 private:
 protected:
@@ -286,6 +312,7 @@ public:
     MM_GCExtensions()
         : MM_GCExtensionsBase()
         , stringTable(NULL)
+        , stringDeduplicator(NULL)
         , gcchkExtensions(NULL)
         , tgcExtensions(NULL)
 #if defined(J9VM_GC_FINALIZATION)
@@ -301,6 +328,11 @@ public:
         , classUnloadingAnonymousClassWeight(1.0)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
         , _stringTableListToTreeThreshold(1024)
+        , stringTableIndexBuckets(1024)
+        , stringDeduplication(false)
+        , stringDeduplicationAge(3)
+        , stringDeduplicationMaxCandidates(64 * 1024)
+        , stringDeduplicationBuckets(4096)
         , maxSoftReferenceAge(32)
 #if defined(J9VM_GC_FINALIZATION)
         , finalizeMasterPriority(J9THREAD_PRIORITY_NORMAL)
@@ -317,11 +349,25 @@ public:
         , _asyncCallbackKey(-1)
         , _TLHAsyncCallbackKey(-1)
         , _HeapManagementMXBeanBackCompatibilityEnabled(false)
+        , doAllocationSiteSampling(false)
+        , allocationSiteSamplingDepth(4)
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
         , idleGCManager(NULL)
 #endif
         , maxRAMPercent(0.0) /* this would get overwritten by user specified value */
         , initialRAMPercent(0.0) /* this would get overwritten by user specified value */
+#if defined(J9VM_GC_VLHGC)
+        , tarokTargetMaxPauseTime(0)
+        , tarokEnableConcurrentRefinement(false)
+        , tarokConcurrentRefinementPausePercent(10)
+        , tarokCopyForwardPrefetchWindow(0)
+        , tarokIncrementalCompactIncrements(1)
+        , tarokReleaseColdFreeRegions(false)
+        , tarokFreeRegionColdCycles(3)
+        , tarokFreeRegionReleaseMaxBytes(64 * 1024 * 1024)
+        , tarokReleaseFreeRegionsLazily(false)
+        , heapResidentSavingsBytes(0)
+#endif /* J9VM_GC_VLHGC */
     {
         _typeId = __FUNCTION__;
     }
@@ -588,9 +588,49 @@ void MM_RootScanner::scanStringTable(MM_EnvironmentBase* env)
         }
     }
 
+    /* the lock-free index is weak like the cache */
+    j9object_t* stringIndexTable = stringTable->getStringInternIndex();
+    if (NULL != stringIndexTable) {
+        scanStringCacheSlots(
+            env, stringIndexTable, stringTable->getStringInternIndexSize(), stringTable->getTableCount());
+    }
+
     reportScanningEnded(RootScannerEntity_StringTable);
 }
 
+/**
+ * Scan the canonical String value arrays of the deduplication table. They are always weak, even when the
+ * string table is a hard root, so that a canonical array no String refers to any more can be collected.
+ */
+void MM_RootScanner::scanStringDeduplicationTable(MM_EnvironmentBase* env)
+{
+    MM_StringTable* stringTable = _extensions->getStringTable();
+    j9object_t* valueDeduplicationTable = stringTable->getValueDeduplicationTable();
+
+    if (NULL != valueDeduplicationTable) {
+        reportScanningStarted(RootScannerEntity_StringTable);
+        scanStringCacheSlots(
+            env, valueDeduplicationTable, stringTable->getValueDeduplicationTableSize(), stringTable->getTableCount());
+        reportScanningEnded(RootScannerEntity_StringTable);
+    }
+}
+
+void MM_RootScanner::scanStringCacheSlots(
+    MM_EnvironmentBase* env, j9object_t* slots, UDATA slotCount, UDATA chunkCount)
+{
+    UDATA chunkSize = OMR_MAX(slotCount / chunkCount, (UDATA)1024);
+    for (UDATA chunkStart = 0; chunkStart < slotCount; chunkStart += chunkSize) {
+        if (_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+            UDATA chunkEnd = OMR_MIN(chunkStart + chunkSize, slotCount);
+            for (UDATA slot = chunkStart; slot < chunkEnd; slot++) {
+                if (NULL != slots[slot]) {
+                    doStringCacheTableSlot(&slots[slot]);
+                }
+            }
+        }
+    }
+}
+
 /**
  * Scan the weak reference list.
  * @note Extra locking for NHRTs can be omitted, because it is impossible for
@@ -896,6 +936,9 @@ void MM_RootScanner::scanClearable(MM_EnvironmentBase* env)
     if (!_stringTableAsRoot && (!_nurseryReferencesOnly && !_nurseryReferencesPossibly)) {
         scanStringTable(env);
     }
+    if (!_nurseryReferencesOnly && !_nurseryReferencesPossibly) {
+        scanStringDeduplicationTable(env);
+    }
 
     scanOwnableSynchronizerObjects(env);
 
@@ -938,6 +981,7 @@ void MM_RootScanner::scanAllSlots(MM_EnvironmentBase* env)
 
     if (!_nurseryReferencesOnly && !_nurseryReferencesPossibly) {
         scanStringTable(env);
+        scanStringDeduplicationTable(env);
     }
 
     scanWeakReferenceObjects(env);
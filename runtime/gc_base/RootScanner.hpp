@@ -126,6 +126,15 @@ private:
     void scanArrayObject(MM_EnvironmentBase* env, J9Object* objectPtr, MM_MemoryPool* memoryPool,
         MM_HeapRegionManager* manager, UDATA memoryType);
 
+    /**
+     * Scan the non-NULL slots of a weak array of the string table (such as its lock-free index) with
+     * doStringCacheTableSlot, in chunks so that the scan can be shared by the GC threads.
+     * @param slots the array to scan
+     * @param slotCount number of slots in the array
+     * @param chunkCount number of chunks to aim for
+     */
+    void scanStringCacheSlots(MM_EnvironmentBase* env, j9object_t* slots, UDATA slotCount, UDATA chunkCount);
+
 protected:
     /**
      * Determine whether running method classes in stack frames should be walked.
@@ -419,6 +428,7 @@ public:
      */
     virtual void scanOwnableSynchronizerObjects(MM_EnvironmentBase* env);
     virtual void scanStringTable(MM_EnvironmentBase* env);
+    void scanStringDeduplicationTable(MM_EnvironmentBase* env);
     void scanJNIGlobalReferences(MM_EnvironmentBase* env);
     virtual void scanJNIWeakGlobalReferences(MM_EnvironmentBase* env);
 
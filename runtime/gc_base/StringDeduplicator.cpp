@@ -0,0 +1,204 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9consts.h"
+
+#include "StringDeduplicator.hpp"
+
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+#include "ParallelTask.hpp"
+#include "StringTable.hpp"
+
+/* number of candidates hashed per work unit */
+#define STRING_DEDUPLICATION_HASH_CHUNK 256
+
+/**
+ * Runs the deduplication of the queued Strings on the GC threads.
+ */
+class MM_StringDeduplicationTask : public MM_ParallelTask {
+private:
+    MM_StringDeduplicator* _stringDeduplicator;
+
+public:
+    virtual UDATA getVMStateID() { return OMRVMSTATE_GC_SCAVENGE; }
+
+    virtual void run(MM_EnvironmentBase* env)
+    {
+        _stringDeduplicator->hashCandidates(env);
+        /* every hash must be known before the buckets are shared out */
+        synchronizeGCThreads(env, UNIQUE_ID);
+        _stringDeduplicator->shareValues(env);
+    }
+
+    MM_StringDeduplicationTask(
+        MM_EnvironmentBase* env, MM_Dispatcher* dispatcher, MM_StringDeduplicator* stringDeduplicator)
+        : MM_ParallelTask(env, dispatcher)
+        , _stringDeduplicator(stringDeduplicator)
+    {
+        _typeId = __FUNCTION__;
+    }
+};
+
+MM_StringDeduplicator* MM_StringDeduplicator::newInstance(MM_EnvironmentBase* env)
+{
+    MM_StringDeduplicator* stringDeduplicator = (MM_StringDeduplicator*)env->getForge()->allocate(
+        sizeof(MM_StringDeduplicator), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+    if (NULL != stringDeduplicator) {
+        MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(env);
+        new (stringDeduplicator) MM_StringDeduplicator(env, extensions->getJavaVM(), extensions);
+        if (!stringDeduplicator->initialize(env)) {
+            stringDeduplicator->kill(env);
+            stringDeduplicator = NULL;
+        }
+    }
+    return stringDeduplicator;
+}
+
+void MM_StringDeduplicator::kill(MM_EnvironmentBase* env)
+{
+    tearDown(env);
+    env->getForge()->free(this);
+}
+
+bool MM_StringDeduplicator::initialize(MM_EnvironmentBase* env)
+{
+    _candidateCapacity = _extensions->stringDeduplicationMaxCandidates;
+    if (0 != _candidateCapacity) {
+        _candidates = (j9object_t*)env->getForge()->allocate(
+            sizeof(j9object_t) * _candidateCapacity, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+        if (NULL == _candidates) {
+            return false;
+        }
+        _candidateHashes = (UDATA*)env->getForge()->allocate(
+            sizeof(UDATA) * _candidateCapacity, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+        if (NULL == _candidateHashes) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void MM_StringDeduplicator::tearDown(MM_EnvironmentBase* env)
+{
+    if (NULL != _candidates) {
+        env->getForge()->free(_candidates);
+        _candidates = NULL;
+    }
+    if (NULL != _candidateHashes) {
+        env->getForge()->free(_candidateHashes);
+        _candidateHashes = NULL;
+    }
+    _candidateCapacity = 0;
+}
+
+UDATA MM_StringDeduplicator::hashValue(j9object_t value)
+{
+    GC_ArrayObjectModel* indexableObjectModel = &_extensions->indexableObjectModel;
+    U_8* data = (U_8*)indexableObjectModel->getDataPointerForContiguous((J9IndexableObject*)value);
+    UDATA dataSize = indexableObjectModel->getDataSizeInBytes((J9IndexableObject*)value);
+
+    /* FNV-1a over the contents, seeded with the class so byte[] and char[] values of equal bytes rarely collide */
+    U_32 hash = 2166136261U ^ (U_32)((UDATA)J9GC_J9OBJECT_CLAZZ(value) >> 3);
+    for (UDATA i = 0; i < dataSize; i++) {
+        hash = (hash ^ data[i]) * 16777619U;
+    }
+    return (UDATA)hash;
+}
+
+j9object_t MM_StringDeduplicator::shareableValue(J9VMThread* vmThread, j9object_t string)
+{
+    j9object_t value = J9VMJAVALANGSTRING_VALUE(vmThread, string);
+    /* only contiguous arrays are compared, and the scavenger does not update the deduplication table, so a
+     * generational collector only shares tenured arrays */
+    if ((NULL != value) && _extensions->indexableObjectModel.isInlineContiguousArraylet((J9IndexableObject*)value)
+        && (!_extensions->scavengerEnabled || _extensions->isOld(value))) {
+        return value;
+    }
+    return NULL;
+}
+
+void MM_StringDeduplicator::deduplicate(MM_EnvironmentBase* env)
+{
+    _lastDeduplicated = 0;
+    _lastBytesSaved = 0;
+    if (0 != OMR_MIN(_candidateCount, _candidateCapacity)) {
+        MM_StringDeduplicationTask deduplicationTask(env, _extensions->dispatcher, this);
+        _extensions->dispatcher->run(env, &deduplicationTask);
+    }
+
+    _lastCandidates = _candidateCount;
+    _totalBytesSaved += _lastBytesSaved;
+    _candidateCount = 0;
+}
+
+void MM_StringDeduplicator::hashCandidates(MM_EnvironmentBase* env)
+{
+    J9VMThread* vmThread = (J9VMThread*)env->getLanguageVMThread();
+    UDATA candidateCount = OMR_MIN(_candidateCount, _candidateCapacity);
+
+    for (UDATA chunkStart = 0; chunkStart < candidateCount; chunkStart += STRING_DEDUPLICATION_HASH_CHUNK) {
+        if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+            UDATA chunkEnd = OMR_MIN(chunkStart + STRING_DEDUPLICATION_HASH_CHUNK, candidateCount);
+            for (UDATA i = chunkStart; i < chunkEnd; i++) {
+                j9object_t value = shareableValue(vmThread, _candidates[i]);
+                _candidateHashes[i] = (NULL != value) ? hashValue(value) : 0;
+            }
+        }
+    }
+}
+
+void MM_StringDeduplicator::shareValues(MM_EnvironmentBase* env)
+{
+    J9VMThread* vmThread = (J9VMThread*)env->getLanguageVMThread();
+    MM_StringTable* stringTable = _extensions->getStringTable();
+    GC_ArrayObjectModel* indexableObjectModel = &_extensions->indexableObjectModel;
+    UDATA candidateCount = OMR_MIN(_candidateCount, _candidateCapacity);
+    UDATA threadCount = env->_currentTask->getThreadCount();
+    UDATA threadIndex = env->getSlaveID();
+    UDATA deduplicated = 0;
+    UDATA bytesSaved = 0;
+
+    for (UDATA i = 0; i < candidateCount; i++) {
+        /* a String owned by another thread may be updated concurrently, so ownership is decided by hash only */
+        if (threadIndex != (stringTable->getValueDeduplicationBucket(_candidateHashes[i]) % threadCount)) {
+            continue;
+        }
+        j9object_t string = _candidates[i];
+        j9object_t value = shareableValue(vmThread, string);
+        if (NULL != value) {
+            j9object_t canonical = stringTable->deduplicateValue(env, value, _candidateHashes[i]);
+            if (canonical != value) {
+                /* the store goes through the write barrier so remembered sets and concurrent marking see it */
+                J9VMJAVALANGSTRING_SET_VALUE(vmThread, string, canonical);
+                deduplicated += 1;
+                bytesSaved += indexableObjectModel->getSizeInBytesWithHeader((J9IndexableObject*)value);
+            }
+        }
+    }
+
+    MM_AtomicOperations::add(&_lastDeduplicated, deduplicated);
+    MM_AtomicOperations::add(&_lastBytesSaved, bytesSaved);
+}
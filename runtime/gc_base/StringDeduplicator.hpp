@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(STRINGDEDUPLICATOR_HPP_)
+#define STRINGDEDUPLICATOR_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9consts.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensions;
+
+/**
+ * Queue of long lived Strings whose value arrays may be shared with other Strings of equal contents.
+ * Copying collectors offer Strings as they reach the deduplication age; once every survivor has its final address,
+ * the GC threads point the value of each queued String at the canonical array recorded in the String table,
+ * leaving the duplicate array to be reclaimed by a later collection.
+ */
+class MM_StringDeduplicator : public MM_BaseVirtual {
+private:
+    J9JavaVM* _javaVM;
+    MM_GCExtensions* _extensions;
+    j9object_t* _candidates; /**< Strings queued by the current GC */
+    UDATA* _candidateHashes; /**< hash of the value of each queued String, set by hashCandidates() */
+    UDATA _candidateCapacity; /**< number of slots in _candidates */
+    volatile UDATA _candidateCount; /**< number of Strings offered in the current GC (may exceed the capacity) */
+
+    UDATA _lastCandidates; /**< number of Strings offered in the last deduplication */
+    volatile UDATA _lastDeduplicated; /**< number of Strings given a canonical value array in the last deduplication */
+    volatile UDATA _lastBytesSaved; /**< size of the value arrays the last deduplication left unreferenced */
+    UDATA _totalBytesSaved; /**< size of the value arrays left unreferenced since startup */
+
+public:
+private:
+    bool initialize(MM_EnvironmentBase* env);
+    void tearDown(MM_EnvironmentBase* env);
+
+    /**
+     * @return a hash of the class and contents of a contiguous value array
+     */
+    UDATA hashValue(j9object_t value);
+
+    /**
+     * @return the value array of a queued String if it may be shared, NULL otherwise
+     */
+    j9object_t shareableValue(J9VMThread* vmThread, j9object_t string);
+
+public:
+    static MM_StringDeduplicator* newInstance(MM_EnvironmentBase* env);
+    virtual void kill(MM_EnvironmentBase* env);
+
+    /**
+     * @return true if objects of the class are deduplication candidates
+     */
+    MMINLINE bool isCandidateClass(J9Class* clazz) { return clazz == J9VMJAVALANGSTRING_OR_NULL(_javaVM); }
+
+    /**
+     * Queue a String for deduplication at the end of the current GC; Strings which do not fit are ignored.
+     * May be called by any GC thread.
+     * @param string the String, at the address it will have at the end of the GC
+     */
+    MMINLINE void addCandidate(j9object_t string)
+    {
+        UDATA index = MM_AtomicOperations::add(&_candidateCount, 1) - 1;
+        if (index < _candidateCapacity) {
+            _candidates[index] = string;
+        }
+    }
+
+    /**
+     * Forget the queued Strings, because the GC which queued them did not complete.
+     */
+    void discardCandidates()
+    {
+        _candidateCount = 0;
+        _lastCandidates = 0;
+        _lastDeduplicated = 0;
+        _lastBytesSaved = 0;
+    }
+
+    /**
+     * Give each queued String the canonical array for its value, then empty the queue. The work is shared by the
+     * GC threads, see hashCandidates() and shareValues().
+     * Must be called by the master GC thread while it has exclusive access, after the weak roots have been processed.
+     * @param env the master GC thread
+     */
+    void deduplicate(MM_EnvironmentBase* env);
+
+    /**
+     * Hash the shareable value arrays of the queued Strings, in chunks shared by the GC threads of the current task.
+     * @param env a GC thread running the deduplication task
+     */
+    void hashCandidates(MM_EnvironmentBase* env);
+
+    /**
+     * Give the queued Strings whose values hash to the deduplication table buckets owned by this GC thread the
+     * canonical array for their value. Each GC thread of the current task owns a disjoint set of buckets, so the
+     * table is updated without locks. Must be called once every candidate has been hashed.
+     * @param env a GC thread running the deduplication task
+     */
+    void shareValues(MM_EnvironmentBase* env);
+
+    UDATA getLastCandidates() { return _lastCandidates; }
+    UDATA getLastDeduplicated() { return _lastDeduplicated; }
+    UDATA getLastBytesSaved() { return _lastBytesSaved; }
+    UDATA getTotalBytesSaved() { return _totalBytesSaved; }
+
+    MM_StringDeduplicator(MM_EnvironmentBase* env, J9JavaVM* javaVM, MM_GCExtensions* extensions)
+        : MM_BaseVirtual()
+        , _javaVM(javaVM)
+        , _extensions(extensions)
+        , _candidates(NULL)
+        , _candidateHashes(NULL)
+        , _candidateCapacity(0)
+        , _candidateCount(0)
+        , _lastCandidates(0)
+        , _lastDeduplicated(0)
+        , _lastBytesSaved(0)
+        , _totalBytesSaved(0)
+    {
+        _typeId = __FUNCTION__;
+    }
+};
+
+#endif /* STRINGDEDUPLICATOR_HPP_ */
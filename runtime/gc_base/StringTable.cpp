@@ -27,6 +27,7 @@
 #include "objhelp.h"
 #include "ModronAssertions.h"
 
+#include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "ScavengerForwardedHeader.hpp"
@@ -98,6 +99,35 @@ bool MM_StringTable::initialize(MM_EnvironmentBase* env)
 
     memset(_cache, 0, sizeof(_cache));
 
+    /* metronome can find dead strings in the tables, so it only uses the cache, which checks liveness on a hit */
+    UDATA indexBuckets = MM_GCExtensions::getExtensions(env)->stringTableIndexBuckets;
+    if ((0 != indexBuckets) && !MM_GCExtensions::getExtensions(env)->isMetronomeGC()) {
+        _indexBucketCount = 1;
+        while (_indexBucketCount < indexBuckets) {
+            _indexBucketCount <<= 1;
+        }
+        UDATA indexBytes = sizeof(j9object_t) * getStringInternIndexSize();
+        _index = (j9object_t*)j9mem_allocate_memory(indexBytes, OMRMEM_CATEGORY_MM);
+        if (NULL == _index) {
+            return false;
+        }
+        memset(_index, 0, indexBytes);
+    }
+
+    if (MM_GCExtensions::getExtensions(env)->stringDeduplication) {
+        UDATA dedupBuckets = MM_GCExtensions::getExtensions(env)->stringDeduplicationBuckets;
+        _dedupBucketCount = 1;
+        while (_dedupBucketCount < dedupBuckets) {
+            _dedupBucketCount <<= 1;
+        }
+        UDATA dedupBytes = sizeof(j9object_t) * getValueDeduplicationTableSize();
+        _dedupTable = (j9object_t*)j9mem_allocate_memory(dedupBytes, OMRMEM_CATEGORY_MM);
+        if (NULL == _dedupTable) {
+            return false;
+        }
+        memset(_dedupTable, 0, dedupBytes);
+    }
+
     return true;
 }
 
@@ -126,6 +156,18 @@ void MM_StringTable::tearDown(MM_EnvironmentBase* env)
         j9mem_free_memory(_mutex);
         _mutex = NULL;
     }
+
+    if (NULL != _index) {
+        j9mem_free_memory(_index);
+        _index = NULL;
+        _indexBucketCount = 0;
+    }
+
+    if (NULL != _dedupTable) {
+        j9mem_free_memory(_dedupTable);
+        _dedupTable = NULL;
+        _dedupBucketCount = 0;
+    }
 }
 
 void MM_StringTable::kill(MM_EnvironmentBase* env)
@@ -166,6 +208,31 @@ j9object_t MM_StringTable::hashAtUTF8(UDATA tableIndex, U_8* utf8Data, UDATA utf
     return hashAt(tableIndex, (j9object_t)ptr);
 }
 
+j9object_t MM_StringTable::findUTF8(J9JavaVM* javaVM, U_8* utf8Data, UDATA utf8Length, U_32 hash)
+{
+    stringTableUTF8Query query;
+    void* ptr;
+
+    query.utf8Data = utf8Data;
+    query.utf8Length = utf8Length;
+    query.hash = hash;
+    ptr = (void*)((UDATA)&query | TYPE_UTF8);
+
+    j9object_t result = indexAt(javaVM, hash, &ptr);
+    if (NULL == result) {
+        UDATA tableIndex = getTableIndex(hash);
+
+        lockTable(tableIndex);
+        result = hashAt(tableIndex, (j9object_t)ptr);
+        unlockTable(tableIndex);
+
+        if (NULL != result) {
+            indexAtPut(hash, result);
+        }
+    }
+    return result;
+}
+
 j9object_t MM_StringTable::hashAtPut(UDATA tableIndex, j9object_t string)
 {
     if (NULL == hashTableAdd(_table[tableIndex], &string)) {
@@ -176,6 +243,84 @@ j9object_t MM_StringTable::hashAtPut(UDATA tableIndex, j9object_t string)
     }
 }
 
+j9object_t MM_StringTable::indexAt(J9JavaVM* javaVM, UDATA hash, void* key)
+{
+    if (0 != _indexBucketCount) {
+        j9object_t* bucket = &_index[(hash & (_indexBucketCount - 1)) * indexBucketSlots];
+        for (UDATA slot = 0; slot < indexBucketSlots; slot++) {
+            j9object_t candidate = bucket[slot];
+            if (NULL != candidate) {
+                /* interned strings have their hash code set, so most mismatches are rejected without comparing */
+                U_32 candidateHash = J9VMJAVALANGSTRING_HASHCODE_VM(javaVM, candidate);
+                if (((0 == candidateHash) || ((U_32)hash == candidateHash))
+                    && stringHashEqualFn(&candidate, key, javaVM)) {
+                    return candidate;
+                }
+            }
+        }
+    }
+    return NULL;
+}
+
+void MM_StringTable::indexAtPut(UDATA hash, j9object_t string)
+{
+    if (0 != _indexBucketCount) {
+        j9object_t* bucket = &_index[(hash & (_indexBucketCount - 1)) * indexBucketSlots];
+        for (UDATA slot = 0; slot < indexBucketSlots; slot++) {
+            j9object_t candidate = bucket[slot];
+            if (string == candidate) {
+                return;
+            }
+            if ((NULL == candidate)
+                && (0
+                    == MM_AtomicOperations::lockCompareExchange(
+                        (volatile UDATA*)&bucket[slot], (UDATA)NULL, (UDATA)string))) {
+                return;
+            }
+        }
+        /* the bucket is full; evict the string in a slot picked by the hash bits above the bucket index, so strings
+         * sharing a bucket do not keep evicting each other */
+        bucket[(hash / _indexBucketCount) % indexBucketSlots] = string;
+    }
+}
+
+j9object_t MM_StringTable::deduplicateValue(MM_EnvironmentBase* env, j9object_t value, UDATA hash)
+{
+    if (0 != _dedupBucketCount) {
+        GC_ArrayObjectModel* indexableObjectModel = &MM_GCExtensions::getExtensions(env)->indexableObjectModel;
+        J9Class* valueClass = J9GC_J9OBJECT_CLAZZ(value);
+        UDATA valueBytes = indexableObjectModel->getDataSizeInBytes((J9IndexableObject*)value);
+        void* valueData = indexableObjectModel->getDataPointerForContiguous((J9IndexableObject*)value);
+        j9object_t* bucket = &_dedupTable[getValueDeduplicationBucket(hash) * indexBucketSlots];
+        j9object_t* freeSlot = NULL;
+
+        for (UDATA slot = 0; slot < indexBucketSlots; slot++) {
+            j9object_t candidate = bucket[slot];
+            if (NULL == candidate) {
+                if (NULL == freeSlot) {
+                    freeSlot = &bucket[slot];
+                }
+            } else if (value == candidate) {
+                return value;
+            } else if ((valueClass == J9GC_J9OBJECT_CLAZZ(candidate))
+                && (valueBytes == indexableObjectModel->getDataSizeInBytes((J9IndexableObject*)candidate))
+                && (0
+                    == memcmp(valueData,
+                        indexableObjectModel->getDataPointerForContiguous((J9IndexableObject*)candidate),
+                        valueBytes))) {
+                return candidate;
+            }
+        }
+
+        /* value becomes canonical; in a full bucket it replaces an entry picked as the index does */
+        if (NULL == freeSlot) {
+            freeSlot = &bucket[(hash / _dedupBucketCount) % indexBucketSlots];
+        }
+        *freeSlot = value;
+    }
+    return value;
+}
+
 j9object_t MM_StringTable::addStringToInternTable(J9VMThread* vmThread, j9object_t string)
 {
     j9object_t internedString;
@@ -195,6 +340,8 @@ j9object_t MM_StringTable::addStringToInternTable(J9VMThread* vmThread, j9object
 
     if (NULL == internedString) {
         Trc_MM_StringTable_stringAddToInternTableFailed(vmThread, string, _table, tableIndex);
+    } else {
+        indexAtPut(hash, internedString);
     }
 
     return internedString;
@@ -551,11 +698,7 @@ j9object_t j9gc_createJavaLangString(J9VMThread* vmThread, U_8* data, UDATA leng
 
     if ((stringFlags & (J9_STR_XLAT | J9_STR_UNICODE)) == 0) {
         U_32 hash = (U_32)vm->internalVMFunctions->computeHashForUTF8(data, length);
-        UDATA tableIndex = stringTable->getTableIndex(hash);
-
-        stringTable->lockTable(tableIndex);
-        result = stringTable->hashAtUTF8(tableIndex, data, length, hash);
-        stringTable->unlockTable(tableIndex);
+        result = stringTable->findUTF8(vm, data, length, hash);
     }
 
     if (NULL == result) {
@@ -808,11 +951,18 @@ j9object_t j9gc_internString(J9VMThread* vmThread, j9object_t sourceString)
         }
     }
 
-    UDATA tableIndex = stringTable->getTableIndex(hash);
+    internedString = stringTable->indexAt(vm, hash, &sourceString);
+    if (NULL == internedString) {
+        UDATA tableIndex = stringTable->getTableIndex(hash);
+
+        stringTable->lockTable(tableIndex);
+        internedString = stringTable->hashAt(tableIndex, sourceString);
+        stringTable->unlockTable(tableIndex);
 
-    stringTable->lockTable(tableIndex);
-    internedString = stringTable->hashAt(tableIndex, sourceString);
-    stringTable->unlockTable(tableIndex);
+        if (NULL != internedString) {
+            stringTable->indexAtPut(hash, internedString);
+        }
+    }
 
     if (NULL == internedString) {
         j9object_t newString = NULL;
@@ -852,14 +1002,11 @@ j9object_t j9gc_allocStringWithSharedCharData(J9VMThread* vmThread, U_8* data, U
     bool isCompressable = false;
 
     U_32 hash = (U_32)vm->internalVMFunctions->computeHashForUTF8(data, length);
-    UDATA tableIndex = stringTable->getTableIndex(hash);
 
     /* see if the string is already in the table. Race condition where another thread may add the string
      * before this one is not fatal and is ignored.
      */
-    stringTable->lockTable(tableIndex);
-    internedString = stringTable->hashAtUTF8(tableIndex, data, length, hash);
-    stringTable->unlockTable(tableIndex);
+    internedString = stringTable->findUTF8(vm, data, length, hash);
 
     if (internedString != NULL) {
         return internedString;
@@ -42,6 +42,13 @@ private:
 
     enum { cacheSize = 511 };
     j9object_t _cache[cacheSize]; /**< interned string table cash */
+
+    enum { indexBucketSlots = 8 };
+    UDATA _indexBucketCount; /**< number of buckets in the lock-free index, a power of two (0 if there is no index) */
+    j9object_t* _index; /**< lock-free index of interned strings, indexBucketSlots slots per bucket */
+
+    UDATA _dedupBucketCount; /**< number of buckets in the deduplication table, a power of two (0 if there is none) */
+    j9object_t* _dedupTable; /**< canonical String value arrays, indexBucketSlots slots per bucket */
 public:
 private:
     bool initialize(MM_EnvironmentBase* env);
@@ -62,6 +69,61 @@ public:
      */
     j9object_t* getStringInternCache(UDATA hash) { return &_cache[hash % cacheSize]; }
 
+    /**
+     * The index is a set of interned strings in fixed size buckets, so a slot cleared by the GC never breaks a probe
+     * sequence. Lookups take no lock and inserts claim slots with compare and swap; a miss (or an evicted string) is
+     * resolved from the locked hash sub-tables, which remain the authoritative copy. Like the cache, the index is
+     * scanned by the GC as a weak root.
+     * @return the address of the index (represented as an array), or NULL if there is no index
+     */
+    j9object_t* getStringInternIndex() { return _index; }
+    /**
+     * @return number of slots in the index
+     */
+    UDATA getStringInternIndexSize() { return _indexBucketCount * indexBucketSlots; }
+
+    /**
+     * Find a string in the index without locking.
+     * @param javaVM the Java VM
+     * @param hash hash value of the string
+     * @param key pointer to a String object or low-tagged pointer to a stringTableUTF8Query
+     * @return the interned string, or NULL if it is not in the index
+     */
+    j9object_t indexAt(J9JavaVM* javaVM, UDATA hash, void* key);
+    /**
+     * Add an interned string to the index, evicting another string of its bucket if the bucket is full.
+     * @param hash hash value of the string
+     * @param string the interned string
+     */
+    void indexAtPut(UDATA hash, j9object_t string);
+
+    /**
+     * The deduplication table holds canonical String value arrays in buckets shaped like the index, keyed by a hash
+     * of the array contents rather than its address, so entries survive the GC moving them. Only the GC uses it,
+     * while it has exclusive access, and it is scanned as a weak root like the cache.
+     * @return the address of the deduplication table (represented as an array), or NULL if there is no table
+     */
+    j9object_t* getValueDeduplicationTable() { return _dedupTable; }
+    /**
+     * @return number of slots in the deduplication table
+     */
+    UDATA getValueDeduplicationTableSize() { return _dedupBucketCount * indexBucketSlots; }
+    /**
+     * @return the deduplication table bucket used for arrays with the given contents hash
+     */
+    UDATA getValueDeduplicationBucket(UDATA hash) { return hash & (_dedupBucketCount - 1); }
+
+    /**
+     * Find the canonical array with the same class and contents as a String value array, making the array canonical
+     * if there is none yet. Must only be called by the GC while it has exclusive access; GC threads may call it in
+     * parallel for hashes in different buckets.
+     * @param env the current thread
+     * @param value a contiguous String value array
+     * @param hash hash value of the contents of the array
+     * @return the canonical array, which is value itself if it was made canonical (or could not be recorded)
+     */
+    j9object_t deduplicateValue(MM_EnvironmentBase* env, j9object_t value, UDATA hash);
+
     /**
      * @return hash sub-table count
      */
@@ -92,6 +154,15 @@ public:
      * @para utf8Length length of the string
      */
     j9object_t hashAtUTF8(UDATA tableIndex, U_8* utf8Data, UDATA utf8Length, U_32 hash);
+    /**
+     * Find a UTF8 string in the index or, failing that, in its locked hash sub-table.
+     * @param javaVM the Java VM
+     * @param utf8Data pointer to UTF8 string data
+     * @param utf8Length length of the string
+     * @param hash hash value of the string
+     * @return pointer to the interned String object or NULL if it is not interned
+     */
+    j9object_t findUTF8(J9JavaVM* javaVM, U_8* utf8Data, UDATA utf8Length, U_32 hash);
     /**
      * Add a string to the hash table.
      * @param tableIndex index of hash table into the array of sub-tables
@@ -128,6 +199,10 @@ public:
         , _tableCount(tableCount)
         , _table(NULL)
         , _mutex(NULL)
+        , _indexBucketCount(0)
+        , _index(NULL)
+        , _dedupBucketCount(0)
+        , _dedupTable(NULL)
     {
         _typeId = __FUNCTION__;
     }
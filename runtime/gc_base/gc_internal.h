@@ -82,6 +82,7 @@ extern J9_CFUNC UDATA j9gc_is_local_collector(J9JavaVM* javaVM, UDATA gcID);
 extern J9_CFUNC UDATA j9gc_get_collector_id(OMR_VMThread* omrVMThread);
 extern J9_CFUNC UDATA j9gc_pools_memory(J9JavaVM* javaVM, UDATA poolIDs, UDATA* totals, UDATA* frees, BOOLEAN gcEnd);
 extern J9_CFUNC UDATA j9gc_pool_maxmemory(J9JavaVM* javaVM, UDATA poolID);
+extern J9_CFUNC UDATA j9gc_pool_released_memory(J9JavaVM* javaVM, UDATA poolID);
 extern J9_CFUNC const char* j9gc_get_gc_action(J9JavaVM* javaVM, UDATA gcID);
 extern J9_CFUNC const char* j9gc_get_gc_cause(OMR_VMThread* omrVMthread);
 extern J9_CFUNC struct J9HookInterface** j9gc_get_private_hook_interface(J9JavaVM* javaVM);
@@ -592,6 +592,30 @@ j9gc_pool_maxmemory(J9JavaVM* javaVM, UDATA poolID)
     return maxsize;
 }
 
+/**
+ * retrieve the memory of the memory pool whose pages were returned to the operating system (as of the end of the
+ * last GC)
+ */
+UDATA
+j9gc_pool_released_memory(J9JavaVM* javaVM, UDATA poolID)
+{
+    UDATA releasedSize = 0;
+#if defined(J9VM_GC_VLHGC)
+    MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(javaVM);
+
+    switch (poolID) {
+    case J9_GC_MANAGEMENT_POOL_REGION_RESERVED:
+    case J9_GC_MANAGEMENT_POOL_JAVAHEAP:
+        /* only free regions are released, and those are accounted to the reserved pool */
+        releasedSize = extensions->heapResidentSavingsBytes;
+        break;
+    default:
+        break;
+    }
+#endif /* J9VM_GC_VLHGC */
+    return releasedSize;
+}
+
 /**
  * retrieve the gc action
  */
@@ -74,6 +74,7 @@ UDATA j9gc_is_local_collector(J9JavaVM* javaVM, UDATA gcID);
 UDATA j9gc_get_collector_id(OMR_VMThread* omrVMThread);
 UDATA j9gc_pools_memory(J9JavaVM* javaVM, UDATA poolIDs, UDATA* totals, UDATA* frees, BOOLEAN gcEnd);
 UDATA j9gc_pool_maxmemory(J9JavaVM* javaVM, UDATA poolID);
+UDATA j9gc_pool_released_memory(J9JavaVM* javaVM, UDATA poolID);
 const char* j9gc_get_gc_action(J9JavaVM* javaVM, UDATA gcID);
 const char* j9gc_get_gc_cause(OMR_VMThread* omrVMthread);
 
@@ -94,6 +94,7 @@
 #include "SlotObject.hpp"
 #include "StandardAccessBarrier.hpp"
 #include "SublistFragment.hpp"
+#include "StringDeduplicator.hpp"
 #include "StringTable.hpp"
 #include "Task.hpp"
 #include "UnfinalizedObjectBuffer.hpp"
@@ -203,6 +204,11 @@ void MM_CollectorLanguageInterfaceImpl::scavenger_reportScavengeEnd(
 
         _extensions->scavengerJavaStats._ownableSynchronizerNurserySurvived
             = _extensions->scavengerJavaStats._ownableSynchronizerCandidates;
+
+        /* the tenured copies of the Strings queued by this scavenge were backed out */
+        if (NULL != _extensions->stringDeduplicator) {
+            _extensions->stringDeduplicator->discardCandidates();
+        }
     }
 }
 
@@ -252,6 +258,11 @@ void MM_CollectorLanguageInterfaceImpl::scavenger_masterThreadGarbageCollect_sca
     if (!_extensions->isConcurrentScavengerEnabled()) {
         _extensions->updateIdentityHashDataForSaltIndex(J9GC_HASH_SALT_NURSERY_INDEX);
     }
+
+    /* Every tenured String queued by this scavenge is now at its final address */
+    if (NULL != _extensions->stringDeduplicator) {
+        _extensions->stringDeduplicator->deduplicate(envBase);
+    }
 }
 
 /**
@@ -285,6 +296,14 @@ GC_ObjectScanner* MM_CollectorLanguageInterfaceImpl::scavenger_getObjectScanner(
     Assert_MM_true((GC_ObjectScanner::scanHeap == flags) ^ (GC_ObjectScanner::scanRoots == flags));
 #endif /* defined(OMR_GC_MODRON_SCAVENGER_STRICT) */
 
+    /* a String found in tenure space by a heap scan has just been tenured, so it has survived the tenure age */
+    MM_StringDeduplicator* stringDeduplicator = _extensions->stringDeduplicator;
+    if ((NULL != stringDeduplicator) && GC_ObjectScanner::isHeapScan(flags)
+        && stringDeduplicator->isCandidateClass(J9GC_J9OBJECT_CLAZZ(objectPtr))
+        && !_extensions->scavenger->isObjectInNewSpace(objectPtr)) {
+        stringDeduplicator->addCandidate(objectPtr);
+    }
+
     GC_ObjectScanner* objectScanner = NULL;
     switch (_extensions->objectModel.getScanType(objectPtr)) {
     case GC_ObjectModel::SCAN_ATOMIC_MARKABLE_REFERENCE_OBJECT:
@@ -22,6 +22,7 @@
 #include "j9protos.h"
 #include "ModronAssertions.h"
 
+#include "AllocationSiteStats.hpp"
 #include "EnvironmentBase.hpp"
 #include "EnvironmentDelegate.hpp"
 #include "GCExtensions.hpp"
@@ -97,6 +98,11 @@ void MM_EnvironmentDelegate::tearDown()
         _gcEnv._ownableSynchronizerObjectBuffer->kill(_env);
         _gcEnv._ownableSynchronizerObjectBuffer = NULL;
     }
+
+    if (NULL != _gcEnv._allocationSiteStats) {
+        _gcEnv._allocationSiteStats->kill(_env);
+        _gcEnv._allocationSiteStats = NULL;
+    }
 }
 
 OMR_VMThread* MM_EnvironmentDelegate::attachVMThread(OMR_VM* omrVM, const char* threadName, uintptr_t reason)
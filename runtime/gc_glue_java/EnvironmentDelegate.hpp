@@ -31,6 +31,7 @@
 
 struct OMR_VMThread;
 
+class MM_AllocationSiteStats;
 class MM_EnvironmentBase;
 class MM_OwnableSynchronizerObjectBuffer;
 class MM_ReferenceObjectBuffer;
@@ -51,6 +52,8 @@ public:
         _unfinalizedObjectBuffer; /**< The thread-specific buffer of recently allocated unfinalized objects */
     MM_OwnableSynchronizerObjectBuffer* _ownableSynchronizerObjectBuffer; /**< The thread-specific buffer of recently
                                                                              allocated ownable synchronizer objects */
+    MM_AllocationSiteStats* _allocationSiteStats; /**< The thread-specific allocation sites of sampled allocations,
+                                                     created by the first sample */
 
     /* Function members */
 private:
@@ -60,6 +63,7 @@ public:
         : _referenceObjectBuffer(NULL)
         , _unfinalizedObjectBuffer(NULL)
         , _ownableSynchronizerObjectBuffer(NULL)
+        , _allocationSiteStats(NULL)
     {}
 };
 
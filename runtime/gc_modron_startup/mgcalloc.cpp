@@ -40,6 +40,7 @@
 #include "modronapi.hpp"
 
 #include "AllocateDescription.hpp"
+#include "AllocationSiteStats.hpp"
 #include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 #include "IndexableObjectAllocationModel.hpp"
@@ -66,6 +67,8 @@ static void traceAllocateIndexableObject(
 static void traceAllocateObject(
     J9VMThread* vmThread, J9Class* clazz, uintptr_t objSize, uintptr_t numberOfIndexedFields = 0);
 static bool traceObjectCheck(J9VMThread* vmThread);
+static uintptr_t allocationSiteIterator(J9VMThread* currentThread, J9StackWalkState* walkState);
+static void recordAllocationSite(J9VMThread* vmThread, MM_EnvironmentBase* env, J9Class* clazz, uintptr_t objSize);
 
 #define STACK_FRAMES_TO_DUMP 8
 
@@ -232,6 +235,9 @@ static void traceAllocateObject(
             Trc_MM_J9AllocateObject_outOfLineObjectAllocation(vmThread, clazz,
                 J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(romClass)), J9UTF8_DATA(J9ROMCLASS_CLASSNAME(romClass)), objSize);
         }
+        if (extensions->doAllocationSiteSampling) {
+            recordAllocationSite(vmThread, env, clazz, objSize);
+        }
         /* Keep the remainder, want this to happen so that we don't miss objects
          * after seeing large objects
          */
@@ -239,6 +245,49 @@ static void traceAllocateObject(
     }
 }
 
+static uintptr_t allocationSiteIterator(J9VMThread* currentThread, J9StackWalkState* walkState)
+{
+    J9Method** frames = (J9Method**)walkState->userData1;
+    uintptr_t* frameCount = (uintptr_t*)walkState->userData2;
+    uintptr_t maxFrames = (uintptr_t)walkState->userData3;
+
+    frames[*frameCount] = walkState->method;
+    *frameCount += 1;
+    return (*frameCount < maxFrames) ? J9_STACKWALK_KEEP_ITERATING : J9_STACKWALK_STOP_ITERATING;
+}
+
+/**
+ * Attribute a sampled allocation to its allocation site in the profile of the allocating thread.  Only the thread
+ * itself writes to its profile, so no synchronization is required; the profiles are read under exclusive VM access.
+ */
+static void recordAllocationSite(J9VMThread* vmThread, MM_EnvironmentBase* env, J9Class* clazz, uintptr_t objSize)
+{
+    GC_Environment* gcEnv = env->getGCEnvironment();
+    if (NULL == gcEnv->_allocationSiteStats) {
+        gcEnv->_allocationSiteStats = MM_AllocationSiteStats::newInstance(env);
+    }
+
+    if (NULL != gcEnv->_allocationSiteStats) {
+        J9Method* frames[ALLOCATION_SITE_MAX_DEPTH];
+        uintptr_t frameCount = 0;
+        MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(env);
+        uintptr_t maxFrames = OMR_MIN(extensions->allocationSiteSamplingDepth, (uintptr_t)ALLOCATION_SITE_MAX_DEPTH);
+        J9StackWalkState walkState;
+
+        walkState.skipCount = 0;
+        walkState.maxFrames = maxFrames;
+        walkState.frameWalkFunction = allocationSiteIterator;
+        walkState.userData1 = frames;
+        walkState.userData2 = &frameCount;
+        walkState.userData3 = (void*)maxFrames;
+        walkState.walkThread = vmThread;
+        walkState.flags = J9_STACKWALK_ITERATE_FRAMES | J9_STACKWALK_VISIBLE_ONLY | J9_STACKWALK_COUNT_SPECIFIED;
+        vmThread->javaVM->walkStackFrames(vmThread, &walkState);
+
+        gcEnv->_allocationSiteStats->record(clazz, objSize, frames, frameCount);
+    }
+}
+
 /* Required to check if we're going to trace or not since a java stack trace needs
  * stack frames built up; therefore we can't be in the noGC version of allocates
  *
@@ -103,6 +103,7 @@
 #include "RememberedSetSATB.hpp"
 #endif /* J9VM_GC_STACCATO */
 #include "Scavenger.hpp"
+#include "StringDeduplicator.hpp"
 #include "StringTable.hpp"
 #include "Validator.hpp"
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
@@ -494,11 +495,26 @@ j9gc_initialize_heap(J9JavaVM* vm, IDATA* memoryParameterTable, UDATA heapBytesR
         goto error_no_memory;
     }
 
+    /* Strings are only deduplicated by the stop-the-world copying collectors */
+    if ((gc_policy_gencon != extensions->configurationOptions._gcPolicy)
+        && (gc_policy_balanced != extensions->configurationOptions._gcPolicy)) {
+        extensions->stringDeduplication = false;
+    } else if (extensions->isConcurrentScavengerEnabled()) {
+        extensions->stringDeduplication = false;
+    }
+
     extensions->stringTable = MM_StringTable::newInstance(&env, extensions->dispatcher->threadCountMaximum());
     if (NULL == extensions->stringTable) {
         goto error_no_memory;
     }
 
+    if (extensions->stringDeduplication) {
+        extensions->stringDeduplicator = MM_StringDeduplicator::newInstance(&env);
+        if (NULL == extensions->stringDeduplicator) {
+            goto error_no_memory;
+        }
+    }
+
     /* Initialize statistic locks */
     if (omrthread_monitor_init_with_name(&extensions->gcStatsMutex, 0, "MM_GCExtensions::gcStats")) {
         loadInfo->fatalErrorStr
@@ -509,8 +525,9 @@ j9gc_initialize_heap(J9JavaVM* vm, IDATA* memoryParameterTable, UDATA heapBytesR
 
 #if defined(J9VM_GC_IDLE_HEAP_MANAGER)
     if (extensions->gcOnIdle || extensions->compactOnIdle) {
-        /* Enable idle tuning only for gencon policy */
-        if (gc_policy_gencon == extensions->configurationOptions._gcPolicy) {
+        /* Enable idle tuning only for gencon and balanced (which releases its free regions on an idle GC) policies */
+        if ((gc_policy_gencon == extensions->configurationOptions._gcPolicy)
+            || (gc_policy_balanced == extensions->configurationOptions._gcPolicy)) {
             extensions->idleGCManager = MM_IdleGCManager::newInstance(&env);
             if (NULL == extensions->idleGCManager) {
                 goto error_no_memory;
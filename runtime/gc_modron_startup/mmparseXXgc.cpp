@@ -457,6 +457,93 @@ jint gcParseXXgcArguments(J9JavaVM* vm, char* optArg)
             }
             continue;
         }
+        if (try_scan(&scan_start, "tarokTargetMaxPauseTime=")) {
+            if (!scan_udata_helper(
+                    vm, &scan_start, &extensions->tarokTargetMaxPauseTime, "tarokTargetMaxPauseTime=")) {
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            continue;
+        }
+        if (try_scan(&scan_start, "tarokEnableConcurrentRefinement")) {
+            extensions->tarokEnableConcurrentRefinement = true;
+            continue;
+        }
+        if (try_scan(&scan_start, "tarokDisableConcurrentRefinement")) {
+            extensions->tarokEnableConcurrentRefinement = false;
+            continue;
+        }
+        if (try_scan(&scan_start, "tarokConcurrentRefinementPausePercent=")) {
+            if (!scan_udata_helper(vm, &scan_start, &extensions->tarokConcurrentRefinementPausePercent,
+                    "tarokConcurrentRefinementPausePercent=")) {
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            if (100 < extensions->tarokConcurrentRefinementPausePercent) {
+                j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE,
+                    "tarokConcurrentRefinementPausePercent=", (UDATA)0, (UDATA)100);
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            continue;
+        }
+        if (try_scan(&scan_start, "tarokCopyForwardPrefetchWindow=")) {
+            if (!scan_udata_helper(vm, &scan_start, &extensions->tarokCopyForwardPrefetchWindow,
+                    "tarokCopyForwardPrefetchWindow=")) {
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            if (64 < extensions->tarokCopyForwardPrefetchWindow) {
+                j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE,
+                    "tarokCopyForwardPrefetchWindow=", (UDATA)0, (UDATA)64);
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            continue;
+        }
+        if (try_scan(&scan_start, "tarokIncrementalCompactIncrements=")) {
+            if (!scan_udata_helper(vm, &scan_start, &extensions->tarokIncrementalCompactIncrements,
+                    "tarokIncrementalCompactIncrements=")) {
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            if ((0 == extensions->tarokIncrementalCompactIncrements)
+                || (64 < extensions->tarokIncrementalCompactIncrements)) {
+                j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE,
+                    "tarokIncrementalCompactIncrements=", (UDATA)1, (UDATA)64);
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            continue;
+        }
+        if (try_scan(&scan_start, "tarokEnableColdFreeRegionRelease")) {
+            extensions->tarokReleaseColdFreeRegions = true;
+            continue;
+        }
+        if (try_scan(&scan_start, "tarokDisableColdFreeRegionRelease")) {
+            extensions->tarokReleaseColdFreeRegions = false;
+            continue;
+        }
+        if (try_scan(&scan_start, "tarokFreeRegionColdCycles=")) {
+            if (!scan_udata_helper(
+                    vm, &scan_start, &extensions->tarokFreeRegionColdCycles, "tarokFreeRegionColdCycles=")) {
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            continue;
+        }
+        if (try_scan(&scan_start, "tarokFreeRegionReleaseMaxBytes=")) {
+            if (!scan_udata_memory_size_helper(vm, &scan_start, &extensions->tarokFreeRegionReleaseMaxBytes,
+                    "tarokFreeRegionReleaseMaxBytes=")) {
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            continue;
+        }
+        if (try_scan(&scan_start, "tarokReleaseFreeRegionsLazily")) {
+            extensions->tarokReleaseFreeRegionsLazily = true;
+            continue;
+        }
         if (try_scan(&scan_start, "tarokPGCtoGMP=")) {
             if (!scan_udata_helper(vm, &scan_start, &extensions->tarokPGCtoGMPNumerator, "tarokPGCtoGMP=")) {
                 returnValue = JNI_EINVAL;
@@ -1262,6 +1349,15 @@ jint gcParseXXgcArguments(J9JavaVM* vm, char* optArg)
             continue;
         }
 
+        if (try_scan(&scan_start, "stringTableIndexBuckets=")) {
+            if (!scan_udata_helper(
+                    vm, &scan_start, &(extensions->stringTableIndexBuckets), "stringTableIndexBuckets=")) {
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            continue;
+        }
+
         if (try_scan(&scan_start, "objectListFragmentCount=")) {
             if (!scan_udata_helper(
                     vm, &scan_start, &(extensions->objectListFragmentCount), "objectListFragmentCount=")) {
@@ -40,6 +40,7 @@ static const char* versionString = "Modron $Name: not supported by cvs2svn $";
 
 #include "mmparse.h"
 
+#include "AllocationSiteStats.hpp"
 #include "GCExtensions.hpp"
 #include "Math.hpp"
 
@@ -1367,6 +1368,67 @@ jint gcParseXgcArguments(J9JavaVM* vm, char* optArg)
             continue;
         }
 
+        if (try_scan(&scan_start, "allocationSiteSamplingDepth=")) {
+            if (!scan_udata_helper(
+                    vm, &scan_start, &extensions->allocationSiteSamplingDepth, "allocationSiteSamplingDepth=")) {
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            if ((0 == extensions->allocationSiteSamplingDepth)
+                || (ALLOCATION_SITE_MAX_DEPTH < extensions->allocationSiteSamplingDepth)) {
+                j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE,
+                    "allocationSiteSamplingDepth=", (UDATA)1, (UDATA)ALLOCATION_SITE_MAX_DEPTH);
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            extensions->doAllocationSiteSampling = true;
+            extensions->doOutOfLineAllocationTrace = true;
+            continue;
+        }
+
+        if (try_scan(&scan_start, "stringDeduplicationAge=")) {
+            if (!scan_udata_helper(vm, &scan_start, &extensions->stringDeduplicationAge, "stringDeduplicationAge=")) {
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            continue;
+        }
+
+        if (try_scan(&scan_start, "stringDeduplicationMaxCandidates=")) {
+            if (!scan_udata_helper(vm, &scan_start, &extensions->stringDeduplicationMaxCandidates,
+                    "stringDeduplicationMaxCandidates=")) {
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            continue;
+        }
+
+        if (try_scan(&scan_start, "stringDeduplicationBuckets=")) {
+            if (!scan_udata_helper(
+                    vm, &scan_start, &extensions->stringDeduplicationBuckets, "stringDeduplicationBuckets=")) {
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            if ((0 == extensions->stringDeduplicationBuckets)
+                || (((UDATA)1 << 24) < extensions->stringDeduplicationBuckets)) {
+                j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "stringDeduplicationBuckets=",
+                    (UDATA)1, (UDATA)1 << 24);
+                returnValue = JNI_EINVAL;
+                break;
+            }
+            continue;
+        }
+
+        if (try_scan(&scan_start, "stringDeduplication")) {
+            extensions->stringDeduplication = true;
+            continue;
+        }
+
+        if (try_scan(&scan_start, "noStringDeduplication")) {
+            extensions->stringDeduplication = false;
+            continue;
+        }
+
         if (try_scan(&scan_start, "allocationSamplingEnable")) {
             extensions->doOutOfLineAllocationTrace = true;
             continue;
@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+#include "AllocationSiteStats.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+
+/**
+ * Create and return a new instance of MM_AllocationSiteStats.
+ *
+ * @return the new instance, or NULL on failure.
+ */
+MM_AllocationSiteStats* MM_AllocationSiteStats::newInstance(MM_EnvironmentBase* env)
+{
+    MM_AllocationSiteStats* allocationSiteStats = (MM_AllocationSiteStats*)env->getForge()->allocate(
+        sizeof(MM_AllocationSiteStats), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+    if (NULL != allocationSiteStats) {
+        new (allocationSiteStats) MM_AllocationSiteStats();
+        allocationSiteStats->clear();
+    }
+    return allocationSiteStats;
+}
+
+void MM_AllocationSiteStats::kill(MM_EnvironmentBase* env) { env->getForge()->free(this); }
+
+void MM_AllocationSiteStats::clear()
+{
+    for (UDATA i = 0; i < ALLOCATION_SITE_TABLE_SIZE; i++) {
+        _sites[i]._clazz = NULL;
+    }
+    _siteCount = 0;
+    _droppedSamples = 0;
+}
+
+UDATA MM_AllocationSiteStats::hashSite(J9Class* clazz, J9Method** frames, UDATA frameCount)
+{
+    UDATA hash = (UDATA)clazz >> 3;
+    for (UDATA i = 0; i < frameCount; i++) {
+        hash = (hash * 31) ^ ((UDATA)frames[i] >> 3);
+    }
+    return hash;
+}
+
+MM_AllocationSiteStats::Site* MM_AllocationSiteStats::findSite(J9Class* clazz, J9Method** frames, UDATA frameCount)
+{
+    UDATA index = hashSite(clazz, frames, frameCount) % ALLOCATION_SITE_TABLE_SIZE;
+
+    /* linear probing; the table never fills completely since the last free entry is left unused */
+    for (UDATA probe = 0; probe < ALLOCATION_SITE_TABLE_SIZE; probe++) {
+        Site* site = &_sites[index];
+        if (NULL == site->_clazz) {
+            if ((_siteCount + 1) >= ALLOCATION_SITE_TABLE_SIZE) {
+                return NULL;
+            }
+            site->_clazz = clazz;
+            site->_frameCount = frameCount;
+            for (UDATA i = 0; i < frameCount; i++) {
+                site->_frames[i] = frames[i];
+            }
+            site->_samples = 0;
+            site->_bytes = 0;
+            _siteCount += 1;
+            return site;
+        }
+        if ((clazz == site->_clazz) && (frameCount == site->_frameCount)) {
+            UDATA i = 0;
+            while ((i < frameCount) && (frames[i] == site->_frames[i])) {
+                i++;
+            }
+            if (i == frameCount) {
+                return site;
+            }
+        }
+        index = (index + 1) % ALLOCATION_SITE_TABLE_SIZE;
+    }
+    return NULL;
+}
+
+void MM_AllocationSiteStats::record(J9Class* clazz, UDATA samples, UDATA bytes, J9Method** frames, UDATA frameCount)
+{
+    Site* site = findSite(clazz, frames, OMR_MIN(frameCount, (UDATA)ALLOCATION_SITE_MAX_DEPTH));
+    if (NULL != site) {
+        site->_samples += samples;
+        site->_bytes += bytes;
+    } else {
+        _droppedSamples += samples;
+    }
+}
+
+void MM_AllocationSiteStats::merge(MM_AllocationSiteStats* allocationSiteStats)
+{
+    for (UDATA i = 0; i < ALLOCATION_SITE_TABLE_SIZE; i++) {
+        Site* site = &allocationSiteStats->_sites[i];
+        if (NULL != site->_clazz) {
+            record(site->_clazz, site->_samples, site->_bytes, site->_frames, site->_frameCount);
+        }
+    }
+    _droppedSamples += allocationSiteStats->_droppedSamples;
+}
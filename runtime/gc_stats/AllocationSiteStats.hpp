@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(ALLOCATIONSITESTATS_HPP_)
+#define ALLOCATIONSITESTATS_HPP_
+
+#include "j9.h"
+
+#include "Base.hpp"
+#include "EnvironmentBase.hpp"
+
+#define ALLOCATION_SITE_MAX_DEPTH 8
+#define ALLOCATION_SITE_TABLE_SIZE 256
+
+/*
+ * Accumulates sampled allocations by allocation site (allocated class and the top frames of the allocating Java
+ * stack). Each mutator thread owns an instance and is the only writer, so recording takes no locks; the instances are
+ * read and merged while the VM is held exclusively.
+ */
+
+class MM_AllocationSiteStats : public MM_Base {
+    /* Data Members */
+public:
+    struct Site {
+        J9Class* _clazz; /**< class of the sampled objects, or NULL if the entry is unused */
+        J9Method* _frames[ALLOCATION_SITE_MAX_DEPTH]; /**< innermost first */
+        UDATA _frameCount; /**< number of valid entries in _frames */
+        UDATA _samples; /**< number of allocations sampled at the site */
+        UDATA _bytes; /**< bytes of the sampled allocations */
+    };
+
+    Site _sites[ALLOCATION_SITE_TABLE_SIZE]; /**< open addressed table of sites */
+    UDATA _siteCount; /**< number of used entries in _sites */
+    UDATA _droppedSamples; /**< samples which did not fit in the table */
+
+    /* Function Members */
+private:
+    static UDATA hashSite(J9Class* clazz, J9Method** frames, UDATA frameCount);
+    Site* findSite(J9Class* clazz, J9Method** frames, UDATA frameCount);
+
+public:
+    static MM_AllocationSiteStats* newInstance(MM_EnvironmentBase* env);
+    virtual void kill(MM_EnvironmentBase* env);
+
+    /* reset the stats */
+    void clear();
+
+    /**
+     * Record a sampled allocation.
+     * @param clazz the class of the allocated object
+     * @param bytes the size of the allocated object
+     * @param frames the methods of the allocating stack, innermost first
+     * @param frameCount the number of entries in frames
+     */
+    void record(J9Class* clazz, UDATA bytes, J9Method** frames, UDATA frameCount)
+    {
+        record(clazz, 1, bytes, frames, frameCount);
+    }
+
+    /**
+     * Add samples to a site.
+     * @param clazz the class of the allocated objects
+     * @param samples the number of samples
+     * @param bytes the total size of the sampled objects
+     * @param frames the methods of the allocating stack, innermost first
+     * @param frameCount the number of entries in frames
+     */
+    void record(J9Class* clazz, UDATA samples, UDATA bytes, J9Method** frames, UDATA frameCount);
+
+    /* Merges another AllocationSiteStats structure into this one */
+    void merge(MM_AllocationSiteStats* allocationSiteStats);
+
+    MM_AllocationSiteStats()
+        : MM_Base()
+        , _siteCount(0)
+        , _droppedSamples(0)
+    {}
+};
+
+#endif /* !ALLOCATIONSITESTATS_HPP_ */
@@ -36,6 +36,8 @@
 #include "modronbase.h"
 #include "modronopt.h"
 
+#include <string.h>
+
 #if defined(J9VM_GC_VLHGC)
 
 #include "ReferenceStats.hpp"
@@ -49,6 +51,22 @@ class MM_CopyForwardStats : public MM_CopyForwardStatsCore {
      * Data members
      */
 public:
+    enum {
+        NUMA_NODE_STATS_COUNT = 16 /**< number of NUMA nodes tracked (higher nodes fold into the last entry) */
+    };
+
+    /**
+     * Work distribution and copy traffic of the GC threads bound to one NUMA node (node 0 covers unbound threads).
+     */
+    struct NumaNodeStats {
+        UDATA _scanCachesLocal; /**< scan caches taken from the thread's own node */
+        UDATA _scanCachesCommon; /**< scan caches taken from the common (non-NUMA) list */
+        UDATA _scanCachesStolenNear; /**< scan caches stolen from a node on the same socket */
+        UDATA _scanCachesStolenFar; /**< scan caches stolen from a node on another socket */
+        UDATA _bytesCopiedLocal; /**< bytes copied into regions on the thread's own node */
+        UDATA _bytesCopiedRemote; /**< bytes copied into regions on another node */
+    };
+
     UDATA _unfinalizedCandidates; /**< unfinalized objects that are candidates to be finalized visited this cycle */
     UDATA _unfinalizedEnqueued; /**< unfinalized objects that are enqueued during this cycle (MUST be less than or equal
                                    _unfinalizedCandidates) */
@@ -64,11 +82,26 @@ public:
     UDATA _stringConstantsCandidates; /**< The number of string constants that have been visited in string table during
                                          marking */
 
+    UDATA _dirtyCardsCleaned; /**< The number of dirty cards which had to be fully scanned by the PGC card cleaning */
+    UDATA _concurrentlyRefinedCards; /**< The number of dirty cards refined into RSCLs concurrently before the PGC */
+    U_64 _cardCleaningTime; /**< The hi-res time spent cleaning cards for this PGC (the longest of any thread) */
+
+    NumaNodeStats _numaNodeStats[NUMA_NODE_STATS_COUNT]; /**< Per-node scan cache stealing and copy traffic */
+
 private:
     /*
      * Function members
      */
 public:
+    /**
+     * @param numaNode the J9 NUMA node number of the GC thread
+     * @return the per-node stats of numaNode
+     */
+    MMINLINE NumaNodeStats* getNumaNodeStats(UDATA numaNode)
+    {
+        return &_numaNodeStats[OMR_MIN(numaNode, (UDATA)NUMA_NODE_STATS_COUNT - 1)];
+    }
+
     MMINLINE void clear()
     {
 
@@ -86,6 +119,12 @@ public:
 
         _stringConstantsCleared = 0;
         _stringConstantsCandidates = 0;
+
+        _dirtyCardsCleaned = 0;
+        _concurrentlyRefinedCards = 0;
+        _cardCleaningTime = 0;
+
+        memset(_numaNodeStats, 0, sizeof(_numaNodeStats));
     }
 
     /**
@@ -106,6 +145,19 @@ public:
 
         _stringConstantsCleared += stats->_stringConstantsCleared;
         _stringConstantsCandidates += stats->_stringConstantsCandidates;
+
+        _dirtyCardsCleaned += stats->_dirtyCardsCleaned;
+        _concurrentlyRefinedCards += stats->_concurrentlyRefinedCards;
+        _cardCleaningTime = OMR_MAX(_cardCleaningTime, stats->_cardCleaningTime);
+
+        for (UDATA node = 0; node < NUMA_NODE_STATS_COUNT; node++) {
+            _numaNodeStats[node]._scanCachesLocal += stats->_numaNodeStats[node]._scanCachesLocal;
+            _numaNodeStats[node]._scanCachesCommon += stats->_numaNodeStats[node]._scanCachesCommon;
+            _numaNodeStats[node]._scanCachesStolenNear += stats->_numaNodeStats[node]._scanCachesStolenNear;
+            _numaNodeStats[node]._scanCachesStolenFar += stats->_numaNodeStats[node]._scanCachesStolenFar;
+            _numaNodeStats[node]._bytesCopiedLocal += stats->_numaNodeStats[node]._bytesCopiedLocal;
+            _numaNodeStats[node]._bytesCopiedRemote += stats->_numaNodeStats[node]._bytesCopiedRemote;
+        }
     }
 
     MM_CopyForwardStats()
@@ -119,7 +171,12 @@ public:
         , _phantomReferenceStats()
         , _stringConstantsCleared(0)
         , _stringConstantsCandidates(0)
-    {}
+        , _dirtyCardsCleaned(0)
+        , _concurrentlyRefinedCards(0)
+        , _cardCleaningTime(0)
+    {
+        memset(_numaNodeStats, 0, sizeof(_numaNodeStats));
+    }
 };
 
 #endif /* J9VM_GC_VLHGC */
@@ -71,6 +71,15 @@ public:
         mark_global_collection = 3, /** Global marking is being performed as part of a global collection */
     } _globalMarkIncrementType;
 
+    UDATA _pauseTargetMillis; /**< Partial GC pause target in effect for the increment, in milliseconds (0 if none) */
+    U_64 _predictedPauseMicros; /**< Partial GC pause the scheduler predicted for the increment, in microseconds */
+    U_64 _actualPauseMicros; /**< Measured Partial GC pause of the increment, in microseconds */
+
+    UDATA _compactWorkSelectedBytes; /**< Compaction work (in bytes) taken on by the increment */
+    UDATA _compactWorkDeferredBytes; /**< Compaction work (in bytes) left for later increments */
+
+    UDATA _heapBytesReleased; /**< Bytes of cold free regions whose pages the increment returned to the OS */
+
 public:
     MM_VLHGCIncrementStats()
         : _markStats()
@@ -82,7 +91,13 @@ public:
         , _copyForwardStats()
         , _classUnloadStats()
         , _irrsStats()
-        , _globalMarkIncrementType(MM_VLHGCIncrementStats::mark_idle) {};
+        , _globalMarkIncrementType(MM_VLHGCIncrementStats::mark_idle)
+        , _pauseTargetMillis(0)
+        , _predictedPauseMicros(0)
+        , _actualPauseMicros(0)
+        , _compactWorkSelectedBytes(0)
+        , _compactWorkDeferredBytes(0)
+        , _heapBytesReleased(0) {};
 
     /**
      * Reset the statistics of the receiver for a new round.
@@ -99,6 +114,12 @@ public:
         _classUnloadStats.clear();
         _irrsStats.clear();
         _globalMarkIncrementType = MM_VLHGCIncrementStats::mark_idle;
+        _pauseTargetMillis = 0;
+        _predictedPauseMicros = 0;
+        _actualPauseMicros = 0;
+        _compactWorkSelectedBytes = 0;
+        _compactWorkDeferredBytes = 0;
+        _heapBytesReleased = 0;
     }
 
     /**
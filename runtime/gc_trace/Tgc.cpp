@@ -255,6 +255,11 @@ bool tgcParseArgs(J9JavaVM* javaVM, char* optArg)
             continue;
         }
 
+        if (try_scan(&scan_start, "allocationSites")) {
+            tgcExtensions->_allocationSitesRequested = true;
+            continue;
+        }
+
         if (try_scan(&scan_start, "allocation")) {
             tgcExtensions->_allocationRequested = true;
             continue;
@@ -332,6 +337,10 @@ bool tgcInitializeRequestedOptions(J9JavaVM* javaVM)
             result = result && tgcAllocationInitialize(javaVM);
         }
 
+        if (tgcExtensions->_allocationSitesRequested) {
+            result = result && tgcAllocationSitesInitialize(javaVM);
+        }
+
         if (tgcExtensions->_largeAllocationVerboseRequested || tgcExtensions->_largeAllocationRequested) {
             result = result && tgcLargeAllocationInitialize(javaVM);
         }
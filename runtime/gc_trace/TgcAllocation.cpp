@@ -25,15 +25,21 @@
 #include "j9port.h"
 #include "modronopt.h"
 #include "mmhook.h"
+#include "rommeth.h"
 
+#include "AllocationSiteStats.hpp"
 #include "EnvironmentBase.hpp"
+#include "FrequentObjectsStats.hpp"
 #include "GCExtensions.hpp"
 #include "VMThreadListIterator.hpp"
 #include "TLHAllocationInterface.hpp"
 #include "TgcExtensions.hpp"
 #include "TgcAllocation.hpp"
+#include "Tgc.hpp"
 #include "HeapStats.hpp"
 
+#define ALLOCATION_SITES_TO_PRINT 20
+
 static void tgcAllocationPrintStats(OMR_VMThread* omrVMThread)
 {
     MM_GCExtensions* ext = MM_GCExtensions::getExtensions(omrVMThread);
@@ -84,3 +90,126 @@ bool tgcAllocationInitialize(J9JavaVM* javaVM)
 
     return result;
 }
+
+static void tgcAllocationSitesPrintMethod(MM_TgcExtensions* tgcExtensions, J9Method* method)
+{
+    J9UTF8* className = J9ROMCLASS_CLASSNAME(J9_CLASS_FROM_METHOD(method)->romClass);
+    J9ROMMethod* romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(method);
+    J9UTF8* methodName = J9ROMMETHOD_NAME(romMethod);
+    J9UTF8* methodSignature = J9ROMMETHOD_SIGNATURE(romMethod);
+
+    tgcExtensions->printf("%.*s.%.*s%.*s", (UDATA)J9UTF8_LENGTH(className), J9UTF8_DATA(className),
+        (UDATA)J9UTF8_LENGTH(methodName), J9UTF8_DATA(methodName), (UDATA)J9UTF8_LENGTH(methodSignature),
+        J9UTF8_DATA(methodSignature));
+}
+
+/**
+ * Merge the allocation site profiles of all threads and print the sites and classes which were sampled most since the
+ * previous GC.  Called with exclusive VM access, so no thread is updating its profile.
+ */
+static void tgcAllocationSitesPrintStats(OMR_VMThread* omrVMThread)
+{
+    MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+    MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(env);
+    MM_TgcExtensions* tgcExtensions = MM_TgcExtensions::getExtensions(extensions);
+    J9JavaVM* javaVM = (J9JavaVM*)omrVMThread->_vm->_language_vm;
+
+    MM_AllocationSiteStats* sites = MM_AllocationSiteStats::newInstance(env);
+    MM_FrequentObjectsStats* classes = MM_FrequentObjectsStats::newInstance(env);
+    if ((NULL != sites) && (NULL != classes)) {
+        GC_VMThreadListIterator threadIterator(javaVM);
+        J9VMThread* walkThread = NULL;
+        while (NULL != (walkThread = threadIterator.nextVMThread())) {
+            MM_EnvironmentBase* walkEnv = MM_EnvironmentBase::getEnvironment(walkThread->omrVMThread);
+            MM_AllocationSiteStats* threadSites = walkEnv->getGCEnvironment()->_allocationSiteStats;
+            if (NULL != threadSites) {
+                sites->merge(threadSites);
+                threadSites->clear();
+            }
+        }
+
+        UDATA totalSamples = 0;
+        for (UDATA i = 0; i < ALLOCATION_SITE_TABLE_SIZE; i++) {
+            MM_AllocationSiteStats::Site* site = &sites->_sites[i];
+            if (NULL != site->_clazz) {
+                classes->update(env, site->_clazz, site->_samples);
+                totalSamples += site->_samples;
+            }
+        }
+
+        tgcExtensions->printf("---------- Allocation Site Profile ----------\n");
+        tgcExtensions->printf("Samples: %zu (one per %zu bytes allocated), dropped: %zu\n", totalSamples,
+            extensions->oolObjectSamplingBytesGranularity, sites->_droppedSamples);
+
+        /* print the sites with the most samples, highest first */
+        for (UDATA printed = 0; printed < ALLOCATION_SITES_TO_PRINT; printed++) {
+            MM_AllocationSiteStats::Site* top = NULL;
+            for (UDATA i = 0; i < ALLOCATION_SITE_TABLE_SIZE; i++) {
+                MM_AllocationSiteStats::Site* site = &sites->_sites[i];
+                if ((NULL != site->_clazz) && (0 != site->_samples)
+                    && ((NULL == top) || (site->_samples > top->_samples))) {
+                    top = site;
+                }
+            }
+            if (NULL == top) {
+                break;
+            }
+            tgcExtensions->printf("%8zu samples %12zu bytes  ", top->_samples, top->_bytes);
+            tgcPrintClass(javaVM, top->_clazz);
+            tgcExtensions->printf("\n");
+            for (UDATA frame = 0; frame < top->_frameCount; frame++) {
+                tgcExtensions->printf("        at ");
+                tgcAllocationSitesPrintMethod(tgcExtensions, top->_frames[frame]);
+                tgcExtensions->printf("\n");
+            }
+            /* exclude the site from the following passes */
+            top->_samples = 0;
+        }
+
+        tgcExtensions->printf("Most sampled classes:\n");
+        for (UDATA i = 0; (i < spaceSavingGetCurSize(classes->_spaceSaving)) && (i < classes->_topKFrequent); i++) {
+            tgcExtensions->printf("%8zu samples  ", spaceSavingGetKthMostFreqCount(classes->_spaceSaving, i + 1));
+            tgcPrintClass(javaVM, (J9Class*)spaceSavingGetKthMostFreq(classes->_spaceSaving, i + 1));
+            tgcExtensions->printf("\n");
+        }
+    }
+
+    if (NULL != classes) {
+        classes->kill(env);
+    }
+    if (NULL != sites) {
+        sites->kill(env);
+    }
+}
+
+static void tgcHookAllocationSitesGlobalPrintStats(
+    J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+    MM_GlobalGCStartEvent* event = (MM_GlobalGCStartEvent*)eventData;
+    tgcAllocationSitesPrintStats(event->currentThread);
+}
+
+static void tgcHookAllocationSitesLocalPrintStats(
+    J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+    MM_LocalGCStartEvent* event = (MM_LocalGCStartEvent*)eventData;
+    tgcAllocationSitesPrintStats(event->currentThread);
+}
+
+bool tgcAllocationSitesInitialize(J9JavaVM* javaVM)
+{
+    MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(javaVM);
+    bool result = true;
+
+    /* sampled out-of-line allocations record their allocation site */
+    extensions->doOutOfLineAllocationTrace = true;
+    extensions->doAllocationSiteSampling = true;
+
+    J9HookInterface** omrHooks = J9_HOOK_INTERFACE(extensions->omrHookInterface);
+    (*omrHooks)->J9HookRegisterWithCallSite(
+        omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_START, tgcHookAllocationSitesGlobalPrintStats, OMR_GET_CALLSITE(), NULL);
+    (*omrHooks)->J9HookRegisterWithCallSite(
+        omrHooks, J9HOOK_MM_OMR_LOCAL_GC_START, tgcHookAllocationSitesLocalPrintStats, OMR_GET_CALLSITE(), NULL);
+
+    return result;
+}
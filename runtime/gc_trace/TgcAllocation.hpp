@@ -24,5 +24,6 @@
 #define TGCALLOCATION_HPP_
 
 bool tgcAllocationInitialize(J9JavaVM* javaVM);
+bool tgcAllocationSitesInitialize(J9JavaVM* javaVM);
 
 #endif /* TGCALLOCATION_HPP_ */
@@ -97,6 +97,7 @@ protected:
 public:
     /* data used to save parsed requests whatever are compatible with GC policy or not */
     bool _allocationRequested; /**< true if "allocation" option is parsed */
+    bool _allocationSitesRequested; /**< true if "allocationSites" option is parsed */
     bool _largeAllocationRequested; /**< true if "largeAllocation" option is parsed */
     bool _largeAllocationVerboseRequested; /**< true if "_largeAllocationVerboseRequested" option is parsed */
     bool _backtraceRequested; /**< true if "backtrace" option is parsed */
@@ -28,6 +28,7 @@
 #include "mmhook.h"
 
 #if defined(J9VM_GC_VLHGC)
+#include "CopyForwardStats.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
 #include "Heap.hpp"
@@ -115,6 +116,29 @@ static void tgcHookReportNumaStatistics(J9HookInterface** hook, UDATA eventNum,
     }
 }
 
+/**
+ * Report per-node scan cache stealing and copy locality at the end of a copy-forward
+ */
+static void tgcHookReportCopyForwardNumaStatistics(
+    J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+    MM_CopyForwardEndEvent* event = (MM_CopyForwardEndEvent*)eventData;
+    J9VMThread* vmThread = (J9VMThread*)event->currentThread->_language_vmthread;
+    MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(vmThread->javaVM);
+    MM_TgcExtensions* tgcExtensions = MM_TgcExtensions::getExtensions(extensions);
+    MM_CopyForwardStats* copyForwardStats = (MM_CopyForwardStats*)event->copyForwardStats;
+    UDATA lastNode = OMR_MIN(
+        extensions->_numaManager.getMaximumNodeNumber(), (UDATA)(MM_CopyForwardStats::NUMA_NODE_STATS_COUNT - 1));
+
+    tgcExtensions->printf("NUMA CF:    local   common  stolen near  stolen far   bytes local  bytes remote\n");
+    for (UDATA i = 0; i <= lastNode; i++) {
+        MM_CopyForwardStats::NumaNodeStats* stats = copyForwardStats->getNumaNodeStats(i);
+        tgcExtensions->printf("%7zu:  %7zu  %7zu      %7zu     %7zu  %12zu  %12zu\n", i, stats->_scanCachesLocal,
+            stats->_scanCachesCommon, stats->_scanCachesStolenNear, stats->_scanCachesStolenFar,
+            stats->_bytesCopiedLocal, stats->_bytesCopiedRemote);
+    }
+}
+
 /**
  * Initialize NUMA tgc tracing.
  * Attaches hooks to the appropriate functions handling events used by NUMA tgc tracing.
@@ -136,6 +160,11 @@ bool tgcNumaInitialize(J9JavaVM* javaVM)
     (*hooks)->J9HookRegisterWithCallSite(
         hooks, J9HOOK_MM_OMR_LOCAL_GC_END, tgcHookReportNumaStatistics, OMR_GET_CALLSITE(), NULL);
 
+    J9HookInterface** privateHooks = J9_HOOK_INTERFACE(extensions->privateHookInterface);
+    (*privateHooks)
+        ->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_END,
+            tgcHookReportCopyForwardNumaStatistics, OMR_GET_CALLSITE(), NULL);
+
     return result;
 }
 
@@ -253,6 +253,8 @@ void MM_VerboseHandlerOutputStandardJava::handleScavengeEndInternal(MM_Environme
             extensions->getDynamicMaxSoftReferenceAge(), extensions->getMaxSoftReferenceAge());
         outputReferenceInfo(env, 1, "weak", &scavengerJavaStats->_weakReferenceStats, 0, 0);
         outputReferenceInfo(env, 1, "phantom", &scavengerJavaStats->_phantomReferenceStats, 0, 0);
+
+        MM_VerboseHandlerJava::outputStringDeduplicationInfo(_manager, env, 1);
     }
 }
 #endif /*defined(J9VM_GC_MODRON_SCAVENGER) */
@@ -53,6 +53,8 @@ static void verboseHandlerFailedAllocationCompleted(
 static void verboseHandlerAllocationFailureEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerCopyForwardStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerCopyForwardEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+static void verboseHandlerGarbageCollectCompleted(
+    J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerGMPMarkStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
@@ -207,6 +209,11 @@ void MM_VerboseHandlerOutputVLHGC::enableVerbose()
         ->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_END, verboseHandlerCopyForwardEnd,
             OMR_GET_CALLSITE(), (void*)this);
 
+    /* Pause target */
+    (*_mmPrivateHooks)
+        ->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_VLHGC_GARBAGE_COLLECT_COMPLETED,
+            verboseHandlerGarbageCollectCompleted, OMR_GET_CALLSITE(), (void*)this);
+
     /* Concurrent GMP */
     (*_mmPrivateHooks)
         ->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_START,
@@ -308,6 +315,11 @@ void MM_VerboseHandlerOutputVLHGC::disableVerbose()
     (*_mmPrivateHooks)
         ->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_END, verboseHandlerCopyForwardEnd, NULL);
 
+    /* Pause target */
+    (*_mmPrivateHooks)
+        ->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_VLHGC_GARBAGE_COLLECT_COMPLETED,
+            verboseHandlerGarbageCollectCompleted, NULL);
+
     /* Concurrent GMP */
     (*_mmPrivateHooks)
         ->J9HookUnregister(
@@ -509,6 +521,10 @@ void MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook,
         copyForwardStats->_copyDiscardBytesNonEden);
     writer->formatAndOutput(env, 1, "<memory-cardclean objects=\"%zu\" bytes=\"%zu\" />",
         copyForwardStats->_objectsCardClean, copyForwardStats->_bytesCardClean);
+    if (extensions->tarokEnableConcurrentRefinement) {
+        writer->formatAndOutput(env, 1, "<remembered-set-refinement concurrentcards=\"%zu\" pausecards=\"%zu\" />",
+            copyForwardStats->_concurrentlyRefinedCards, copyForwardStats->_dirtyCardsCleaned);
+    }
     if (copyForwardStats->_aborted || (0 != copyForwardStats->_nonEvacuateRegionCount)) {
         writer->formatAndOutput(env, 1, "<memory-traced type=\"eden\" objects=\"%zu\" bytes=\"%zu\" />",
             copyForwardStats->_scanObjectsEden, copyForwardStats->_scanBytesEden);
@@ -529,6 +545,7 @@ void MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook,
 
     outputStringConstantInfo(
         env, 1, copyForwardStats->_stringConstantsCandidates, copyForwardStats->_stringConstantsCleared);
+    MM_VerboseHandlerJava::outputStringDeduplicationInfo(_manager, env, 1);
 
     if (0 != copyForwardStats->_heapExpandedCount) {
         U_64 expansionMicros
@@ -560,6 +577,57 @@ void MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook,
     exitAtomicReportingBlock();
 }
 
+void MM_VerboseHandlerOutputVLHGC::handleGarbageCollectCompleted(
+    J9HookInterface** hook, UDATA eventNum, void* eventData)
+{
+    MM_VlhgcGarbageCollectCompletedEvent* event = (MM_VlhgcGarbageCollectCompletedEvent*)eventData;
+    MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+    MM_VLHGCIncrementStats* incrementStats = &static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats;
+
+    /* only copy-forward PGCs run under a pause target carry a prediction */
+    if ((MM_CycleState::CT_PARTIAL_GARBAGE_COLLECTION == env->_cycleState->_collectionType)
+        && (0 != incrementStats->_pauseTargetMillis)) {
+        MM_VerboseWriterChain* writer = _manager->getWriterChain();
+        U_64 predicted = incrementStats->_predictedPauseMicros;
+        U_64 actual = incrementStats->_actualPauseMicros;
+
+        enterAtomicReportingBlock();
+        writer->formatAndOutput(env, 0,
+            "<pause-target id=\"%zu\" type=\"partial collect\" targetms=\"%zu\" predictedms=\"%llu.%03llu\" "
+            "actualms=\"%llu.%03llu\" />",
+            _manager->getIdAndIncrement(), incrementStats->_pauseTargetMillis, predicted / 1000, predicted % 1000,
+            actual / 1000, actual % 1000);
+        writer->flush(env);
+        exitAtomicReportingBlock();
+    }
+
+    /* compaction spread over several PGCs reports the share this PGC took on */
+    if ((MM_CycleState::CT_PARTIAL_GARBAGE_COLLECTION == env->_cycleState->_collectionType)
+        && (1 < MM_GCExtensions::getExtensions(_extensions)->tarokIncrementalCompactIncrements)) {
+        MM_VerboseWriterChain* writer = _manager->getWriterChain();
+
+        enterAtomicReportingBlock();
+        writer->formatAndOutput(env, 0,
+            "<incremental-compact id=\"%zu\" selectedbytes=\"%zu\" deferredbytes=\"%zu\" />",
+            _manager->getIdAndIncrement(), incrementStats->_compactWorkSelectedBytes,
+            incrementStats->_compactWorkDeferredBytes);
+        writer->flush(env);
+        exitAtomicReportingBlock();
+    }
+
+    if (0 != incrementStats->_heapBytesReleased) {
+        MM_VerboseWriterChain* writer = _manager->getWriterChain();
+
+        enterAtomicReportingBlock();
+        writer->formatAndOutput(env, 0,
+            "<heap-release id=\"%zu\" releasedbytes=\"%zu\" residentsavingsbytes=\"%zu\" />",
+            _manager->getIdAndIncrement(), incrementStats->_heapBytesReleased,
+            MM_GCExtensions::getExtensions(_extensions)->heapResidentSavingsBytes);
+        writer->flush(env);
+        exitAtomicReportingBlock();
+    }
+}
+
 void MM_VerboseHandlerOutputVLHGC::handleConcurrentStartInternal(
     J9HookInterface** hook, UDATA eventNum, void* eventData)
 {
@@ -946,6 +1014,11 @@ void verboseHandlerCopyForwardEnd(J9HookInterface** hook, UDATA eventNum, void*
     ((MM_VerboseHandlerOutputVLHGC*)userData)->handleCopyForwardEnd(hook, eventNum, eventData);
 }
 
+void verboseHandlerGarbageCollectCompleted(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+    ((MM_VerboseHandlerOutputVLHGC*)userData)->handleGarbageCollectCompleted(hook, eventNum, eventData);
+}
+
 void verboseHandlerConcurrentStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
 {
     ((MM_VerboseHandlerOutput*)userData)->handleConcurrentStart(hook, eventNum, eventData);
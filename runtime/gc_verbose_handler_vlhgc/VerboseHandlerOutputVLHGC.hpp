@@ -164,6 +164,14 @@ public:
      */
     void handleCopyForwardEnd(J9HookInterface** hook, UDATA eventNum, void* eventData);
 
+    /**
+     * Write the predicted and actual pause of a PGC run under a pause target (-XXgc:tarokTargetMaxPauseTime).
+     * @param hook Hook interface used by the JVM.
+     * @param eventNum The hook event number.
+     * @param eventData hook specific event data.
+     */
+    void handleGarbageCollectCompleted(J9HookInterface** hook, UDATA eventNum, void* eventData);
+
     virtual void handleConcurrentStartInternal(J9HookInterface** hook, UDATA eventNum, void* eventData);
     virtual void handleConcurrentEndInternal(J9HookInterface** hook, UDATA eventNum, void* eventData);
     virtual const char* getConcurrentTypeString() { return "GMP work packet processing"; }
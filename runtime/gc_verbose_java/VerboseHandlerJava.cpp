@@ -33,6 +33,7 @@
 #include "VerboseWriterChain.hpp"
 #include "GCExtensions.hpp"
 #include "FinalizeListManager.hpp"
+#include "StringDeduplicator.hpp"
 
 void MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager* manager, MM_EnvironmentBase* env, UDATA indent)
 {
@@ -51,6 +52,20 @@ void MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager* manager, MM
     }
 }
 
+void MM_VerboseHandlerJava::outputStringDeduplicationInfo(
+    MM_VerboseManager* manager, MM_EnvironmentBase* env, UDATA indent)
+{
+    MM_StringDeduplicator* stringDeduplicator = MM_GCExtensions::getExtensions(env)->stringDeduplicator;
+
+    if ((NULL != stringDeduplicator) && (0 != stringDeduplicator->getLastCandidates())) {
+        manager->getWriterChain()->formatAndOutput(env, indent,
+            "<string-deduplication candidates=\"%zu\" deduplicated=\"%zu\" bytessaved=\"%zu\" "
+            "totalbytessaved=\"%zu\" />",
+            stringDeduplicator->getLastCandidates(), stringDeduplicator->getLastDeduplicated(),
+            stringDeduplicator->getLastBytesSaved(), stringDeduplicator->getTotalBytesSaved());
+    }
+}
+
 bool MM_VerboseHandlerJava::getThreadName(char* buf, UDATA bufLen, OMR_VMThread* omrThread)
 {
     PORT_ACCESS_FROM_JAVAVM(((J9VMThread*)omrThread->_language_vmthread)->javaVM);
@@ -41,6 +41,14 @@ public:
      */
     static void outputFinalizableInfo(MM_VerboseManager* manager, MM_EnvironmentBase* env, UDATA indent);
 
+    /**
+     * Output the summary of the String deduplication done by the current collection, if there was any.
+     * @param manager
+     * @param env GC thread used for output.
+     * @param indent base level of indentation for the summary.
+     */
+    static void outputStringDeduplicationInfo(MM_VerboseManager* manager, MM_EnvironmentBase* env, UDATA indent);
+
     /**
      * Output the name of the thread into the buffer.
      * @return Whether the thread name was truncated.
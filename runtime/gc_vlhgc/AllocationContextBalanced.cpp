@@ -1055,6 +1055,9 @@ MM_HeapRegionDescriptorVLHGC* MM_AllocationContextBalanced::selectRegionForContr
     if (NULL != region) {
         Assert_MM_true(getNumaNode() == region->getNumaNode());
         Assert_MM_true(MM_HeapRegionDescriptor::FREE == region->getRegionType());
+        /* the region's memory is decommitted, so it is no longer counted as released when the heap expands again */
+        region->_freeCycles = 0;
+        region->_pagesReleased = false;
     }
 
     _freeListLock.release();
@@ -0,0 +1,284 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Tarok
+ */
+
+#include <string.h> // memset
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9port.h"
+#include "ModronAssertions.h"
+
+#include "ConcurrentRefinementDelegate.hpp"
+
+#include "AtomicOperations.hpp"
+#include "CardTable.hpp"
+#include "CycleStateVLHGC.hpp"
+#include "HeapMap.hpp"
+#include "HeapMapWordIterator.hpp"
+#include "HeapRegionDescriptorVLHGC.hpp"
+#include "HeapRegionIteratorVLHGC.hpp"
+#include "HeapRegionManager.hpp"
+#include "InterRegionRememberedSet.hpp"
+#include "MixedObjectIterator.hpp"
+#include "PointerArrayIterator.hpp"
+
+MM_ConcurrentRefinementDelegate::MM_ConcurrentRefinementDelegate(
+    MM_EnvironmentVLHGC* env, MM_HeapRegionManager* manager)
+    : MM_BaseNonVirtual()
+    , _extensions(MM_GCExtensions::getExtensions(env))
+    , _regionManager(manager)
+    , _concurrentlyRefinedCards(0)
+    , _pauseCardAllowance(0)
+    , _cardCleaningRateMeasured(false)
+    , _averageMicrosPerDirtyCard(0.0)
+    , _refinementMonitor(NULL)
+{
+    _typeId = __FUNCTION__;
+}
+
+bool MM_ConcurrentRefinementDelegate::initialize(MM_EnvironmentVLHGC* env)
+{
+    return 0 == omrthread_monitor_init_with_name(&_refinementMonitor, 0, "MM_ConcurrentRefinementDelegate::refinement");
+}
+
+void MM_ConcurrentRefinementDelegate::tearDown(MM_EnvironmentVLHGC* env)
+{
+    if (NULL != _refinementMonitor) {
+        omrthread_monitor_destroy(_refinementMonitor);
+        _refinementMonitor = NULL;
+    }
+}
+
+void MM_ConcurrentRefinementDelegate::notifyRefinement()
+{
+    if (NULL != _refinementMonitor) {
+        omrthread_monitor_enter(_refinementMonitor);
+        omrthread_monitor_notify_all(_refinementMonitor);
+        omrthread_monitor_exit(_refinementMonitor);
+    }
+}
+
+void MM_ConcurrentRefinementDelegate::refineConcurrently(
+    MM_EnvironmentVLHGC* env, MM_HeapMap* markMap, volatile bool* forceExit)
+{
+    Assert_MM_true(NULL == env->_cycleState);
+
+    /* back off exponentially while there is nothing to refine so that an idle heap costs the master GC thread
+     * (almost) nothing. The wait is on a monitor which is notified when forceExit is set, so a collection request (or
+     * shutdown) is never held up by a long back off
+     */
+    const I_64 maximumWaitMillis = 1024;
+    I_64 waitMillis = 1;
+    while (!*forceExit) {
+        if (0 != refineRegions(env, markMap, forceExit)) {
+            waitMillis = 1;
+        } else {
+            waitMillis = OMR_MIN(waitMillis * 2, maximumWaitMillis);
+        }
+        /* forceExit is set before the monitor is notified so checking it under the monitor can't miss the notify */
+        omrthread_monitor_enter(_refinementMonitor);
+        if (!*forceExit) {
+            omrthread_monitor_wait_timed(_refinementMonitor, waitMillis, 0);
+        }
+        omrthread_monitor_exit(_refinementMonitor);
+    }
+}
+
+UDATA
+MM_ConcurrentRefinementDelegate::refineRegions(MM_EnvironmentVLHGC* env, MM_HeapMap* markMap, volatile bool* forceExit)
+{
+    MM_CardTable* cardTable = _extensions->cardTable;
+    UDATA dirtyCardsFound = 0;
+    UDATA cardsRefined = 0;
+
+    /* most cards are clean between collects, so the card table is read a word of cards at a time where possible */
+    UDATA cleanCardsWord = 0;
+    memset(&cleanCardsWord, CARD_CLEAN, sizeof(cleanCardsWord));
+
+    GC_HeapRegionIteratorVLHGC regionIterator(_regionManager);
+    MM_HeapRegionDescriptorVLHGC* region = NULL;
+    while (!*forceExit && (NULL != (region = regionIterator.nextRegion()))) {
+        /* Eden regions are not described by the mark map (and are always fully scanned by the next PGC, anyway) */
+        if (region->containsObjects() && !region->isEden()) {
+            UDATA heapAddress = (UDATA)region->getLowAddress();
+            UDATA highAddress = (UDATA)region->getHighAddress();
+            Card* card = cardTable->heapAddrToCardAddr(env, (void*)heapAddress);
+            while (!*forceExit && (heapAddress < highAddress)) {
+                if ((0 == ((UDATA)card % sizeof(UDATA)))
+                    && ((highAddress - heapAddress) >= (sizeof(UDATA) * CARD_SIZE))
+                    && (cleanCardsWord == *(UDATA*)card)) {
+                    card += sizeof(UDATA);
+                    heapAddress += sizeof(UDATA) * CARD_SIZE;
+                    continue;
+                }
+                Card fromState = *card;
+                if ((CARD_DIRTY == fromState) || (CARD_PGC_MUST_SCAN == fromState)) {
+                    /* the first dirty cards found fit in the pause budget of the PGC so leave them to it since they
+                     * may well be dirtied again before then
+                     */
+                    dirtyCardsFound += 1;
+                    if ((dirtyCardsFound > _pauseCardAllowance)
+                        && refineCard(env, markMap, card, (void*)heapAddress)) {
+                        cardsRefined += 1;
+                    }
+                }
+                card += 1;
+                heapAddress += CARD_SIZE;
+            }
+        }
+    }
+
+    _concurrentlyRefinedCards += cardsRefined;
+    return cardsRefined;
+}
+
+bool MM_ConcurrentRefinementDelegate::refineCard(
+    MM_EnvironmentVLHGC* env, MM_HeapMap* markMap, Card* card, void* lowAddress)
+{
+    for (UDATA bias = 0; bias < CARD_SIZE; bias += J9MODRON_HEAP_BYTES_PER_UDATA_OF_HEAP_MAP) {
+        void* scanAddress = (void*)((UDATA)lowAddress + bias);
+        MM_HeapMapWordIterator markedObjectIterator(markMap, scanAddress);
+        J9Object* fromObject = NULL;
+        while (NULL != (fromObject = markedObjectIterator.nextObject())) {
+            if (!isRefinableObject(env, fromObject)) {
+                return false;
+            }
+        }
+    }
+
+    /* the card must be clean before its objects are read: a mutator store racing with the scan below will then
+     * dirty the card again, rather than having its reference lost
+     */
+    *card = CARD_CLEAN;
+    MM_AtomicOperations::sync();
+
+    for (UDATA bias = 0; bias < CARD_SIZE; bias += J9MODRON_HEAP_BYTES_PER_UDATA_OF_HEAP_MAP) {
+        void* scanAddress = (void*)((UDATA)lowAddress + bias);
+        MM_HeapMapWordIterator markedObjectIterator(markMap, scanAddress);
+        J9Object* fromObject = NULL;
+        while (NULL != (fromObject = markedObjectIterator.nextObject())) {
+            refineObject(env, fromObject);
+        }
+    }
+
+    return true;
+}
+
+bool MM_ConcurrentRefinementDelegate::isRefinableObject(MM_EnvironmentVLHGC* env, J9Object* objectPtr)
+{
+    /* Class and ClassLoader objects also refer to the heap from native structures which can change under the running
+     * mutator so cards holding them are left for the PGC
+     */
+    J9Class* clazz = J9GC_J9OBJECT_CLAZZ(objectPtr);
+    Assert_MM_mustBeClass(clazz);
+    switch (_extensions->objectModel.getScanType(clazz)) {
+    case GC_ObjectModel::SCAN_CLASS_OBJECT:
+    case GC_ObjectModel::SCAN_CLASSLOADER_OBJECT:
+        return false;
+    default:
+        return true;
+    }
+}
+
+void MM_ConcurrentRefinementDelegate::refineObject(MM_EnvironmentVLHGC* env, J9Object* objectPtr)
+{
+    J9Class* clazz = J9GC_J9OBJECT_CLAZZ(objectPtr);
+    switch (_extensions->objectModel.getScanType(clazz)) {
+    case GC_ObjectModel::SCAN_ATOMIC_MARKABLE_REFERENCE_OBJECT:
+    case GC_ObjectModel::SCAN_MIXED_OBJECT:
+    case GC_ObjectModel::SCAN_OWNABLESYNCHRONIZER_OBJECT:
+    case GC_ObjectModel::SCAN_REFERENCE_MIXED_OBJECT:
+        refineMixedObject(env, objectPtr);
+        break;
+    case GC_ObjectModel::SCAN_POINTER_ARRAY_OBJECT:
+        refinePointerArrayObject(env, objectPtr);
+        break;
+    case GC_ObjectModel::SCAN_PRIMITIVE_ARRAY_OBJECT:
+        /* nothing to do */
+        break;
+    default:
+        Assert_MM_unreachable();
+    }
+}
+
+void MM_ConcurrentRefinementDelegate::refineMixedObject(MM_EnvironmentVLHGC* env, J9Object* objectPtr)
+{
+    MM_InterRegionRememberedSet* interRegionRememberedSet = _extensions->interRegionRememberedSet;
+    GC_MixedObjectIterator mixedObjectIterator(env->getOmrVM(), objectPtr);
+    GC_SlotObject* slotObject = NULL;
+    while (NULL != (slotObject = mixedObjectIterator.nextSlot())) {
+        interRegionRememberedSet->rememberReferenceForRefinement(env, objectPtr, slotObject->readReferenceFromSlot());
+    }
+}
+
+void MM_ConcurrentRefinementDelegate::refinePointerArrayObject(MM_EnvironmentVLHGC* env, J9Object* objectPtr)
+{
+    MM_InterRegionRememberedSet* interRegionRememberedSet = _extensions->interRegionRememberedSet;
+    GC_PointerArrayIterator arrayIterator((J9JavaVM*)env->getLanguageVM(), objectPtr);
+    GC_SlotObject* slotObject = NULL;
+    while (NULL != (slotObject = arrayIterator.nextSlot())) {
+        interRegionRememberedSet->rememberReferenceForRefinement(env, objectPtr, slotObject->readReferenceFromSlot());
+    }
+}
+
+void MM_ConcurrentRefinementDelegate::copyForwardCompleted(MM_EnvironmentVLHGC* env)
+{
+    PORT_ACCESS_FROM_ENVIRONMENT(env);
+    MM_CopyForwardStats* copyForwardStats
+        = &(static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats);
+
+    copyForwardStats->_concurrentlyRefinedCards = _concurrentlyRefinedCards;
+    _concurrentlyRefinedCards = 0;
+
+    /* the card cleaning time also covers the remembered cards scanned, which makes this a conservative (high) cost */
+    UDATA dirtyCardsCleaned = copyForwardStats->_dirtyCardsCleaned;
+    if (0 != dirtyCardsCleaned) {
+        U_64 cardCleaningMicros
+            = j9time_hires_delta(0, copyForwardStats->_cardCleaningTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+        double microsPerDirtyCard = (double)cardCleaningMicros / (double)dirtyCardsCleaned;
+        if (_cardCleaningRateMeasured) {
+            const double historicWeight = 0.70; /* give 70% weight to historical result, 30% to newest result */
+            _averageMicrosPerDirtyCard
+                = (_averageMicrosPerDirtyCard * historicWeight) + (microsPerDirtyCard * (1.0 - historicWeight));
+        } else {
+            _averageMicrosPerDirtyCard = microsPerDirtyCard;
+            _cardCleaningRateMeasured = true;
+        }
+    }
+
+    if (_cardCleaningRateMeasured && (0.0 < _averageMicrosPerDirtyCard)) {
+        /* without a pause target, budget against the pause we are actually seeing */
+        U_64 pauseMicros = (U_64)_extensions->tarokTargetMaxPauseTime * 1000;
+        if (0 == pauseMicros) {
+            pauseMicros = j9time_hires_delta(
+                copyForwardStats->_startTime, copyForwardStats->_endTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+        }
+        double budgetMicros
+            = (double)pauseMicros * (double)_extensions->tarokConcurrentRefinementPausePercent / 100.0;
+        _pauseCardAllowance = (UDATA)(budgetMicros / _averageMicrosPerDirtyCard);
+    }
+}
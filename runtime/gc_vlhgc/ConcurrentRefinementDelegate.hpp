@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Tarok
+ */
+
+#if !defined(CONCURRENTREFINEMENTDELEGATE_HPP_)
+#define CONCURRENTREFINEMENTDELEGATE_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9modron.h"
+
+#include "BaseNonVirtual.hpp"
+#include "EnvironmentVLHGC.hpp"
+#include "GCExtensions.hpp"
+
+class MM_HeapMap;
+class MM_HeapRegionManager;
+
+/**
+ * Drains dirty cards into the remembered set card lists (RSCLs) between partial collects so that fewer dirty cards
+ * have to be fully scanned during the PGC pause. Refinement is done by the master GC thread while it is otherwise
+ * idle and is throttled so that only the dirty cards which the PGC card cleaning could not absorb within its share of
+ * the pause budget are refined (cards which are dirtied again before the pause are wasted concurrent work).
+ * @ingroup GC_Modron_Tarok
+ */
+class MM_ConcurrentRefinementDelegate : public MM_BaseNonVirtual {
+    /* Data Members */
+public:
+protected:
+private:
+    MM_GCExtensions* _extensions; /**< The GC extensions structure */
+    MM_HeapRegionManager* _regionManager; /**< A cached pointer to the region manager */
+    UDATA _concurrentlyRefinedCards; /**< The number of cards refined since the last PGC */
+    UDATA _pauseCardAllowance; /**< The number of dirty cards which may be left for the PGC card cleaning */
+    bool _cardCleaningRateMeasured; /**< True once a PGC has measured the cost of cleaning a dirty card */
+    double _averageMicrosPerDirtyCard; /**< The historically averaged time taken by a PGC to clean one dirty card */
+    omrthread_monitor_t _refinementMonitor; /**< The monitor the master GC thread waits on between idle passes */
+
+    /* Member Functions */
+public:
+    /**
+     * @return true if concurrent refinement has been enabled on the command line
+     */
+    MMINLINE bool isRefinementEnabled() const { return _extensions->tarokEnableConcurrentRefinement; }
+
+    /**
+     * Repeatedly scan the card table of the regions which have survived a collection, refining dirty cards above the
+     * pause allowance into the RSCLs. Only returns once forceExit is set.
+     * Called by the master GC thread outside of a collection, when no GMP is in progress.
+     * @param env[in] The master GC thread
+     * @param markMap[in] The partial GC mark map, which describes the objects of all non-Eden regions
+     * @param forceExit[in] Set by another thread when the master GC thread is required for a collection
+     */
+    void refineConcurrently(MM_EnvironmentVLHGC* env, MM_HeapMap* markMap, volatile bool* forceExit);
+
+    /**
+     * Informs the delegate that a copy-forward PGC has completed so that it can update the measured cost of cleaning
+     * dirty cards in the pause and the derived allowance of dirty cards left for the next PGC. The number of cards
+     * refined since the previous PGC is recorded into the copy-forward stats of the increment and reset.
+     * @param env[in] The master GC thread
+     */
+    void copyForwardCompleted(MM_EnvironmentVLHGC* env);
+
+    /**
+     * Wake the master GC thread if it is waiting between idle refinement passes, so that it checks forceExit (and the
+     * card table) again without waiting for its back off to expire.
+     */
+    void notifyRefinement();
+
+    /**
+     * Initialize the receiver.
+     * @param env[in] The thread initializing the collector
+     * @return Whether or not the initialization succeeded
+     */
+    bool initialize(MM_EnvironmentVLHGC* env);
+
+    /**
+     * Tear down the receiver.
+     * @param env[in] The thread tearing down the collector
+     */
+    void tearDown(MM_EnvironmentVLHGC* env);
+
+    MM_ConcurrentRefinementDelegate(MM_EnvironmentVLHGC* env, MM_HeapRegionManager* manager);
+
+protected:
+private:
+    /**
+     * Make one pass over the card table of all non-Eden regions, skipping words of clean cards.
+     * @return The number of cards refined in this pass
+     */
+    UDATA refineRegions(MM_EnvironmentVLHGC* env, MM_HeapMap* markMap, volatile bool* forceExit);
+
+    /**
+     * Clean the card and remember the inter-region references of all objects starting in it.
+     * @return false if the card contains an object which can only be handled in a PGC (the card is left dirty)
+     */
+    bool refineCard(MM_EnvironmentVLHGC* env, MM_HeapMap* markMap, Card* card, void* lowAddress);
+
+    /**
+     * @return false if objectPtr has references which can only be found in a PGC
+     */
+    bool isRefinableObject(MM_EnvironmentVLHGC* env, J9Object* objectPtr);
+
+    /**
+     * Remember the inter-region references of objectPtr.
+     */
+    void refineObject(MM_EnvironmentVLHGC* env, J9Object* objectPtr);
+    void refineMixedObject(MM_EnvironmentVLHGC* env, J9Object* objectPtr);
+    void refinePointerArrayObject(MM_EnvironmentVLHGC* env, J9Object* objectPtr);
+};
+
+#endif /* CONCURRENTREFINEMENTDELEGATE_HPP_ */
@@ -53,9 +53,11 @@ void MM_CopyForwardGMPCardCleaner::clean(
     switch (fromState) {
     case CARD_DIRTY:
         toState = CARD_GMP_MUST_SCAN;
+        env->_copyForwardStats._dirtyCardsCleaned += 1;
         break;
     case CARD_PGC_MUST_SCAN:
         toState = CARD_CLEAN;
+        env->_copyForwardStats._dirtyCardsCleaned += 1;
         break;
     case CARD_REMEMBERED_AND_GMP_SCAN:
         rememberedOnly = true;
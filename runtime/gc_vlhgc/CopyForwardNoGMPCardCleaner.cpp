@@ -50,6 +50,7 @@ void MM_CopyForwardNoGMPCardCleaner::clean(
     case CARD_PGC_MUST_SCAN:
         shouldScan = true;
         toState = CARD_CLEAN;
+        env->_copyForwardStats._dirtyCardsCleaned += 1;
         break;
     case CARD_REMEMBERED_AND_GMP_SCAN:
         shouldScan = true;
@@ -92,6 +92,7 @@
 #include "ScavengerForwardedHeader.hpp"
 #include "SlotObject.hpp"
 #include "StackSlotValidator.hpp"
+#include "StringDeduplicator.hpp"
 #include "SublistFragment.hpp"
 #include "SublistIterator.hpp"
 #include "SublistPool.hpp"
@@ -108,6 +109,13 @@
 
 #define SCAN_TO_COPY_CACHE_MAX_DISTANCE (UDATA_MAX)
 
+/* Hint that the object header at address is about to be written (forwarded) */
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH_OBJECT_HEADER(address) __builtin_prefetch((const void*)(address), 1)
+#else /* defined(__GNUC__) || defined(__clang__) */
+#define PREFETCH_OBJECT_HEADER(address)
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
 /* VM Design 1774: Ideally we would pull these cache line values from the port library but this will suffice for
  * a quick implementation
  */
@@ -300,6 +308,8 @@ MM_CopyForwardScheme::MM_CopyForwardScheme(MM_EnvironmentVLHGC* env, MM_HeapRegi
     , _cacheFreeList()
     , _cacheScanLists(NULL)
     , _scanCacheListSize(_extensions->_numaManager.getMaximumNodeNumber() + 1)
+    , _numaNodeDistances(NULL)
+    , _numaStealOrder(NULL)
     , _scanCacheWaitCount(0)
     , _scanCacheMonitor(NULL)
     , _workQueueWaitCountPtr(&_scanCacheWaitCount)
@@ -313,6 +323,8 @@ MM_CopyForwardScheme::MM_CopyForwardScheme(MM_EnvironmentVLHGC* env, MM_HeapRegi
     , _regionCountCannotBeEvacuated(0)
     , _cacheLineAlignment(0)
     , _clearableProcessingStarted(false)
+    , _stringDeduplicator(NULL)
+    , _stringDeduplicationAge(0)
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
     , _dynamicClassUnloadingEnabled(false)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
@@ -322,6 +334,7 @@ MM_CopyForwardScheme::MM_CopyForwardScheme(MM_EnvironmentVLHGC* env, MM_HeapRegi
     , _commonContext(NULL)
     , _compactGroupBlock(NULL)
     , _arraySplitSize(0)
+    , _prefetchWindow(OMR_MIN(_extensions->tarokCopyForwardPrefetchWindow, (UDATA)PREFETCH_WINDOW_MAX))
     , _regionSublistContentionThreshold(0)
     , _failedToExpand(false)
     , _shouldScanFinalizableObjects(false)
@@ -375,6 +388,9 @@ bool MM_CopyForwardScheme::initialize(MM_EnvironmentVLHGC* env)
             return false;
         }
     }
+    if (!initializeNumaStealOrder(env)) {
+        return false;
+    }
     if (omrthread_monitor_init_with_name(&_scanCacheMonitor, 0, "MM_CopyForwardScheme::cache")) {
         return false;
     }
@@ -471,6 +487,104 @@ bool MM_CopyForwardScheme::initialize(MM_EnvironmentVLHGC* env)
     return true;
 }
 
+bool MM_CopyForwardScheme::initializeNumaStealOrder(MM_EnvironmentVLHGC* env)
+{
+    UDATA nodeLists = _scanCacheListSize;
+    _numaNodeDistances = (UDATA*)env->getForge()->allocate(
+        sizeof(UDATA) * nodeLists * nodeLists, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+    _numaStealOrder = (UDATA*)env->getForge()->allocate(
+        sizeof(UDATA) * nodeLists * nodeLists, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+    if ((NULL == _numaNodeDistances) || (NULL == _numaStealOrder)) {
+        return false;
+    }
+
+    for (UDATA node = 0; node < nodeLists; node++) {
+        if ((COMMON_CONTEXT_INDEX == node) || !readNumaNodeDistances(env, node)) {
+            /* without topology information, treat every other node as remote */
+            for (UDATA otherNode = 0; otherNode < nodeLists; otherNode++) {
+                _numaNodeDistances[(node * nodeLists) + otherNode]
+                    = (node == otherNode) ? NUMA_LOCAL_DISTANCE : NUMA_REMOTE_DISTANCE;
+            }
+        }
+    }
+
+    /* Each row lists the other nodes: the common list first (since it isn't bound to any node), then the remaining
+     * nodes by increasing distance so that a node on the same socket is robbed before one on another socket. Nodes at
+     * the same distance are kept in round-robin order starting after the preferred node, to spread the stealing.
+     */
+    for (UDATA node = 0; node < nodeLists; node++) {
+        UDATA* stealOrder = &_numaStealOrder[node * nodeLists];
+        UDATA* distances = &_numaNodeDistances[node * nodeLists];
+        UDATA count = 0;
+        if (COMMON_CONTEXT_INDEX != node) {
+            stealOrder[count++] = COMMON_CONTEXT_INDEX;
+        }
+        UDATA firstNodeToSort = count;
+        for (UDATA offset = 1; offset < nodeLists; offset++) {
+            UDATA otherNode = (node + offset) % nodeLists;
+            if (COMMON_CONTEXT_INDEX != otherNode) {
+                /* insertion sort (stable) on distance - there are only ever a handful of nodes */
+                UDATA insertAt = count;
+                while ((insertAt > firstNodeToSort) && (distances[stealOrder[insertAt - 1]] > distances[otherNode])) {
+                    stealOrder[insertAt] = stealOrder[insertAt - 1];
+                    insertAt -= 1;
+                }
+                stealOrder[insertAt] = otherNode;
+                count += 1;
+            }
+        }
+        Assert_MM_true((nodeLists - 1) == count);
+    }
+
+    return true;
+}
+
+bool MM_CopyForwardScheme::readNumaNodeDistances(MM_EnvironmentVLHGC* env, UDATA numaNode)
+{
+    bool result = false;
+#if defined(LINUX)
+    PORT_ACCESS_FROM_ENVIRONMENT(env);
+    UDATA nodeLists = _scanCacheListSize;
+    char path[64];
+    char buffer[512];
+
+    /* J9 node numbers are the OS node numbers plus one (0 being the common context) */
+    j9str_printf(PORTLIB, path, sizeof(path), "/sys/devices/system/node/node%zu/distance", numaNode - 1);
+    IDATA fd = j9file_open(path, EsOpenRead, 0);
+    if (-1 != fd) {
+        IDATA bytesRead = j9file_read(fd, buffer, sizeof(buffer) - 1);
+        j9file_close(fd);
+        if (0 < bytesRead) {
+            buffer[bytesRead] = '\0';
+            /* the file holds one distance per OS node, in node order, separated by spaces */
+            char* cursor = buffer;
+            UDATA otherNode = 1;
+            while ((otherNode < nodeLists) && ('\0' != *cursor)) {
+                while (' ' == *cursor) {
+                    cursor += 1;
+                }
+                if (('0' > *cursor) || ('9' < *cursor)) {
+                    break;
+                }
+                UDATA distance = 0;
+                while (('0' <= *cursor) && ('9' >= *cursor)) {
+                    distance = (distance * 10) + (UDATA)(*cursor - '0');
+                    cursor += 1;
+                }
+                _numaNodeDistances[(numaNode * nodeLists) + otherNode] = distance;
+                otherNode += 1;
+            }
+            result = (nodeLists == otherNode);
+            if (result) {
+                /* the common list is always robbed first so its distance only needs to keep the row complete */
+                _numaNodeDistances[numaNode * nodeLists] = NUMA_REMOTE_DISTANCE;
+            }
+        }
+    }
+#endif /* LINUX */
+    return result;
+}
+
 void MM_CopyForwardScheme::tearDown(MM_EnvironmentVLHGC* env)
 {
     _cacheFreeList.tearDown(env);
@@ -483,6 +597,16 @@ void MM_CopyForwardScheme::tearDown(MM_EnvironmentVLHGC* env)
         _cacheScanLists = NULL;
     }
 
+    if (NULL != _numaNodeDistances) {
+        env->getForge()->free(_numaNodeDistances);
+        _numaNodeDistances = NULL;
+    }
+
+    if (NULL != _numaStealOrder) {
+        env->getForge()->free(_numaStealOrder);
+        _numaStealOrder = NULL;
+    }
+
     if (NULL != _scanCacheMonitor) {
         omrthread_monitor_destroy(_scanCacheMonitor);
         _scanCacheMonitor = NULL;
@@ -857,6 +981,7 @@ MMINLINE void MM_CopyForwardScheme::reinitCache(
     cache->cacheAlloc = base;
     cache->scanCurrent = base;
     cache->_hasPartiallyScannedObject = false;
+    cache->_stolenFromRemoteNode = false;
     cache->cacheTop = top;
 
     /* set the mark map cached values to the initial state */
@@ -898,6 +1023,7 @@ MMINLINE void MM_CopyForwardScheme::reinitArraySplitCache(
     cache->cacheAlloc = array;
     cache->scanCurrent = array;
     cache->_hasPartiallyScannedObject = false;
+    cache->_stolenFromRemoteNode = false;
     cache->cacheTop = array;
     cache->_arraySplitIndex = nextIndex;
 
@@ -1642,6 +1768,10 @@ void MM_CopyForwardScheme::masterSetupForCopyForward(MM_EnvironmentVLHGC* env)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
     _collectStringConstantsEnabled = _extensions->collectStringConstants;
 
+    /* Strings reaching the deduplication age are queued (the oldest compact groups cap the age) */
+    _stringDeduplicator = _extensions->stringDeduplicator;
+    _stringDeduplicationAge = OMR_MIN(_extensions->stringDeduplicationAge, _extensions->tarokRegionMaxAge);
+
     /* ensure heap base is aligned to region size */
     UDATA heapBase = (UDATA)_extensions->heap->getHeapBase();
     UDATA regionSize = _regionManager->getRegionSize();
@@ -1826,6 +1956,15 @@ bool MM_CopyForwardScheme::copyForwardCollectionSet(MM_EnvironmentVLHGC* env)
 
     masterCleanupForCopyForward(env);
 
+    /* The weak roots have been cleared, so every queued String has its final address */
+    if (NULL != _stringDeduplicator) {
+        if (copyForwardCompletedSuccessfully(env)) {
+            _stringDeduplicator->deduplicate(env);
+        } else {
+            _stringDeduplicator->discardCandidates();
+        }
+    }
+
     /* Record the completion time of the copy forward cycle */
     static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats._endTime
         = j9time_hires_clock();
@@ -1979,6 +2118,16 @@ MM_CopyScanCacheVLHGC* MM_CopyForwardScheme::stopCopyingIntoCache(MM_Environment
         /* Return any remaining memory to the pool */
         discardRemainingCache(env, copyCache, copyCacheLock, wastedMemory);
 
+        /* account for the cross-node copy traffic of this thread */
+        UDATA copiedBytes = (UDATA)copyCache->cacheAlloc - (UDATA)copyCache->cacheBase;
+        UDATA threadNode = env->getNumaAffinity();
+        MM_CopyForwardStats::NumaNodeStats* numaStats = env->_copyForwardStats.getNumaNodeStats(threadNode);
+        if (region->getNumaNode() == threadNode) {
+            numaStats->_bytesCopiedLocal += copiedBytes;
+        } else {
+            numaStats->_bytesCopiedRemote += copiedBytes;
+        }
+
         Trc_MM_CopyForwardScheme_stopCopyingIntoCache(env->getLanguageVMThread(),
             _regionManager->mapDescriptorToRegionTableIndex(region), copyCache,
             (double)(newAllocationAgeSizeProduct - copyCache->_allocationAgeSizeProduct) / (1024 * 1024)
@@ -2081,6 +2230,16 @@ MMINLINE MM_AllocationContextTarok* MM_CopyForwardScheme::getContextForHeapAddre
         ->_allocateData._owningContext;
 }
 
+MMINLINE MM_AllocationContextTarok* MM_CopyForwardScheme::getContextForScanCache(
+    MM_EnvironmentVLHGC* env, MM_CopyScanCacheVLHGC* scanCache)
+{
+    MM_AllocationContextTarok* context = (MM_AllocationContextTarok*)env->getAllocationContext();
+    if (!scanCache->_stolenFromRemoteNode || (NULL == context)) {
+        context = getContextForHeapAddress(scanCache->scanCurrent);
+    }
+    return context;
+}
+
 J9Object* MM_CopyForwardScheme::copy(
     MM_EnvironmentVLHGC* env, MM_AllocationContextTarok* reservingContext, MM_ScavengerForwardedHeader* forwardedHeader)
 {
@@ -2254,6 +2413,14 @@ J9Object* MM_CopyForwardScheme::copy(
                 copyCache->_lowerAgeBound = OMR_MIN(copyCache->_lowerAgeBound, sourceRegion->getLowerAgeBound());
                 copyCache->_upperAgeBound = OMR_MAX(copyCache->_upperAgeBound, sourceRegion->getUpperAgeBound());
 
+                if ((NULL != _stringDeduplicator)
+                    && _stringDeduplicator->isCandidateClass(J9GC_J9OBJECT_CLAZZ(destinationObjectPtr))
+                    && (sourceRegion->isEden() || (sourceRegion->getLogicalAge() < _stringDeduplicationAge))
+                    && (MM_CompactGroupManager::getRegionAgeFromGroup(env, destinationCompactGroup)
+                        >= _stringDeduplicationAge)) {
+                    _stringDeduplicator->addCandidate(destinationObjectPtr);
+                }
+
 #if defined(J9VM_GC_LEAF_BITS)
                 if (_extensions->tarokEnableLeafFirstCopying) {
                     copyLeafChildren(env, reservingContext, destinationObjectPtr);
@@ -2473,20 +2640,72 @@ void MM_CopyForwardScheme::scanMixedObjectSlots(
 
     bool success = copyAndForwardObjectClass(env, reservingContext, objectPtr);
 
+    if (success && (0 != _prefetchWindow)) {
+        scanMixedObjectSlotsBatched(env, reservingContext, objectPtr);
+    } else {
+        GC_MixedObjectIterator mixedObjectIterator(_javaVM->omrVM, objectPtr);
+        GC_SlotObject* slotObject = NULL;
+        while (success && (NULL != (slotObject = mixedObjectIterator.nextSlot()))) {
+            if (_tracingEnabled) {
+                PORT_ACCESS_FROM_ENVIRONMENT(env);
+                j9tty_printf(PORTLIB, "   Slot %p value: %p\n", slotObject->readAddressFromSlot(),
+                    slotObject->readReferenceFromSlot());
+            }
+
+            /* Copy/Forward the slot reference and perform any inter-region remember work that is required */
+            success = copyAndForward(env, reservingContext, objectPtr, slotObject);
+        }
+    }
+
+    updateScanStats(env, objectPtr, reason);
+}
+
+MMINLINE void MM_CopyForwardScheme::prefetchSlotTarget(fomrobject_t* slot)
+{
+    GC_SlotObject slotObject(_javaVM->omrVM, slot);
+    J9Object* target = slotObject.readReferenceFromSlot();
+    if (NULL != target) {
+        PREFETCH_OBJECT_HEADER(target);
+    }
+}
+
+bool MM_CopyForwardScheme::scanMixedObjectSlotsBatched(
+    MM_EnvironmentVLHGC* env, MM_AllocationContextTarok* reservingContext, J9Object* objectPtr)
+{
+    fomrobject_t* slots[PREFETCH_WINDOW_MAX];
     GC_MixedObjectIterator mixedObjectIterator(_javaVM->omrVM, objectPtr);
-    GC_SlotObject* slotObject = NULL;
-    while (success && (NULL != (slotObject = mixedObjectIterator.nextSlot()))) {
-        if (_tracingEnabled) {
-            PORT_ACCESS_FROM_ENVIRONMENT(env);
-            j9tty_printf(PORTLIB, "   Slot %p value: %p\n", slotObject->readAddressFromSlot(),
-                slotObject->readReferenceFromSlot());
+    bool success = true;
+    bool moreSlots = true;
+
+    while (success && moreSlots) {
+        /* gather the next window of slots, starting the header fetch of each target as it is found */
+        UDATA count = 0;
+        while (count < _prefetchWindow) {
+            GC_SlotObject* slotObject = mixedObjectIterator.nextSlot();
+            if (NULL == slotObject) {
+                moreSlots = false;
+                break;
+            }
+            slots[count] = slotObject->readAddressFromSlot();
+            prefetchSlotTarget(slots[count]);
+            count += 1;
         }
 
-        /* Copy/Forward the slot reference and perform any inter-region remember work that is required */
-        success = copyAndForward(env, reservingContext, objectPtr, slotObject);
+        /* then copy them in slot order, by which time the first headers should have arrived */
+        for (UDATA i = 0; success && (i < count); i++) {
+            GC_SlotObject slotObject(_javaVM->omrVM, slots[i]);
+            if (_tracingEnabled) {
+                PORT_ACCESS_FROM_ENVIRONMENT(env);
+                j9tty_printf(PORTLIB, "   Slot %p value: %p\n", slotObject.readAddressFromSlot(),
+                    slotObject.readReferenceFromSlot());
+            }
+
+            /* Copy/Forward the slot reference and perform any inter-region remember work that is required */
+            success = copyAndForward(env, reservingContext, objectPtr, &slotObject);
+        }
     }
 
-    updateScanStats(env, objectPtr, reason);
+    return success;
 }
 
 void MM_CopyForwardScheme::scanReferenceObjectSlots(
@@ -2638,15 +2857,42 @@ MM_CopyForwardScheme::scanPointerArrayObjectSlotsSplit(MM_EnvironmentVLHGC* env,
         GC_PointerArrayIterator pointerArrayIterator(_javaVM, (J9Object*)arrayPtr);
         pointerArrayIterator.setIndex(startIndex + slotsToScan);
 
-        for (UDATA scanCount = 0; success && (scanCount < slotsToScan); scanCount++) {
-            GC_SlotObject* slotObject = pointerArrayIterator.nextSlot();
-            if (NULL == slotObject) {
-                /* this can happen if the array is only partially allocated */
-                break;
+        if (0 != _prefetchWindow) {
+            /* gather and prefetch a window of elements at a time, then copy them in scan order */
+            fomrobject_t* slots[PREFETCH_WINDOW_MAX];
+            UDATA scanCount = 0;
+            bool moreSlots = true;
+            while (success && moreSlots && (scanCount < slotsToScan)) {
+                UDATA count = 0;
+                while ((count < _prefetchWindow) && (scanCount < slotsToScan)) {
+                    GC_SlotObject* slotObject = pointerArrayIterator.nextSlot();
+                    if (NULL == slotObject) {
+                        /* this can happen if the array is only partially allocated */
+                        moreSlots = false;
+                        break;
+                    }
+                    slots[count] = slotObject->readAddressFromSlot();
+                    prefetchSlotTarget(slots[count]);
+                    count += 1;
+                    scanCount += 1;
+                }
+
+                for (UDATA i = 0; success && (i < count); i++) {
+                    GC_SlotObject slotObject(_javaVM->omrVM, slots[i]);
+                    success = copyAndForwardPointerArray(env, reservingContext, arrayPtr, startIndex, &slotObject);
+                }
             }
+        } else {
+            for (UDATA scanCount = 0; success && (scanCount < slotsToScan); scanCount++) {
+                GC_SlotObject* slotObject = pointerArrayIterator.nextSlot();
+                if (NULL == slotObject) {
+                    /* this can happen if the array is only partially allocated */
+                    break;
+                }
 
-            /* Copy/Forward the slot reference and perform any inter-region remember work that is required */
-            success = copyAndForwardPointerArray(env, reservingContext, arrayPtr, startIndex, slotObject);
+                /* Copy/Forward the slot reference and perform any inter-region remember work that is required */
+                success = copyAndForwardPointerArray(env, reservingContext, arrayPtr, startIndex, slotObject);
+            }
         }
     }
 
@@ -2818,6 +3064,7 @@ MM_CopyForwardScheme::ScanReason MM_CopyForwardScheme::getNextWorkUnit(
     MM_CopyScanCacheVLHGC* cache = NULL;
     /* Preference is to use survivor copy cache */
     if (NULL != (cache = getSurvivorCacheForScan(env))) {
+        cache->_stolenFromRemoteNode = false;
         env->_scanCache = cache;
         ret = SCAN_REASON_COPYSCANCACHE;
         return ret;
@@ -2906,22 +3153,34 @@ MM_CopyForwardScheme::ScanReason MM_CopyForwardScheme::getNextWorkUnitNoWait(
     MM_EnvironmentVLHGC* env, UDATA preferredNumaNode)
 {
     UDATA nodeLists = _scanCacheListSize;
+    MM_CopyForwardStats::NumaNodeStats* numaStats = env->_copyForwardStats.getNumaNodeStats(preferredNumaNode);
     ScanReason ret = SCAN_REASON_NONE;
     /* local node first */
     ret = getNextWorkUnitOnNode(env, preferredNumaNode);
-    if (SCAN_REASON_NONE == ret) {
-        /* we failed to find a scan cache on our preferred node */
-        if (COMMON_CONTEXT_INDEX != preferredNumaNode) {
-            /* try the common node */
-            ret = getNextWorkUnitOnNode(env, COMMON_CONTEXT_INDEX);
-        }
-        /* now try the remaining nodes */
-        UDATA nextNode = (preferredNumaNode + 1) % nodeLists;
-        while ((SCAN_REASON_NONE == ret) && (nextNode != preferredNumaNode)) {
-            if (COMMON_CONTEXT_INDEX != nextNode) {
-                ret = getNextWorkUnitOnNode(env, nextNode);
+    if (SCAN_REASON_NONE != ret) {
+        env->_scanCache->_stolenFromRemoteNode = false;
+        numaStats->_scanCachesLocal += 1;
+    } else {
+        /* we failed to find a scan cache on our preferred node so steal from the common list and then from the other
+         * nodes, nearest first
+         */
+        UDATA* stealOrder = &_numaStealOrder[preferredNumaNode * nodeLists];
+        for (UDATA i = 0; (SCAN_REASON_NONE == ret) && (i < (nodeLists - 1)); i++) {
+            UDATA nextNode = stealOrder[i];
+            ret = getNextWorkUnitOnNode(env, nextNode);
+            if (SCAN_REASON_NONE != ret) {
+                if (COMMON_CONTEXT_INDEX == nextNode) {
+                    env->_scanCache->_stolenFromRemoteNode = false;
+                    numaStats->_scanCachesCommon += 1;
+                } else {
+                    env->_scanCache->_stolenFromRemoteNode = (COMMON_CONTEXT_INDEX != preferredNumaNode);
+                    if (isNumaNodeOnSameSocket(preferredNumaNode, nextNode)) {
+                        numaStats->_scanCachesStolenNear += 1;
+                    } else {
+                        numaStats->_scanCachesStolenFar += 1;
+                    }
+                }
             }
-            nextNode = (nextNode + 1) % nodeLists;
         }
     }
     if (SCAN_REASON_NONE == ret && (0 != _regionCountCannotBeEvacuated) && !_abortInProgress && !abortFlagRaised()) {
@@ -3116,7 +3375,7 @@ void MM_CopyForwardScheme::completeScanCache(MM_EnvironmentVLHGC* env)
     if (scanCache->isSplitArray()) {
         /* a scan cache can't be a split array and have generic work available */
         Assert_MM_false(scanCache->isScanWorkAvailable());
-        MM_AllocationContextTarok* reservingContext = getContextForHeapAddress(scanCache->scanCurrent);
+        MM_AllocationContextTarok* reservingContext = getContextForScanCache(env, scanCache);
         J9IndexableObject* arrayObject = (J9IndexableObject*)scanCache->scanCurrent;
         UDATA nextIndex = scanCache->_arraySplitIndex;
         Assert_MM_true(0 != nextIndex);
@@ -3125,7 +3384,7 @@ void MM_CopyForwardScheme::completeScanCache(MM_EnvironmentVLHGC* env)
     } else if (scanCache->isScanWorkAvailable()) {
         /* we want to perform a NUMA-aware analogue to "hierarchical scanning" so this scan cache should pull other
          * objects into its node */
-        MM_AllocationContextTarok* reservingContext = getContextForHeapAddress(scanCache->scanCurrent);
+        MM_AllocationContextTarok* reservingContext = getContextForScanCache(env, scanCache);
         do {
             GC_ObjectHeapIteratorAddressOrderedList heapChunkIterator(
                 _extensions, (J9Object*)scanCache->scanCurrent, (J9Object*)scanCache->cacheAlloc, false);
@@ -3282,7 +3541,7 @@ nextCache:
     if (scanCache->isScanWorkAvailable()) {
         /* we want to perform a NUMA-aware analogue to "heirarchical scanning" so this scan cache should pull other
          * objects into its node */
-        MM_AllocationContextTarok* reservingContext = getContextForHeapAddress(env->_scanCache->scanCurrent);
+        MM_AllocationContextTarok* reservingContext = getContextForScanCache(env, scanCache);
         do {
             void* cacheAlloc = scanCache->cacheAlloc;
             GC_ObjectHeapIteratorAddressOrderedList heapChunkIterator(
@@ -3672,6 +3931,7 @@ void MM_CopyForwardScheme::cleanCardTableForPartialCollect(MM_EnvironmentVLHGC*
 
     U_64 cleanEndTime = j9time_hires_clock();
     env->_cardCleaningStats.addToCardCleaningTime(cleanStartTime, cleanEndTime);
+    env->_copyForwardStats._cardCleaningTime += (cleanEndTime - cleanStartTime);
 }
 
 void MM_CopyForwardScheme::updateOrDeleteObjectsFromExternalCycle(MM_EnvironmentVLHGC* env)
@@ -54,6 +54,7 @@ class MM_InterRegionRememberedSet;
 class MM_MarkMap;
 class MM_MemoryPoolBumpPointer;
 class MM_ReferenceStats;
+class MM_StringDeduplicator;
 
 /* Forward declaration of classes defined within the cpp */
 class MM_CopyForwardSchemeAbortScanner;
@@ -79,6 +80,15 @@ private:
         SCAN_REASON_OVERFLOWED_REGION = 4, /**< Indicates the object being scanned was in an overflowed region */
     };
 
+    enum {
+        NUMA_LOCAL_DISTANCE = 10, /**< ACPI SLIT distance of a node to itself */
+        NUMA_REMOTE_DISTANCE = 20, /**< ACPI SLIT distance at or beyond which a node is on another socket */
+    };
+
+    enum {
+        PREFETCH_WINDOW_MAX = 64, /**< Upper bound of the slot batch gathered by the prefetching slot scanners */
+    };
+
     MM_HeapRegionManager* _regionManager; /**< Region manager for the heap instance */
     MM_InterRegionRememberedSet*
         _interRegionRememberedSet; /**< A cached pointer to the inter-region reference tracking mechanism */
@@ -123,6 +133,10 @@ private:
     MM_CopyScanCacheListVLHGC* _cacheScanLists; /**< An array of per-node caches which contains objects still to be
                                                    scanned (1+node_count elements in array)*/
     UDATA _scanCacheListSize; /**< The number of entries in _cacheScanLists */
+    UDATA* _numaNodeDistances; /**< _scanCacheListSize x _scanCacheListSize table of the relative distance between NUMA
+                                  nodes (as reported by the OS, or a uniform remote distance if unknown) */
+    UDATA* _numaStealOrder; /**< For each node, the other (_scanCacheListSize - 1) nodes in the order their scan caches
+                               should be stolen: the common list, then the other nodes from nearest to farthest */
     volatile UDATA _scanCacheWaitCount; /**< The number of threads currently sleeping on _scanCacheMonitor, awaiting
                                            scan cache work */
     omrthread_monitor_t _scanCacheMonitor; /**< Used when waiting on work on any of the _cacheScanLists */
@@ -153,6 +167,9 @@ private:
     bool _clearableProcessingStarted; /**< Flag indicating that clearable processing had been started during this cycle
                                          (used for abort purposes) */
 
+    MM_StringDeduplicator* _stringDeduplicator; /**< Queue of Strings to deduplicate (NULL if deduplication is off) */
+    UDATA _stringDeduplicationAge; /**< Strings are queued when first copied into a region at least this old */
+
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
     bool _dynamicClassUnloadingEnabled; /**< Local cached value from cycle state for performance reasons (TODO:
                                            Reevaluate) */
@@ -168,6 +185,7 @@ private:
                                                        subdivided among the GC threads */
     UDATA _arraySplitSize; /**< The number of elements to be scanned in each array chunk (this determines the degree of
                               parallelization) */
+    UDATA _prefetchWindow; /**< Number of slots gathered and prefetched before they are copied (0 disables batching) */
 
     UDATA
         _regionSublistContentionThreshold /**< The number of threads which must be contending on the same region sublist
@@ -348,6 +366,23 @@ private:
      */
     void scanMixedObjectSlots(
         MM_EnvironmentVLHGC* env, MM_AllocationContextTarok* reservingContext, J9Object* objectPtr, ScanReason reason);
+
+    /**
+     * Copy and forward the slots of a mixed object in batches of _prefetchWindow slots: the targets of a batch are
+     * all prefetched before the first of them is copied, so that the header misses overlap.
+     * @param env current GC thread.
+     * @param reservingContext[in] The context to which we would prefer to copy any objects discovered in this method
+     * @param objectPtr current object being scanned.
+     * @return true if all slots were copied, false if a copy failed (and objectPtr was pushed for the abort)
+     */
+    bool scanMixedObjectSlotsBatched(
+        MM_EnvironmentVLHGC* env, MM_AllocationContextTarok* reservingContext, J9Object* objectPtr);
+
+    /**
+     * Prefetch the header of the object referenced from the given slot, which is about to be forwarded.
+     * @param slot[in] the slot holding the reference
+     */
+    MMINLINE void prefetchSlotTarget(fomrobject_t* slot);
     /**
      * Scan the slots of a reference mixed object.
      * Copy and forward all relevant slots values found in the object.
@@ -679,6 +714,29 @@ private:
      */
     ScanReason getNextWorkUnitOnNode(MM_EnvironmentVLHGC* env, UDATA numaNode);
 
+    /**
+     * Build _numaNodeDistances and _numaStealOrder.
+     * @param env[in] The master thread
+     * @return false if the tables could not be allocated
+     */
+    bool initializeNumaStealOrder(MM_EnvironmentVLHGC* env);
+
+    /**
+     * Read the distances from the given NUMA node to all other nodes into its row of _numaNodeDistances.
+     * @param env[in] The master thread
+     * @param numaNode[in] The J9 node number (the OS node number plus one) whose row is to be read
+     * @return true if the distances were read from the OS
+     */
+    bool readNumaNodeDistances(MM_EnvironmentVLHGC* env, UDATA numaNode);
+
+    /**
+     * @return true if the two nodes share a socket (closer than the remote distance defined by the ACPI SLIT)
+     */
+    MMINLINE bool isNumaNodeOnSameSocket(UDATA numaNode, UDATA otherNumaNode)
+    {
+        return _numaNodeDistances[(numaNode * _scanCacheListSize) + otherNumaNode] < NUMA_REMOTE_DISTANCE;
+    }
+
     /**
      * Complete scanning in Copy-Forward fashion (consume&produce CopyScanCaches)
      * If abort happens midway through all produced work is pushed on Marking WorkStack
@@ -979,6 +1037,17 @@ private:
      */
     MMINLINE MM_AllocationContextTarok* getContextForHeapAddress(void* address);
 
+    /**
+     * Look up the context into which objects found while scanning the given cache should be copied. This is normally
+     * the context owning the cache (to pull objects into the node which refers to them) but a cache stolen from a
+     * remote node copies into the scanning thread's context so that the copy traffic stays on the local node.
+     * @param env[in] The GC thread scanning the cache
+     * @param scanCache[in] The cache being scanned
+     * @return The allocation context to copy objects found in scanCache into
+     */
+    MMINLINE MM_AllocationContextTarok* getContextForScanCache(
+        MM_EnvironmentVLHGC* env, MM_CopyScanCacheVLHGC* scanCache);
+
     /**
      * Determine the desired copy cache size for the specified compact group for the current thread.
      * The size is chosen to balance the opposing problems of fragmentation and contention.
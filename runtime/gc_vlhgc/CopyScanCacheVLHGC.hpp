@@ -53,6 +53,7 @@ public:
     U_64 _upperAgeBound; /**< highest possible age of any object in this copy cache */
     UDATA _arraySplitIndex; /**< The index within the array in scanCurrent to start scanning from (meaningful is
                                J9VM_MODRON_SCAVENGER_CACHE_TYPE_SPLIT_ARRAY is set) */
+    bool _stolenFromRemoteNode; /**< True if the thread scanning this cache took it from another NUMA node's list */
 
     /* Members Function */
 private:
@@ -88,6 +89,7 @@ public:
         , _lowerAgeBound(U_64_MAX)
         , _upperAgeBound(0)
         , _arraySplitIndex(0)
+        , _stolenFromRemoteNode(false)
     {}
 };
 
@@ -96,6 +96,9 @@ bool MM_HeapRegionDataForAllocate::taskAsMemoryPoolBumpPointer(
             _region->setMemoryPool(memoryPool);
             _region->setRegionType(MM_HeapRegionDescriptor::BUMP_ALLOCATED);
             _region->_allocateData._owningContext = context;
+            /* allocating into the region makes its pages resident again */
+            _region->_freeCycles = 0;
+            _region->_pagesReleased = false;
             regionConverted = true;
         }
     } else if (MM_HeapRegionDescriptor::BUMP_ALLOCATED_IDLE == _region->getRegionType()) {
@@ -175,6 +178,8 @@ void MM_HeapRegionDataForAllocate::taskAsArrayletLeaf(MM_EnvironmentBase* env)
 
     _spine = NULL;
     _region->setRegionType(MM_HeapRegionDescriptor::ARRAYLET_LEAF);
+    _region->_freeCycles = 0;
+    _region->_pagesReleased = false;
 }
 
 /**
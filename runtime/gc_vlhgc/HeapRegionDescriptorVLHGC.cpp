@@ -46,8 +46,11 @@ MM_HeapRegionDescriptorVLHGC::MM_HeapRegionDescriptorVLHGC(
     , _projectedLiveBytes(0)
     , _projectedLiveBytesPreviousPGC(0)
     , _projectedLiveBytesDeviation(0)
+    , _evacuationCostMicros(0.0)
     , _compactDestinationQueueNext(NULL)
     , _defragmentationTarget(false)
+    , _freeCycles(0)
+    , _pagesReleased(false)
     , _extensions(MM_GCExtensions::getExtensions(env))
     , _allocationAge(0)
     , _allocationAgeSizeProduct(0.0)
@@ -104,10 +104,15 @@ public:
                                              decay for this PGC */
     IDATA _projectedLiveBytesDeviation; /**< difference between actual live bytes and projected live bytes. Note: not
                                            always update to date and can be negative. */
+    double _evacuationCostMicros; /**< predicted time to copy-forward the region (NOTE: valid only during collection set
+                                     building) */
     MM_HeapRegionDescriptorVLHGC*
         _compactDestinationQueueNext; /**< pointer to next compact destination region in the queue */
     bool _defragmentationTarget; /**< indicates whether this region should be considered for defragmentation, currently
                                     this means the region has been GMPed but not collected yet */
+    UDATA _freeCycles; /**< number of consecutive GC cycles at the end of which this region was free */
+    bool _pagesReleased; /**< true if the pages of this free region were returned to the operating system (as of the
+                            end of the last GC) */
 
 protected:
     MM_GCExtensions* _extensions;
@@ -20,7 +20,12 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#if defined(LINUX)
+#include <sys/mman.h>
+#endif /* LINUX */
+
 #include "CardTable.hpp"
+#include "GCExtensions.hpp"
 #include "GCExtensionsBase.hpp"
 #include "MemoryManager.hpp"
 #include "HeapRegionManagerVLHGC.hpp"
@@ -222,3 +227,80 @@ MM_HeapMemorySnapshot* MM_HeapRegionManagerVLHGC::getHeapMemorySnapshot(
     snapshot->_freeRegionReservedSize = snapshot->_totalRegionReservedSize;
     return snapshot;
 }
+
+UDATA MM_HeapRegionManagerVLHGC::releaseColdFreeRegions(
+    MM_EnvironmentBase* env, UDATA maxBytes, UDATA coldCycles, UDATA* residentSavings)
+{
+    UDATA regionSize = getRegionSize();
+    UDATA releasedBytes = 0;
+    UDATA savings = 0;
+    void* batchLow = NULL;
+    void* batchHigh = NULL;
+
+    GC_HeapRegionIteratorVLHGC regionIterator(this);
+    MM_HeapRegionDescriptorVLHGC* region = NULL;
+    do {
+        region = regionIterator.nextRegion();
+        bool releaseNow = false;
+        if (NULL != region) {
+            if (MM_HeapRegionDescriptor::FREE == region->getRegionType()) {
+                region->_freeCycles += 1;
+                if (region->_pagesReleased) {
+                    savings += regionSize;
+                } else if ((region->_freeCycles > coldCycles) && ((releasedBytes + regionSize) <= maxBytes)) {
+                    releaseNow = true;
+                    releasedBytes += regionSize;
+                }
+            } else {
+                /* acquiring the region already reset its state, but not every region is acquired through a context */
+                region->_freeCycles = 0;
+                region->_pagesReleased = false;
+            }
+        }
+
+        if (releaseNow && (batchHigh == region->getLowAddress())) {
+            batchHigh = region->getHighAddress();
+        } else {
+            if (NULL != batchLow) {
+                /* flush the batch of adjacent cold regions with a single call */
+                UDATA batchBytes = (UDATA)batchHigh - (UDATA)batchLow;
+                bool released = releasePages(env, batchLow, batchHigh);
+                for (void* address = batchLow; address < batchHigh; address = (void*)((UDATA)address + regionSize)) {
+                    ((MM_HeapRegionDescriptorVLHGC*)tableDescriptorForAddress(address))->_pagesReleased = released;
+                }
+                if (released) {
+                    savings += batchBytes;
+                } else {
+                    releasedBytes -= batchBytes;
+                }
+                batchLow = NULL;
+                batchHigh = NULL;
+            }
+            if (releaseNow) {
+                batchLow = region->getLowAddress();
+                batchHigh = region->getHighAddress();
+            }
+        }
+    } while (NULL != region);
+
+    *residentSavings = savings;
+    return releasedBytes;
+}
+
+bool MM_HeapRegionManagerVLHGC::releasePages(MM_EnvironmentBase* env, void* low, void* high)
+{
+    bool result = false;
+#if defined(LINUX)
+    UDATA size = (UDATA)high - (UDATA)low;
+#if defined(MADV_FREE)
+    if (MM_GCExtensions::getExtensions(env)->tarokReleaseFreeRegionsLazily) {
+        /* the kernel reclaims lazily freed pages only under memory pressure, so a region reused soon is cheaper */
+        result = (0 == madvise(low, size, MADV_FREE));
+    }
+#endif /* MADV_FREE */
+    if (!result) {
+        result = (0 == madvise(low, size, MADV_DONTNEED));
+    }
+#endif /* LINUX */
+    return result;
+}
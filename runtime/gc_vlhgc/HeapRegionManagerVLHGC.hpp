@@ -42,6 +42,19 @@ public:
     virtual MM_HeapMemorySnapshot* getHeapMemorySnapshot(
         MM_GCExtensionsBase* extensions, MM_HeapMemorySnapshot* snapshot, bool gcEnd);
 
+    /**
+     * Age the free regions by one GC cycle and return the pages of the cold ones (free for at least coldCycles
+     * cycles) to the operating system. Adjacent cold regions are released together. Regions which were released
+     * earlier but are no longer free are forgotten, since their pages have been touched again.
+     * Must be called with exclusive access, at the end of a GC.
+     * @param env[in] the master GC thread
+     * @param maxBytes[in] the most bytes to release in this call
+     * @param coldCycles[in] the number of cycles a region must have been free for to be released
+     * @param[out] residentSavings the bytes of free regions whose pages are released, after this call
+     * @return the number of bytes released by this call
+     */
+    UDATA releaseColdFreeRegions(MM_EnvironmentBase* env, UDATA maxBytes, UDATA coldCycles, UDATA* residentSavings);
+
     static MM_HeapRegionManagerVLHGC* newInstance(MM_EnvironmentBase* env, UDATA regionSize, UDATA tableDescriptorSize,
         MM_RegionDescriptorInitializer regionDescriptorInitializer,
         MM_RegionDescriptorDestructor regionDescriptorDestructor);
@@ -54,6 +67,11 @@ protected:
     virtual void tearDown(MM_EnvironmentBase* env);
 
 private:
+    /**
+     * Advise the operating system that the pages of the given range of free regions are no longer needed.
+     * @return true if the pages were released
+     */
+    bool releasePages(MM_EnvironmentBase* env, void* low, void* high);
 };
 
 #endif /* HEAPREGIONMANAGERVLHGC_HPP */
@@ -59,6 +59,7 @@
 #include "FinalizerSupport.hpp"
 #include "GlobalAllocationManager.hpp"
 #include "HeapRegionIteratorVLHGC.hpp"
+#include "HeapRegionManagerVLHGC.hpp"
 #include "HeapStats.hpp"
 #include "IncrementalGenerationalGC.hpp"
 #include "InterRegionRememberedSet.hpp"
@@ -96,6 +97,7 @@ MM_IncrementalGenerationalGC::MM_IncrementalGenerationalGC(MM_EnvironmentVLHGC*
     , _schedulingDelegate(env, manager)
     , _collectionSetDelegate(env, manager)
     , _projectedSurvivalCollectionSetDelegate(env, manager)
+    , _concurrentRefinementDelegate(env, manager)
     , _globalCollectionStatistics()
     , _partialCollectionStatistics()
     , _workPacketsForPartialGC(NULL)
@@ -105,6 +107,7 @@ MM_IncrementalGenerationalGC::MM_IncrementalGenerationalGC(MM_EnvironmentVLHGC*
     , _masterGCThread(env)
     , _persistentGlobalMarkPhaseState()
     , _forceConcurrentTermination(false)
+    , _concurrentWorkIsGMP(false)
     , _globalMarkPhaseIncrementBytesStillToScan(0)
 {
     _typeId = __FUNCTION__;
@@ -188,6 +191,10 @@ bool MM_IncrementalGenerationalGC::initialize(MM_EnvironmentVLHGC* env)
         goto error_no_memory;
     }
 
+    if (!_concurrentRefinementDelegate.initialize(env)) {
+        goto error_no_memory;
+    }
+
     if (NULL
         == (_workPacketsForPartialGC
                = MM_WorkPacketsVLHGC::newInstance(env, MM_CycleState::CT_PARTIAL_GARBAGE_COLLECTION))) {
@@ -319,6 +326,7 @@ void MM_IncrementalGenerationalGC::tearDown(MM_EnvironmentVLHGC* env)
 
     _collectionSetDelegate.tearDown(env);
     _projectedSurvivalCollectionSetDelegate.tearDown(env);
+    _concurrentRefinementDelegate.tearDown(env);
 
     _masterGCThread.tearDown(env);
 
@@ -715,7 +723,12 @@ bool MM_IncrementalGenerationalGC::collectorStartup(MM_GCExtensionsBase* extensi
     return true;
 }
 
-void MM_IncrementalGenerationalGC::collectorShutdown(MM_GCExtensionsBase* extensions) { _masterGCThread.shutdown(); }
+void MM_IncrementalGenerationalGC::collectorShutdown(MM_GCExtensionsBase* extensions)
+{
+    /* the master GC thread may be waiting between concurrent refinement passes */
+    forceConcurrentFinish();
+    _masterGCThread.shutdown();
+}
 
 /**
  * Determine if a  expand is required
@@ -1129,6 +1142,7 @@ void MM_IncrementalGenerationalGC::runGlobalGarbageCollection(
     UDATA reclaimableRegions = 0;
     _reclaimDelegate.estimateReclaimableRegions(env, _schedulingDelegate.getAverageEmptinessOfCopyForwardedRegions(),
         &reclaimableRegions, &defragmentReclaimableRegions);
+    releaseColdFreeRegions(env);
     _schedulingDelegate.globalGarbageCollectCompleted(env, reclaimableRegions, defragmentReclaimableRegions);
 
     if (_extensions->tarokUseProjectedSurvivalCollectionSet) {
@@ -1331,7 +1345,8 @@ void MM_IncrementalGenerationalGC::partialGarbageCollectUsingCopyForward(
         _collectionSetDelegate.createRegionCollectionSetForPartialGC(env);
     }
 
-    UDATA desiredCompactWork = _schedulingDelegate.getDesiredCompactWork();
+    UDATA desiredCompactWork
+        = _schedulingDelegate.takeCompactWorkForIncrement(env, _schedulingDelegate.getDesiredCompactWork());
     UDATA estimatedSurvivorRequired = _copyForwardDelegate.estimateRequiredSurvivorBytes(env);
     bool useSlidingCompactor = ((estimatedSurvivorRequired + desiredCompactWork) > freeMemoryForSurvivor);
     Trc_MM_IncrementalGenerationalGC_partialGarbageCollectUsingCopyForward_ChooseCompactor(env->getLanguageVMThread(),
@@ -1368,6 +1383,9 @@ void MM_IncrementalGenerationalGC::partialGarbageCollectUsingCopyForward(
         = _extensions->getHeap()->getActualFreeMemorySize();
     static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats._totalMemoryAfter
         = _extensions->getHeap()->getMemorySize();
+    if (_concurrentRefinementDelegate.isRefinementEnabled()) {
+        _concurrentRefinementDelegate.copyForwardCompleted(env);
+    }
 
     reportCopyForwardEnd(env, endTimeOfCopyForward - startTimeOfCopyForward);
 
@@ -1385,6 +1403,9 @@ void MM_IncrementalGenerationalGC::partialGarbageCollectUsingCopyForward(
     }
 
     _schedulingDelegate.copyForwardCompleted(env);
+    if (_extensions->tarokUseProjectedSurvivalCollectionSet) {
+        _projectedSurvivalCollectionSetDelegate.copyForwardCompleted(env);
+    }
 
     /* It is possible that we could end up with evacuate regions which were not compacted (inaccurate RSCL) so we need
      * to detect that case and sweep such regions, before completing the PGC */
@@ -1423,6 +1444,7 @@ void MM_IncrementalGenerationalGC::partialGarbageCollectUsingCopyForward(
     UDATA reclaimableRegions = 0;
     _reclaimDelegate.estimateReclaimableRegions(env, _schedulingDelegate.getAverageEmptinessOfCopyForwardedRegions(),
         &reclaimableRegions, &defragmentReclaimableRegions);
+    releaseColdFreeRegions(env);
     _schedulingDelegate.partialGarbageCollectCompleted(env, reclaimableRegions, defragmentReclaimableRegions);
 
     if (_extensions->tarokUseProjectedSurvivalCollectionSet) {
@@ -1485,7 +1507,8 @@ void MM_IncrementalGenerationalGC::partialGarbageCollectUsingMarkCompact(
     declareAllRegionsAsMarked(env);
 
     /* this considers regions that are marked&swept since last GMP */
-    UDATA compactSelectionGoalInBytes = _schedulingDelegate.getDesiredCompactWork();
+    UDATA compactSelectionGoalInBytes
+        = _schedulingDelegate.takeCompactWorkForIncrement(env, _schedulingDelegate.getDesiredCompactWork());
     {
         Trc_MM_ReclaimDelegate_runReclaimComplete_Entry(env->getLanguageVMThread(), compactSelectionGoalInBytes, 0);
         _reclaimDelegate.runReclaimCompleteSweep(
@@ -1501,6 +1524,7 @@ void MM_IncrementalGenerationalGC::partialGarbageCollectUsingMarkCompact(
     UDATA reclaimableRegions = 0;
     _reclaimDelegate.estimateReclaimableRegions(
         env, 0.0 /* copy-forward loss */, &reclaimableRegions, &defragmentReclaimableRegions);
+    releaseColdFreeRegions(env);
     _schedulingDelegate.partialGarbageCollectCompleted(env, reclaimableRegions, defragmentReclaimableRegions);
 
     if (_extensions->tarokUseProjectedSurvivalCollectionSet) {
@@ -1529,6 +1553,26 @@ void MM_IncrementalGenerationalGC::setupBeforePartialGC(MM_EnvironmentVLHGC* env
     setupBeforeGC(env);
 }
 
+void MM_IncrementalGenerationalGC::releaseColdFreeRegions(MM_EnvironmentVLHGC* env)
+{
+    /* an idle GC always releases the free regions, otherwise enabling idle GC for balanced would gain nothing */
+    bool isIdleGC = (J9MMCONSTANT_EXPLICIT_GC_IDLE_GC == env->_cycleState->_gcCode.getCode());
+    if (_extensions->tarokReleaseColdFreeRegions || isIdleGC) {
+        UDATA maxBytes = _extensions->tarokFreeRegionReleaseMaxBytes;
+        UDATA coldCycles = _extensions->tarokFreeRegionColdCycles;
+        if (isIdleGC) {
+            /* the application has gone idle so nothing it will allocate soon is worth keeping resident */
+            maxBytes = UDATA_MAX;
+            coldCycles = 0;
+        }
+        MM_HeapRegionManagerVLHGC* regionManager = (MM_HeapRegionManagerVLHGC*)_extensions->heapRegionManager;
+        MM_VLHGCIncrementStats* incrementStats
+            = &static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats;
+        incrementStats->_heapBytesReleased = regionManager->releaseColdFreeRegions(
+            env, maxBytes, coldCycles, &_extensions->heapResidentSavingsBytes);
+    }
+}
+
 void MM_IncrementalGenerationalGC::setupBeforeGlobalGC(MM_EnvironmentVLHGC* env, MM_GCCode gcCode)
 {
     /* ensure heap base is aligned to region size */
@@ -1991,6 +2035,16 @@ void MM_IncrementalGenerationalGC::reportCopyForwardEnd(MM_EnvironmentVLHGC* env
 }
 
 bool MM_IncrementalGenerationalGC::isConcurrentWorkAvailable(MM_EnvironmentBase* env)
+{
+    /* dirty card refinement fills the time between PGCs, but only when there is no GMP since the GMP rebuilds (and
+     * relies on the state of) the cards and RSCLs itself */
+    bool isRefinementAvailable = _concurrentRefinementDelegate.isRefinementEnabled() && !isGlobalMarkPhaseRunning()
+        && !_forceConcurrentTermination;
+
+    return isConcurrentGMPWorkAvailable(env) || isRefinementAvailable;
+}
+
+bool MM_IncrementalGenerationalGC::isConcurrentGMPWorkAvailable(MM_EnvironmentBase* env)
 {
     bool isConcurrentEnabled = _extensions->tarokEnableConcurrentGMP;
     bool isGMPRunning = isGlobalMarkPhaseRunning();
@@ -2009,6 +2063,12 @@ void MM_IncrementalGenerationalGC::preConcurrentInitializeStatsAndReport(
     Assert_MM_true(isConcurrentWorkAvailable(env));
     PORT_ACCESS_FROM_ENVIRONMENT(env);
 
+    /* concurrent refinement is an implementation detail of the PGC so it isn't reported as a concurrent phase */
+    _concurrentWorkIsGMP = isConcurrentGMPWorkAvailable(env);
+    if (!_concurrentWorkIsGMP) {
+        return;
+    }
+
     stats->_cycleID = _persistentGlobalMarkPhaseState._verboseContextID;
     stats->_scanTargetInBytes = _globalMarkPhaseIncrementBytesStillToScan;
     TRIGGER_J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_START(_extensions->privateHookInterface, env->getOmrVMThread(),
@@ -2023,6 +2083,16 @@ uintptr_t MM_IncrementalGenerationalGC::masterThreadConcurrentCollect(MM_Environ
      * _forceConcurrentTermination since the master thread calls this outside of the control monitor
      */
     Assert_MM_true(NULL == env->_cycleState);
+    if (!_concurrentWorkIsGMP) {
+        Assert_MM_false(isGlobalMarkPhaseRunning());
+        /* the list of newly overflowed RSCLs only lives for one operation and must be empty when the next PGC starts */
+        _interRegionRememberedSet->resetOverflowedList();
+        _concurrentRefinementDelegate.refineConcurrently(
+            env, _markMapManager->getPartialGCMap(), &_forceConcurrentTermination);
+        _interRegionRememberedSet->resetOverflowedList();
+        _interRegionRememberedSet->releaseCardBufferControlBlockListForThread(env, env);
+        return 0;
+    }
     Assert_MM_true(isGlobalMarkPhaseRunning());
     Assert_MM_true(MM_CycleState::state_process_work_packets_after_initial_mark
         == _persistentGlobalMarkPhaseState._markDelegateState);
@@ -2060,6 +2130,10 @@ void MM_IncrementalGenerationalGC::postConcurrentUpdateStatsAndReport(
     Assert_MM_false(isConcurrentWorkAvailable(env));
     PORT_ACCESS_FROM_ENVIRONMENT(env);
 
+    if (!_concurrentWorkIsGMP) {
+        return;
+    }
+
     stats->_bytesScanned = bytesConcurrentlyScanned;
     stats->_terminationWasRequested = _forceConcurrentTermination;
     TRIGGER_J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_END(_extensions->privateHookInterface, env->getOmrVMThread(),
@@ -2072,6 +2146,7 @@ void MM_IncrementalGenerationalGC::forceConcurrentFinish()
      * return early by setting this flag.
      */
     _forceConcurrentTermination = true;
+    _concurrentRefinementDelegate.notifyRefinement();
 }
 
 void MM_IncrementalGenerationalGC::reportGMPCycleStart(MM_EnvironmentBase* env)
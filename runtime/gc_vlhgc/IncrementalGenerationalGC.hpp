@@ -36,6 +36,7 @@
 #include "CollectionSetDelegate.hpp"
 #include "CollectionStatisticsVLHGC.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
+#include "ConcurrentRefinementDelegate.hpp"
 #include "CopyForwardDelegate.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentVLHGC.hpp"
@@ -99,6 +100,8 @@ private:
     MM_ProjectedSurvivalCollectionSetDelegate
         _projectedSurvivalCollectionSetDelegate; /** Collection set delegate based on using a region's projected
                                                     survival rate in order to select collection set */
+    MM_ConcurrentRefinementDelegate _concurrentRefinementDelegate; /**< Delegate which refines dirty cards into RSCLs
+                                                                      on the master GC thread between PGCs */
 
     MM_CollectionStatisticsVLHGC
         _globalCollectionStatistics; /** Common collect stats (memory, time etc.), specifically for Global collects */
@@ -122,6 +125,8 @@ private:
         _forceConcurrentTermination; /**< Setting this to true will cause any concurrent GMP work being done for this
                                         collector to stop and return.  It is volatile because it is shared state between
                                         this and the concurren task's increment manager */
+    bool _concurrentWorkIsGMP; /**< True if the concurrent work started by the master GC thread is GMP marking, false
+                                  if it is dirty card refinement */
 
     UDATA _globalMarkPhaseIncrementBytesStillToScan; /**< The number of bytes which must be scanned in the next GMP
                                                         increment.  This is used by the concurrent GMP task to determine
@@ -338,6 +343,13 @@ public:
      */
     void setupBeforePartialGC(MM_EnvironmentVLHGC* env, MM_GCCode gcCode);
     void setupBeforeGlobalGC(MM_EnvironmentVLHGC* env, MM_GCCode gcCode);
+
+    /**
+     * Return the pages of regions which have stayed free across several GCs to the operating system, if enabled.
+     * An idle GC releases every free region, without a limit, even if the release is not enabled for other GCs.
+     * @param env[in] The master GC thread
+     */
+    void releaseColdFreeRegions(MM_EnvironmentVLHGC* env);
     /**
      * @return True if the global mark phase has active persistent data stored in the collector
      */
@@ -401,6 +413,11 @@ public:
      */
     virtual bool isConcurrentWorkAvailable(MM_EnvironmentBase* env);
 
+    /**
+     * @return true if the collector has concurrent GMP marking work pending (as opposed to concurrent refinement)
+     */
+    bool isConcurrentGMPWorkAvailable(MM_EnvironmentBase* env);
+
     /**
      * Called by the MasterGCThread while it still owns the GC control monitor in order to allow for the initial
      * population of stats and reporting of triggers to occur in-order relative to threads outside the GC.
@@ -411,8 +428,8 @@ public:
     virtual void preConcurrentInitializeStatsAndReport(MM_EnvironmentBase* env, MM_ConcurrentPhaseStatsBase* stats);
 
     /**
-     * The entry-point used by the master GC thread to perform concurrent GMP work.  isConcurrentWorkAvailable must be
-     * true.
+     * The entry-point used by the master GC thread to perform concurrent GMP work (or, if there is none, dirty card
+     * refinement).  isConcurrentWorkAvailable must be true.
      * @param env[in] The master GC thread
      * @return The number of bytes scanned by this invocation of the concurrent task
      */
@@ -687,6 +687,14 @@ void MM_InterRegionRememberedSet::rememberReferenceForCompactInternal(
     rememberReferenceInternal(env, fromObject, toRegion);
 }
 
+void MM_InterRegionRememberedSet::rememberReferenceForRefinementInternal(
+    MM_EnvironmentVLHGC* env, J9Object* fromObject, J9Object* toObject)
+{
+    MM_HeapRegionDescriptorVLHGC* toRegion
+        = (MM_HeapRegionDescriptorVLHGC*)_heapRegionManager->tableDescriptorForAddress(toObject);
+    rememberReferenceInternal(env, fromObject, toRegion);
+}
+
 void MM_InterRegionRememberedSet::rememberReferenceForCopyForwardInternal(
     MM_EnvironmentVLHGC* env, J9Object* fromObject, J9Object* toObject)
 {
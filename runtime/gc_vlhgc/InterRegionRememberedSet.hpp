@@ -148,6 +148,13 @@ private:
      */
     void rememberReferenceForCopyForwardInternal(MM_EnvironmentVLHGC* env, J9Object* fromObject, J9Object* toObject);
 
+    /**
+     * Out-of-line implementation of rememberReferenceForRefinement()
+     * @param fromObject object (its slot) pointing from (must not be NULL)
+     * @param toObject object being pointed (must not be NULL and must be in a different region than fromObject)
+     */
+    void rememberReferenceForRefinementInternal(MM_EnvironmentVLHGC* env, J9Object* fromObject, J9Object* toObject);
+
     /**
      * Check should card be treated as dirty
      * @param env current thread environment
@@ -376,6 +383,26 @@ public:
         }
     }
 
+    /**
+     * During concurrent refinement of dirty cards (between PGCs, with no GMP in progress), remember reference from an
+     * object to an object (or appropriate structure (like card or region) the object belongs to).
+     * Unlike the other variants, this does not consult the cycle state since no collection is in progress.
+     * @param fromObject object (its slot) pointing from
+     * @param toObject object being pointed
+     */
+    MMINLINE void rememberReferenceForRefinement(MM_EnvironmentVLHGC* env, J9Object* fromObject, J9Object* toObject)
+    {
+        if (NULL != toObject) {
+            /* We use the XOR and region mask of object pointers to determine if the objects share the same region.
+             * Getting the region descriptors for comparison is a much more expensive operation (and reserved for when
+             * we have identified the objects as being from different regions)
+             */
+            if ((((UDATA)fromObject) ^ ((UDATA)toObject)) >= _regionSize) {
+                rememberReferenceForRefinementInternal(env, fromObject, toObject);
+            }
+        }
+    }
+
     /**
      * Gets the remembered set card which the object belongs to
      * @param object the object who's remembered set card we wish to obtain
@@ -36,7 +36,9 @@
 #include "ProjectedSurvivalCollectionSetDelegate.hpp"
 #include "CompactGroupManager.hpp"
 #include "CompactGroupPersistentStats.hpp"
+#include "CopyForwardStats.hpp"
 #include "CycleState.hpp"
+#include "CycleStateVLHGC.hpp"
 #include "EnvironmentVLHGC.hpp"
 #include "GlobalAllocationManagerTarok.hpp"
 #include "MemorySubSpace.hpp"
@@ -48,6 +50,11 @@
 #include "MarkMap.hpp"
 #include "MemoryPoolBumpPointer.hpp"
 #include "RegionValidator.hpp"
+#include "RememberedSetCardBucket.hpp"
+#include "RememberedSetCardList.hpp"
+
+/* arbitrarily give 70% weight to historical observations, 30% to the newest one (as the scheduling delegate does) */
+const double evacuationCostHistoricWeight = 0.70;
 
 MM_ProjectedSurvivalCollectionSetDelegate::MM_ProjectedSurvivalCollectionSetDelegate(
     MM_EnvironmentBase* env, MM_HeapRegionManager* manager)
@@ -57,6 +64,16 @@ MM_ProjectedSurvivalCollectionSetDelegate::MM_ProjectedSurvivalCollectionSetDele
     , _setSelectionDataTable(NULL)
     , _dynamicSelectionList(NULL)
     , _dynamicSelectionRegionList(NULL)
+    , _evacuationCostMeasured(false)
+    , _evacuationMicrosPerByte(0.0)
+    , _evacuationMicrosPerCard(0.0)
+    , _evacuationSumBytesBytes(0.0)
+    , _evacuationSumBytesCards(0.0)
+    , _evacuationSumCardsCards(0.0)
+    , _evacuationSumBytesMicros(0.0)
+    , _evacuationSumCardsMicros(0.0)
+    , _collectionSetCardCount(0)
+    , _nurseryEvacuationCostMicros(0.0)
 {
     _typeId = __FUNCTION__;
 }
@@ -136,6 +153,27 @@ int MM_ProjectedSurvivalCollectionSetDelegate::compareRateOfReturnScoreFunc(cons
     }
 }
 
+/**
+ * Helper function used by J9_SORT to sort regions by reclaim per unit of evacuation cost.
+ */
+int MM_ProjectedSurvivalCollectionSetDelegate::compareEvacuationEfficiencyScoreFunc(
+    const void* element1, const void* element2)
+{
+    MM_HeapRegionDescriptorVLHGC* region1 = *(MM_HeapRegionDescriptorVLHGC**)element1;
+    MM_HeapRegionDescriptorVLHGC* region2 = *(MM_HeapRegionDescriptorVLHGC**)element2;
+
+    /* one extra microsecond keeps regions the model predicts as free from dividing by zero */
+    double efficiency1 = (double)region1->getProjectedReclaimableBytes() / (region1->_evacuationCostMicros + 1.0);
+    double efficiency2 = (double)region2->getProjectedReclaimableBytes() / (region2->_evacuationCostMicros + 1.0);
+    if (efficiency1 == efficiency2) {
+        return 0;
+    } else if (efficiency1 < efficiency2) {
+        return 1;
+    } else {
+        return -1;
+    }
+}
+
 /**
  * Helper function used by J9_SORT to sort core sample element lists.
  */
@@ -186,6 +224,9 @@ MM_ProjectedSurvivalCollectionSetDelegate::createNurseryCollectionSet(MM_Environ
                     /* sweep/compact flags are set in ReclaimDelegate */
                     selectRegion(env, region);
                     nurseryRegionCount += 1;
+                    if (isEvacuationCostSelectionActive(env)) {
+                        _nurseryEvacuationCostMicros += predictEvacuationCostMicros(region);
+                    }
                 } else {
                     Assert_MM_true(!region->isEden());
                 }
@@ -222,6 +263,7 @@ void MM_ProjectedSurvivalCollectionSetDelegate::selectRegion(
     region->_compactData._shouldCompact = false;
     region->_defragmentationTarget = false;
 
+    _collectionSetCardCount += estimateRememberedSetCardCount(region);
     _extensions->compactGroupPersistentStats[compactGroup]._regionsInRegionCollectionSetForPGC += 1;
 
     Trc_MM_CollectionSetDelegate_selectRegionsForBudget(env->getLanguageVMThread(), tableIndex, compactGroup,
@@ -266,6 +308,7 @@ void MM_ProjectedSurvivalCollectionSetDelegate::createRateOfReturnCollectionSet(
     /* Build and sort the rate of return list into budget consumption priority order */
     UDATA sortListSize = 0;
     MM_HeapRegionManager* regionManager = _extensions->heapRegionManager;
+    bool costSelection = isEvacuationCostSelectionActive(env);
 
     GC_HeapRegionIteratorVLHGC regionIterator(regionManager);
     MM_HeapRegionDescriptorVLHGC* region = NULL;
@@ -279,6 +322,9 @@ void MM_ProjectedSurvivalCollectionSetDelegate::createRateOfReturnCollectionSet(
                 if (region->getRememberedSetCardList()->isAccurate()
                     && (!isSelectionForCopyForward || !regionHasCriticalRegions
                            || (regionHasCriticalRegions && region->isEden()))) {
+                    if (costSelection) {
+                        region->_evacuationCostMicros = predictEvacuationCostMicros(region);
+                    }
                     _dynamicSelectionRegionList[sortListSize] = region;
                     sortListSize += 1;
                 }
@@ -286,16 +332,32 @@ void MM_ProjectedSurvivalCollectionSetDelegate::createRateOfReturnCollectionSet(
         }
     }
 
-    J9_SORT(
-        _dynamicSelectionRegionList, sortListSize, sizeof(MM_HeapRegionDescriptorVLHGC*), compareRateOfReturnScoreFunc);
+    /* With a cost model, a region which reclaims a lot but is expensive to evacuate (hot, highly referenced) ranks
+     * below cheaper regions which reclaim almost as much */
+    J9_SORT(_dynamicSelectionRegionList, sortListSize, sizeof(MM_HeapRegionDescriptorVLHGC*),
+        costSelection ? compareEvacuationEfficiencyScoreFunc : compareRateOfReturnScoreFunc);
 
     /* Walk the region priority list and select regions based on remaining available budget */
     UDATA regionBudget = 0;
+    double evacuationBudgetMicros = 0.0;
     if (0 != _extensions->tarokDynamicCollectionSetSelectionAbsoluteBudget) {
         regionBudget = _extensions->tarokDynamicCollectionSetSelectionAbsoluteBudget;
+    } else if (costSelection) {
+        /* the pause budget below replaces the region count budget */
+        regionBudget = sortListSize;
     } else {
         regionBudget = (UDATA)(nurseryRegionCount * _extensions->tarokDynamicCollectionSetSelectionPercentageBudget);
     }
+    if (costSelection) {
+        /* spend the same fraction of the nursery's evacuation time as the region budget spends of its region count */
+        evacuationBudgetMicros
+            = _nurseryEvacuationCostMicros * _extensions->tarokDynamicCollectionSetSelectionPercentageBudget;
+        if (0 != _extensions->tarokTargetMaxPauseTime) {
+            double pauseTargetMicros = (double)_extensions->tarokTargetMaxPauseTime * 1000.0;
+            double remainingPauseMicros = OMR_MAX(0.0, pauseTargetMicros - _nurseryEvacuationCostMicros);
+            evacuationBudgetMicros = OMR_MIN(evacuationBudgetMicros, remainingPauseMicros);
+        }
+    }
 
     Trc_MM_CollectionSetDelegate_createRegionCollectionSetForPartialGC_dynamicRegionSelectionBudget(
         env->getLanguageVMThread(), nurseryRegionCount, regionBudget);
@@ -307,12 +369,21 @@ void MM_ProjectedSurvivalCollectionSetDelegate::createRateOfReturnCollectionSet(
         UDATA regionSize = _regionManager->getRegionSize();
         UDATA projectedReclaimableBytes = region->getProjectedReclaimableBytes();
         double projectedReclaimableBytesFraction = (double)projectedReclaimableBytes / (double)regionSize;
+        bool selectable = (projectedReclaimableBytesFraction > _extensions->tarokCopyForwardFragmentationTarget);
+
+        if (selectable && costSelection) {
+            /* Greedily fill the pause budget; a cheaper region further down the list may still fit */
+            selectable = (region->_evacuationCostMicros <= evacuationBudgetMicros);
+        }
 
-        if (projectedReclaimableBytesFraction > _extensions->tarokCopyForwardFragmentationTarget) {
+        if (selectable) {
             selectRegion(env, region);
             _setSelectionDataTable[compactGroup]._dynamicSelectionThisCycle = true;
             regionBudget -= 1;
-        } else {
+            if (costSelection) {
+                evacuationBudgetMicros -= region->_evacuationCostMicros;
+            }
+        } else if (!costSelection) {
             /* Since _dynamicSelectionRegionList is sorted by projectedReclaimableBytes, they'll be no more regions to
              * select so break */
             break;
@@ -405,6 +476,9 @@ void MM_ProjectedSurvivalCollectionSetDelegate::createRegionCollectionSetForPart
 
     bool dynamicCollectionSet = _extensions->tarokEnableDynamicCollectionSetSelection;
 
+    _collectionSetCardCount = 0;
+    _nurseryEvacuationCostMicros = 0.0;
+
     /* If dynamic collection sets are enabled, reset all related data structures that are used for selection */
     if (dynamicCollectionSet) {
         MM_CompactGroupPersistentStats* persistentStats = _extensions->compactGroupPersistentStats;
@@ -450,6 +524,77 @@ void MM_ProjectedSurvivalCollectionSetDelegate::createRegionCollectionSetForPart
     }
 }
 
+UDATA
+MM_ProjectedSurvivalCollectionSetDelegate::estimateRememberedSetCardCount(MM_HeapRegionDescriptorVLHGC* region)
+{
+    return region->getRememberedSetCardList()->getBufferCount() * MM_RememberedSetCardBucket::MAX_BUFFER_SIZE;
+}
+
+double MM_ProjectedSurvivalCollectionSetDelegate::predictEvacuationCostMicros(MM_HeapRegionDescriptorVLHGC* region)
+{
+    UDATA liveBytes = OMR_MIN(region->_projectedLiveBytes, _regionManager->getRegionSize());
+    UDATA cardCount = estimateRememberedSetCardCount(region);
+
+    return ((double)liveBytes * _evacuationMicrosPerByte) + ((double)cardCount * _evacuationMicrosPerCard);
+}
+
+bool MM_ProjectedSurvivalCollectionSetDelegate::isEvacuationCostSelectionActive(MM_EnvironmentVLHGC* env)
+{
+    return _evacuationCostMeasured && env->_cycleState->_shouldRunCopyForward;
+}
+
+void MM_ProjectedSurvivalCollectionSetDelegate::copyForwardCompleted(MM_EnvironmentVLHGC* env)
+{
+    PORT_ACCESS_FROM_ENVIRONMENT(env);
+    MM_VLHGCIncrementStats* incrementStats = &static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats;
+    MM_CopyForwardStats* copyForwardStats = &incrementStats->_copyForwardStats;
+
+    /* an aborted copy-forward stops evacuating part way, so its time says nothing about the cost of the whole set */
+    if (!copyForwardStats->_aborted && (0 != copyForwardStats->_copyBytesTotal)) {
+        U_64 copyForwardMicros = j9time_hires_delta(
+            copyForwardStats->_startTime, copyForwardStats->_endTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+        U_64 referenceClearingMicros = incrementStats->_irrsStats._clearFromRegionReferencesTimesus;
+        /* reference clearing scales with the heap, not with the collection set */
+        if (copyForwardMicros > referenceClearingMicros) {
+            copyForwardMicros -= referenceClearingMicros;
+        }
+
+        double bytes = (double)copyForwardStats->_copyBytesTotal;
+        double cards = (double)_collectionSetCardCount;
+        double micros = (double)copyForwardMicros;
+
+        _evacuationSumBytesBytes = (_evacuationSumBytesBytes * evacuationCostHistoricWeight) + (bytes * bytes);
+        _evacuationSumBytesCards = (_evacuationSumBytesCards * evacuationCostHistoricWeight) + (bytes * cards);
+        _evacuationSumCardsCards = (_evacuationSumCardsCards * evacuationCostHistoricWeight) + (cards * cards);
+        _evacuationSumBytesMicros = (_evacuationSumBytesMicros * evacuationCostHistoricWeight) + (bytes * micros);
+        _evacuationSumCardsMicros = (_evacuationSumCardsMicros * evacuationCostHistoricWeight) + (cards * micros);
+
+        /* solve the 2x2 normal equations for (micros per byte, micros per card) */
+        double microsPerByte = 0.0;
+        double microsPerCard = 0.0;
+        double determinant = (_evacuationSumBytesBytes * _evacuationSumCardsCards)
+            - (_evacuationSumBytesCards * _evacuationSumBytesCards);
+        if (determinant > (1.0e-6 * _evacuationSumBytesBytes * _evacuationSumCardsCards)) {
+            microsPerByte = ((_evacuationSumBytesMicros * _evacuationSumCardsCards)
+                                - (_evacuationSumCardsMicros * _evacuationSumBytesCards))
+                / determinant;
+            microsPerCard = ((_evacuationSumCardsMicros * _evacuationSumBytesBytes)
+                                - (_evacuationSumBytesMicros * _evacuationSumBytesCards))
+                / determinant;
+        }
+        if ((microsPerByte <= 0.0) || (microsPerCard < 0.0)) {
+            /* the history can't separate the two costs (e.g. card counts proportional to bytes) so charge it all to
+             * the copied bytes */
+            microsPerByte = _evacuationSumBytesMicros / _evacuationSumBytesBytes;
+            microsPerCard = 0.0;
+        }
+
+        _evacuationMicrosPerByte = microsPerByte;
+        _evacuationMicrosPerCard = microsPerCard;
+        _evacuationCostMeasured = true;
+    }
+}
+
 void MM_ProjectedSurvivalCollectionSetDelegate::deleteRegionCollectionSetForPartialGC(MM_EnvironmentVLHGC* env)
 {
     Assert_MM_true(MM_CycleState::CT_PARTIAL_GARBAGE_COLLECTION == env->_cycleState->_collectionType);
@@ -149,6 +149,20 @@ private:
     MM_HeapRegionDescriptorVLHGC**
         _dynamicSelectionRegionList; /**< Pointer table used for sorting or iterating over regions */
 
+    /* Evacuation cost model: copy-forward time ~= (live bytes * _evacuationMicrosPerByte) + (remembered cards *
+     * _evacuationMicrosPerCard), fitted by decayed least squares over past copy-forward PGCs */
+    bool _evacuationCostMeasured; /**< True once a copy-forward PGC has been observed and the model can be used */
+    double _evacuationMicrosPerByte; /**< Predicted copy-forward time per live byte in the collection set */
+    double _evacuationMicrosPerCard; /**< Predicted copy-forward time per remembered set card of the collection set */
+    double _evacuationSumBytesBytes; /**< Decayed sum of bytes^2 over observed PGCs */
+    double _evacuationSumBytesCards; /**< Decayed sum of bytes*cards over observed PGCs */
+    double _evacuationSumCardsCards; /**< Decayed sum of cards^2 over observed PGCs */
+    double _evacuationSumBytesMicros; /**< Decayed sum of bytes*time over observed PGCs */
+    double _evacuationSumCardsMicros; /**< Decayed sum of cards*time over observed PGCs */
+    UDATA _collectionSetCardCount; /**< Estimated remembered set cards of all regions selected for the current PGC */
+    double _nurseryEvacuationCostMicros; /**< Predicted time to evacuate the nursery part of the current collection set
+                                          */
+
 protected:
 public:
     /* Member Functions */
@@ -200,6 +214,27 @@ private:
      */
     void createCoreSamplingCollectionSet(MM_EnvironmentVLHGC* env, UDATA nurseryRegionCount);
 
+    /**
+     * Estimate the number of cards in the remembered set of the specified region.  This is an upper bound derived from
+     * the buffer count, which is cheap enough to query for every candidate region.
+     * @param region[in] The region to examine
+     * @return The estimated number of remembered cards
+     */
+    UDATA estimateRememberedSetCardCount(MM_HeapRegionDescriptorVLHGC* region);
+
+    /**
+     * Predict the time it would take copy-forward to evacuate the specified region, from its projected live bytes and
+     * the size of its remembered set.
+     * @param region[in] The region to examine
+     * @return The predicted evacuation time, in microseconds
+     */
+    double predictEvacuationCostMicros(MM_HeapRegionDescriptorVLHGC* region);
+
+    /**
+     * @return true if the collection set should be filled up to a pause budget using the evacuation cost model
+     */
+    bool isEvacuationCostSelectionActive(MM_EnvironmentVLHGC* env);
+
     /**
      * Given the specified region, return the next region.
      * If the region is NULL, or the last region in the table, return the first region.
@@ -216,6 +251,15 @@ private:
      */
     static int compareRateOfReturnScoreFunc(const void* element1, const void* element2);
 
+    /**
+     * Helper function used by J9_SORT to sort regions by projected reclaimable bytes per predicted microsecond of
+     * evacuation.
+     *
+     * @param[in] element1 first element to compare
+     * @param[in] element2 second element to compare
+     */
+    static int compareEvacuationEfficiencyScoreFunc(const void* element1, const void* element2);
+
     /**
      * Helper function used by J9_SORT to sort core sample element lists.
      *
@@ -272,6 +316,13 @@ public:
      */
     void deleteRegionCollectionSetForGlobalGC(MM_EnvironmentVLHGC* env);
 
+    /**
+     * Update the evacuation cost model with the time taken by the copy-forward which just completed.
+     * This should only be called after a copy-forward partial garbage collect.
+     * @param env[in] The master GC thread
+     */
+    void copyForwardCompleted(MM_EnvironmentVLHGC* env);
+
     /**
      * Record pre-sweep region information in order to calculate rate of return on tracing for age groups.
      */
@@ -60,6 +60,7 @@ const double measureScanRateHistoricWeightForPGC = 0.95;
 const double partialGCTimeHistoricWeight = 0.80;
 const double incrementalScanTimePerGMPHistoricWeight = 0.50;
 const double bytesScannedConcurrentlyPerGMPHistoricWeight = 0.50;
+const double partialGCOverheadHistoricWeight = 0.70;
 
 MM_SchedulingDelegate::MM_SchedulingDelegate(MM_EnvironmentVLHGC* env, MM_HeapRegionManager* manager)
     : MM_BaseNonVirtual()
@@ -100,6 +101,9 @@ MM_SchedulingDelegate::MM_SchedulingDelegate(MM_EnvironmentVLHGC* env, MM_HeapRe
     , _partialGcStartTime(0)
     , _historicalPartialGCTime(0)
     , _dynamicGlobalMarkIncrementTimeMillis(50)
+    , _copyForwardRateMeasured(false)
+    , _averagePartialGCOverheadMicros(0.0)
+    , _deferredCompactWork(0)
     , _scanRateStats()
 {
     _typeId = __FUNCTION__;
@@ -137,6 +141,9 @@ void MM_SchedulingDelegate::globalMarkPhaseCompleted(MM_EnvironmentVLHGC* env)
 
     _didGMPCompleteSinceLastReclaim = true;
 
+    /* compaction work deferred by earlier PGCs was based on the previous mark; the new mark data replaces it */
+    _deferredCompactWork = 0;
+
     _globalSweepRequired = true;
 
     _disableCopyForwardDuringCurrentGlobalMarkPhase = false;
@@ -160,6 +167,7 @@ void MM_SchedulingDelegate::globalGarbageCollectCompleted(
 
     /* Global GC will do full compact of the heap. No work is left for PGCs */
     _bytesCompactedToFreeBytesRatio = 0.0;
+    _deferredCompactWork = 0;
 
     /* since we did full sweep, there is no need for next PGC to do it again */
     _globalSweepRequired = false;
@@ -183,6 +191,14 @@ void MM_SchedulingDelegate::partialGarbageCollectStarted(MM_EnvironmentVLHGC* en
     /* Record the GC start time in order to track Partial GC times (and averages) over the course of the application
      * lifetime */
     _partialGcStartTime = j9time_hires_clock();
+
+    if (isPauseTimeTargetActive() && env->_cycleState->_shouldRunCopyForward) {
+        /* record the prediction for the Eden we are about to collect, so that verbose can compare it to the result */
+        MM_VLHGCIncrementStats* incrementStats
+            = &static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats;
+        incrementStats->_pauseTargetMillis = _extensions->tarokTargetMaxPauseTime;
+        incrementStats->_predictedPauseMicros = (U_64)predictPartialGCTimeMicros(_edenRegionCount);
+    }
 }
 
 void MM_SchedulingDelegate::determineNextPGCType(MM_EnvironmentVLHGC* env)
@@ -230,6 +246,12 @@ void MM_SchedulingDelegate::calculateGlobalMarkIncrementTimeMillis(MM_Environmen
         /* (note that we need to assume a mark increment took at least 1 millisecond or else we will divide by zero in
          * later calculations) */
         _dynamicGlobalMarkIncrementTimeMillis = OMR_MAX((UDATA)(_historicalPartialGCTime / 3), 1);
+        if (0 != _extensions->tarokTargetMaxPauseTime) {
+            /* GMP increments are pauses too, so they are held to the same target (unless the GMP is running late, see
+             * currentGlobalMarkIncrementTimeMillis()) */
+            _dynamicGlobalMarkIncrementTimeMillis
+                = OMR_MIN(_dynamicGlobalMarkIncrementTimeMillis, _extensions->tarokTargetMaxPauseTime);
+        }
     }
 }
 
@@ -277,6 +299,26 @@ void MM_SchedulingDelegate::partialGarbageCollectCompleted(
         if (copyForwardStats->_aborted && (0 == _remainingGMPIntermissionIntervals)) {
             _disableCopyForwardDuringCurrentGlobalMarkPhase = true;
         }
+
+        if ((0 != _extensions->tarokTargetMaxPauseTime) && !copyForwardStats->_aborted) {
+            /* whatever part of this PGC was not spent copying is treated as a fixed cost when predicting the next one.
+             * Reference clearing is excluded from the copy-forward rate, so it is counted here instead. */
+            U_64 partialGcMicros
+                = j9time_hires_delta(_partialGcStartTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+            U_64 copyForwardMicros = j9time_hires_delta(
+                copyForwardStats->_startTime, copyForwardStats->_endTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+            U_64 referenceClearingMicros = static_cast<MM_CycleStateVLHGC*>(env->_cycleState)
+                                               ->_vlhgcIncrementStats._irrsStats._clearFromRegionReferencesTimesus;
+            U_64 copyingMicros = copyForwardMicros - OMR_MIN(copyForwardMicros, referenceClearingMicros);
+            double overheadMicros
+                = (partialGcMicros > copyingMicros) ? (double)(partialGcMicros - copyingMicros) : 0.0;
+            if (0.0 == _averagePartialGCOverheadMicros) {
+                _averagePartialGCOverheadMicros = overheadMicros;
+            } else {
+                _averagePartialGCOverheadMicros = (_averagePartialGCOverheadMicros * partialGCOverheadHistoricWeight)
+                    + (overheadMicros * (1.0 - partialGCOverheadHistoricWeight));
+            }
+        }
     } else {
         /* measure scan rate in PGC, only if we did M/S/C collect */
         measureScanRate(env, measureScanRateHistoricWeightForPGC);
@@ -290,6 +332,12 @@ void MM_SchedulingDelegate::partialGarbageCollectCompleted(
     /* Calculate the time spent in the current Partial GC */
     U_64 partialGcEndTime = j9time_hires_clock();
     U_64 pgcTime = j9time_hires_delta(_partialGcStartTime, partialGcEndTime, J9PORT_TIME_DELTA_IN_MILLISECONDS);
+    MM_VLHGCIncrementStats* incrementStats
+        = &static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats;
+    if (0 != incrementStats->_pauseTargetMillis) {
+        incrementStats->_actualPauseMicros
+            = j9time_hires_delta(_partialGcStartTime, partialGcEndTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+    }
     /* Clear the start time to be clear that we've used it */
     _partialGcStartTime = 0;
     calculateGlobalMarkIncrementTimeMillis(env, pgcTime);
@@ -897,12 +945,42 @@ MM_SchedulingDelegate::getDesiredCompactWork()
     UDATA desiredCompactWork = (UDATA)(
         _bytesCompactedToFreeBytesRatio * OMR_MAX(0.0, _regionConsumptionRate) * _regionManager->getRegionSize());
 
+    if (isPauseTimeTargetActive()) {
+        /* only take on as much of the GMP-driven compaction as the pause left over by Eden allows. The rest is deferred
+         * to later PGCs, or to the next GMP if the pauses never leave room for it */
+        double targetMicros = (double)_extensions->tarokTargetMaxPauseTime * 1000.0;
+        double spareMicros = targetMicros - predictPartialGCTimeMicros(_edenRegionCount);
+        UDATA compactBudget = (spareMicros > 0.0) ? (UDATA)(spareMicros * _averageCopyForwardRate) : 0;
+        desiredCompactWork = OMR_MIN(desiredCompactWork, compactBudget);
+    }
+
     /* defragmentation work (mostly) driven by compact group merging (maxAge - 1 into maxAge) */
     desiredCompactWork += (UDATA)_averageMacroDefragmentationWork;
 
     return desiredCompactWork;
 }
 
+UDATA
+MM_SchedulingDelegate::takeCompactWorkForIncrement(MM_EnvironmentVLHGC* env, UDATA desiredCompactWork)
+{
+    UDATA increments = _extensions->tarokIncrementalCompactIncrements;
+    UDATA compactWork = desiredCompactWork;
+
+    if (increments > 1) {
+        UDATA pendingCompactWork = _deferredCompactWork + desiredCompactWork;
+        compactWork = pendingCompactWork / increments;
+        /* don't let the tail of the deferred work dwindle into increments too small to free a region */
+        compactWork = OMR_MIN(pendingCompactWork, OMR_MAX(compactWork, _regionManager->getRegionSize()));
+        _deferredCompactWork = pendingCompactWork - compactWork;
+    }
+
+    MM_VLHGCIncrementStats* incrementStats = &static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats;
+    incrementStats->_compactWorkSelectedBytes = compactWork;
+    incrementStats->_compactWorkDeferredBytes = _deferredCompactWork;
+
+    return compactWork;
+}
+
 bool MM_SchedulingDelegate::isFirstPGCAfterGMP() { return _didGMPCompleteSinceLastReclaim; }
 
 void MM_SchedulingDelegate::firstPGCAfterGMPCompleted() { _didGMPCompleteSinceLastReclaim = false; }
@@ -934,6 +1012,7 @@ void MM_SchedulingDelegate::copyForwardCompleted(MM_EnvironmentVLHGC* env)
     _averageSurvivorSetRegionCount
         = (_averageSurvivorSetRegionCount * historicWeight) + ((double)survivorSetRegionCount * (1.0 - historicWeight));
     _averageCopyForwardRate = (_averageCopyForwardRate * historicWeight) + (copyForwardRate * (1.0 - historicWeight));
+    _copyForwardRateMeasured = true;
 
     Trc_MM_SchedulingDelegate_copyForwardCompleted_efficiency(env->getLanguageVMThread(), bytesCopied, bytesDiscarded,
         (double)bytesDiscarded / (double)(bytesCopied + bytesDiscarded), _averageCopyForwardBytesCopied,
@@ -1032,6 +1111,19 @@ void MM_SchedulingDelegate::calculateEdenSize(MM_EnvironmentVLHGC* env)
     Assert_MM_true(edenMaximumCount >= 1);
     Assert_MM_true(edenMaximumCount >= edenMinimumCount);
 
+    if (isPauseTimeTargetActive()) {
+        /* size Eden from the pause target instead of the heap size, but never beyond -Xmnx */
+        UDATA edenLimitCount
+            = OMR_MAX(edenMinimumCount, (_extensions->tarokIdealEdenMaximumBytes + regionSize - 1) / regionSize);
+        UDATA pauseTargetCount = calculatePauseTargetEdenRegionCount(env);
+        if ((pauseTargetCount > _edenRegionCount) && (0 != _edenRegionCount)) {
+            /* grow gradually, since the survival rate of a larger Eden is extrapolated; shrink at once to meet the
+             * target */
+            pauseTargetCount = _edenRegionCount + ((pauseTargetCount - _edenRegionCount + 1) / 2);
+        }
+        edenMaximumCount = OMR_MIN(OMR_MAX(pauseTargetCount, edenMinimumCount), edenLimitCount);
+    }
+
     UDATA desiredEdenCount = freeRegions;
     if (desiredEdenCount > edenMaximumCount) {
         desiredEdenCount = edenMaximumCount;
@@ -1054,6 +1146,45 @@ void MM_SchedulingDelegate::calculateEdenSize(MM_EnvironmentVLHGC* env)
     Trc_MM_SchedulingDelegate_calculateEdenSize_Exit(env->getLanguageVMThread(), (_edenRegionCount * regionSize));
 }
 
+double MM_SchedulingDelegate::predictPartialGCTimeMicros(UDATA edenRegionCount) const
+{
+    double predictedMicros = _averagePartialGCOverheadMicros;
+
+    if (_averageCopyForwardRate > 0.0) {
+        double survivorRegions
+            = ((double)edenRegionCount * _edenSurvivalRateCopyForward) + (double)_nonEdenSurvivalCountCopyForward;
+        double survivorBytes = survivorRegions * (double)_regionManager->getRegionSize();
+        /* _averageCopyForwardRate is measured in bytes per microsecond */
+        predictedMicros += survivorBytes / _averageCopyForwardRate;
+    }
+
+    return predictedMicros;
+}
+
+UDATA
+MM_SchedulingDelegate::calculatePauseTargetEdenRegionCount(MM_EnvironmentVLHGC* env) const
+{
+    UDATA edenRegionCount = UDATA_MAX;
+    double targetMicros = (double)_extensions->tarokTargetMaxPauseTime * 1000.0;
+    /* invert predictPartialGCTimeMicros(): the time left once the fixed cost and the non-Eden survivors are paid for
+     * is spent copying Eden survivors */
+    double copyBudgetBytes = (targetMicros - _averagePartialGCOverheadMicros) * _averageCopyForwardRate;
+    double edenSurvivorBudgetRegions
+        = (copyBudgetBytes / (double)_regionManager->getRegionSize()) - (double)_nonEdenSurvivalCountCopyForward;
+
+    if (edenSurvivorBudgetRegions <= 0.0) {
+        /* even an empty Eden would miss the target, so use the smallest Eden we can */
+        edenRegionCount = 0;
+    } else if (_edenSurvivalRateCopyForward > 0.0) {
+        double edenRegions = edenSurvivorBudgetRegions / _edenSurvivalRateCopyForward;
+        if (edenRegions < (double)UDATA_MAX) {
+            edenRegionCount = (UDATA)edenRegions;
+        }
+    }
+
+    return edenRegionCount;
+}
+
 UDATA
 MM_SchedulingDelegate::currentGlobalMarkIncrementTimeMillis(MM_EnvironmentVLHGC* env) const
 {
@@ -104,6 +104,11 @@ private:
     UDATA _dynamicGlobalMarkIncrementTimeMillis; /**< The dynamically calculated current time to be spent per GMP
                                                     increment (subject to change over the course of the run) */
 
+    bool _copyForwardRateMeasured; /**< True once a copy-forward has completed, so pause predictions can use its rate */
+    double _averagePartialGCOverheadMicros; /**< Weighted average of the part of a copy-forward PGC not spent copying
+                                               (roots, remembered set and sweep work), in microseconds */
+    UDATA _deferredCompactWork; /**< Compaction work (in bytes) found by earlier PGCs which was left for later PGCs */
+
     struct MM_SchedulingDelegate_ScanRateStats {
         UDATA historicalBytesScanned; /**< Historical number of bytes scanned for mark operations */
         U_64 historicalScanMicroseconds; /**< Historical scan times for mark operations */
@@ -233,6 +238,30 @@ private:
      */
     void calculateGlobalMarkIncrementTimeMillis(MM_EnvironmentVLHGC* env, U_64 pgcTime);
 
+    /**
+     * Predict the time of a copy-forward PGC which collects the given number of Eden regions, from the average
+     * copy-forward rate, the survival rates and the average time a PGC spends on work other than copying.
+     * @param edenRegionCount[in] The number of Eden regions the PGC would collect
+     * @return The predicted PGC time, in microseconds
+     */
+    double predictPartialGCTimeMicros(UDATA edenRegionCount) const;
+
+    /**
+     * Calculate the largest Eden, in regions, whose predicted PGC time stays within tarokTargetMaxPauseTime.
+     * Only meaningful once a copy-forward rate has been measured.
+     * @param env[in] the master GC thread
+     * @return The number of Eden regions which fits the pause target (may be 0)
+     */
+    UDATA calculatePauseTargetEdenRegionCount(MM_EnvironmentVLHGC* env) const;
+
+    /**
+     * @return true if a PGC pause target is set and there is enough history to predict PGC times
+     */
+    bool isPauseTimeTargetActive() const
+    {
+        return (0 != _extensions->tarokTargetMaxPauseTime) && _copyForwardRateMeasured;
+    }
+
     /**
      * Updates the _edenSurvivalRateCopyForward and _nonEdenSurvivalCountCopyForward running averages by including
      * thisEdenSurvivalRate and thisNonEdenSurvivorCount, respectively, for a copy-forward which has just completed.
@@ -395,6 +424,17 @@ public:
      */
     UDATA getDesiredCompactWork();
 
+    /**
+     * Decide how much of the compaction work desired by this PGC it should actually do. With
+     * tarokIncrementalCompactIncrements above 1, the desired work is added to the work deferred by earlier PGCs and
+     * only that share of the total is returned; the rest is deferred again. A burst of (macro defragmentation) work is
+     * thus spread over several increments, while a steady stream of work is still done at the rate it arrives.
+     * @param env[in] the master GC thread
+     * @param desiredCompactWork[in] the result of getDesiredCompactWork() for this PGC
+     * @return bytes to be compacted by this PGC
+     */
+    UDATA takeCompactWorkForIncrement(MM_EnvironmentVLHGC* env, UDATA desiredCompactWork);
+
     /**
      * @return true if it is first PGC after GMP completed (so we can calculate compact-bytes/free-bytes ratio, etc.)
      */
@@ -1613,6 +1613,7 @@ public:
 #endif /* J9VM_GC_FINALIZATION */
         scanJNIGlobalReferences(env);
         scanStringTable(env);
+        scanStringDeduplicationTable(env);
         scanMonitorReferences(env);
         scanJNIWeakGlobalReferences(env);
 #if defined(J9VM_OPT_JVMTI)
@@ -320,6 +320,29 @@ zipCache_isCopied(J9ZipCache* zipCache);
 const char* zipCache_uniqueId(J9ZipCache* zipCache);
 #endif
 
+#if defined(J9VM_OPT_SHARED_CLASSES)
+/**
+ * @brief
+ * @param zipCache
+ * @param cacheData
+ * @param dataSize
+ * @return BOOLEAN
+ */
+BOOLEAN
+zipCache_isValidCopy(J9ZipCache* zipCache, void* cacheData, UDATA dataSize);
+#endif
+
+#if defined(J9VM_OPT_SHARED_CLASSES)
+/**
+ * @brief
+ * @param cacheData
+ * @param dataSize
+ * @return U_64
+ */
+U_64
+zipCache_copiedPopulateTime(void* cacheData, UDATA dataSize);
+#endif
+
 struct J9ZipFile;
 /**
  * @brief
@@ -162,6 +162,7 @@ typedef struct J9ZipCacheEntry {
     IDATA zipFileSize;
     I_64 zipTimeStamp;
     IDATA startCentralDir;
+    U_64 populateTime; /* microseconds spent reading the central directory into this cache */
     J9WSRP currentChunk;
     J9WSRP chunkActiveDir;
     struct J9ZipDirEntry root;
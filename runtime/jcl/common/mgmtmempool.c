@@ -458,6 +458,19 @@ jobject JNICALL Java_com_ibm_java_lang_management_internal_MemoryPoolMXBeanImpl_
     }
 }
 
+jlong JNICALL Java_com_ibm_java_lang_management_internal_MemoryPoolMXBeanImpl_getReleasedMemoryImpl(
+    JNIEnv* env, jobject beanInstance, jint id)
+{
+    jlong released = 0;
+    if (0 != (id & J9VM_MANAGEMENT_POOL_HEAP)) {
+        J9JavaVM* javaVM = ((J9VMThread*)env)->javaVM;
+
+        released = (jlong)javaVM->memoryManagerFunctions->j9gc_pool_released_memory(
+            javaVM, (id & J9VM_MANAGEMENT_POOL_HEAP_ID_MASK));
+    }
+    return released;
+}
+
 /* Helper to calculate memory usage of a segment list and do something with it.
         action:
                 0 - check peak and update if necessary, return a MemoryUsage object for the current usage
@@ -402,6 +402,7 @@ struct J9MM_IterateRegionDescriptor;
 struct J9MM_IterateSpaceDescriptor;
 struct J9MonitorEnterRecord;
 struct J9MonitorTableListEntry;
+struct J9MonitorTableLock;
 struct J9NativeLibrary;
 struct J9ObjectMonitor;
 struct J9ObjectMonitorInfo;
@@ -1236,19 +1237,15 @@ typedef struct J9SharedDataDescriptor {
 #define J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE 32
 #define J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE_OVERWRITE 64
 
+#define J9SHR_STARTUPHINTS_STARTUP_PAGES_WORDS 8
+
 typedef struct J9SharedStartupHintsDataDescriptor {
     UDATA flags;
     UDATA heapSize1;
     UDATA heapSize2;
-    UDATA unused1;
-    UDATA unused2;
-    UDATA unused3;
-    UDATA unused4;
-    UDATA unused5;
-    UDATA unused6;
-    UDATA unused7;
-    UDATA unused8;
-    UDATA unused9;
+    /* startupPages has one bit per startupPagesChunkSize bytes of the cache, set if the chunk was used in startup */
+    UDATA startupPagesChunkSize;
+    UDATA startupPages[J9SHR_STARTUPHINTS_STARTUP_PAGES_WORDS];
 } J9SharedStartupHintsDataDescriptor;
 
 typedef struct J9SharedLocalStartupHints {
@@ -1288,6 +1285,7 @@ typedef struct J9SharedClassJavacoreDataDescriptor {
     UDATA numTokens;
     UDATA numJclEntries;
     UDATA numZipCaches;
+    U_64 zipCachePopulateTime;
     UDATA numJitHints;
     UDATA numJitProfiles;
     UDATA numAotDataEntries;
@@ -1319,6 +1317,9 @@ typedef struct J9SharedClassJavacoreDataDescriptor {
     UDATA softMaxBytes;
     UDATA numStartupHints;
     UDATA startupHintBytes;
+    UDATA numLockedLookups;
+    UDATA numContendedLookups;
+    UDATA jitProfileBytesSaved;
 } J9SharedClassJavacoreDataDescriptor;
 
 typedef struct J9SharedStringFarm {
@@ -1711,6 +1712,14 @@ typedef struct J9MonitorTableListEntry {
     struct J9MonitorTableListEntry* next;
 } J9MonitorTableListEntry;
 
+/* Guards vm->monitorTables[i]. The counters are only updated while mutex is held. */
+typedef struct J9MonitorTableLock {
+    omrthread_monitor_t mutex;
+    UDATA lookupCount;
+    UDATA addCount;
+    UDATA contendedCount;
+} J9MonitorTableLock;
+
 typedef struct J9UnsafeMemoryBlock {
     struct J9UnsafeMemoryBlock* linkNext;
     struct J9UnsafeMemoryBlock* linkPrevious;
@@ -1727,6 +1736,13 @@ typedef struct J9ObjectMonitor {
     j9objectmonitor_t alternateLockword;
 #endif /* J9VM_THR_LOCK_NURSERY */
     U_32 hash;
+    /* Adaptive spinning state, only maintained when -Xthr:adaptObjectSpin is enabled */
+    U_32 spinBudgetShift;
+    U_32 spinWindowCount;
+    U_32 spinWindowAcquiredCount;
+    U_32 holdTimeEstimate;
+    UDATA spinAcquiredCount;
+    UDATA spinParkedCount;
 } J9ObjectMonitor;
 
 typedef struct J9ClassWalkState {
@@ -4418,6 +4434,7 @@ typedef struct J9MemoryManagerFunctions {
     UDATA (*j9gc_get_collector_id)(OMR_VMThread* omrVMThread);
     UDATA (*j9gc_pools_memory)(struct J9JavaVM* javaVM, UDATA poolIDs, UDATA* totals, UDATA* frees, BOOLEAN gcEnd);
     UDATA (*j9gc_pool_maxmemory)(struct J9JavaVM* javaVM, UDATA poolID);
+    UDATA (*j9gc_pool_released_memory)(struct J9JavaVM* javaVM, UDATA poolID);
     const char* (*j9gc_get_gc_action)(struct J9JavaVM* javaVM, UDATA gcID);
     const char* (*j9gc_get_gc_cause)(struct OMR_VMThread* omrVMthread);
     J9HookInterface** (*j9gc_get_private_hook_interface)(struct J9JavaVM* javaVM);
@@ -5675,6 +5692,8 @@ typedef struct J9JavaVM {
     UDATA thrNestedSpinning;
     UDATA thrTryEnterNestedSpinning;
     UDATA thrDeflationPolicy;
+    UDATA thrAdaptiveObjectSpin;
+    UDATA thrAdaptiveObjectSpinHoldTime;
     UDATA gcOptions;
     UDATA (*unhookVMEvent)(struct J9JavaVM* javaVM, UDATA eventNumber, void* currentHandler, void* oldHandler);
     UDATA classLoadingMaxStack;
@@ -5714,6 +5733,7 @@ typedef struct J9JavaVM {
     struct J9HashTable** monitorTables;
     UDATA monitorTableCount;
     omrthread_monitor_t monitorTableMutex;
+    struct J9MonitorTableLock* monitorTableLocks;
     struct J9MonitorTableListEntry* monitorTableList;
     struct J9Pool* monitorTableListPool;
     UDATA thrStaggerStep;
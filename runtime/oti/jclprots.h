@@ -218,6 +218,8 @@ Java_com_ibm_lang_management_internal_MemoryNotificationThreadShutdown_sendShutd
 extern J9_CFUNC jlong JNICALL
 Java_com_ibm_java_lang_management_internal_MemoryPoolMXBeanImpl_getUsageThresholdCountImpl(
     JNIEnv* env, jobject beanInstance, jint id);
+extern J9_CFUNC jlong JNICALL Java_com_ibm_java_lang_management_internal_MemoryPoolMXBeanImpl_getReleasedMemoryImpl(
+    JNIEnv* env, jobject beanInstance, jint id);
 extern J9_CFUNC jboolean JNICALL
 Java_com_ibm_java_lang_management_internal_MemoryPoolMXBeanImpl_isUsageThresholdSupportedImpl(
     JNIEnv* env, jobject beanInstance, jint id);
@@ -241,6 +241,17 @@ typedef struct AttachedDataWrapper {
 #define ADWDATA(adw) (((U_8*)(adw)) + sizeof(AttachedDataWrapper))
 #define ADWITEM(adw) (((U_8*)(adw)) - sizeof(ShcItem))
 
+/* Prefix of the data of compressible attached data types in a cache created with
+ * -Xshareclasses:compressAttachedData. The payload follows the header. */
+typedef struct CompressedAttachedDataHeader {
+    U_32 uncompressedLength;
+    U_32 encoding;
+} CompressedAttachedDataHeader;
+
+#define CADHUNCOMPRESSEDLEN(cadh) J9SHR_READMEM((cadh)->uncompressedLength)
+#define CADHENCODING(cadh) J9SHR_READMEM((cadh)->encoding)
+#define CADHDATA(cadh) (((U_8*)(cadh)) + sizeof(CompressedAttachedDataHeader))
+
 #ifdef __cplusplus
 }
 #endif
@@ -106,7 +106,7 @@
 #define J9SHR_RUNTIMEFLAG_CHECK_STRINGTABLE_RESET_READONLY J9CONST64(0x80000000000)
 #define J9SHR_RUNTIMEFLAG_CHECK_STRINGTABLE_RESET_READWRITE J9CONST64(0x100000000000)
 #define J9SHR_RUNTIMEFLAG_ENABLE_BCI J9CONST64(0x200000000000)
-/* The bit 0x400000000000 is free for use */
+#define J9SHR_RUNTIMEFLAG_COMPRESS_ATTACHED_DATA J9CONST64(0x400000000000)
 #define J9SHR_RUNTIMEFLAG_ADD_TEST_JITHINT J9CONST64(0x800000000000)
 #define J9SHR_RUNTIMEFLAG_DISABLE_BCI J9CONST64(0x1000000000000)
 #define J9SHR_RUNTIMEFLAG_ENABLE_STORAGEKEY_TESTING J9CONST64(0x2000000000000)
@@ -138,12 +138,18 @@
 #define J9SHR_LOCAL_STARTUPHINTS_FLAG_FETCHED 1
 #define J9SHR_LOCAL_STARTUPHINTS_FLAG_STORE_HEAPSIZES 2
 #define J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_HEAPSIZES 4
-#define J9SHR_LOCAL_STARTUPHINTS_FLAG_WRITE_HINTS \
-    (J9SHR_LOCAL_STARTUPHINTS_FLAG_STORE_HEAPSIZES | J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_HEAPSIZES)
-#define J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_HINTS (J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_HEAPSIZES)
+#define J9SHR_LOCAL_STARTUPHINTS_FLAG_STORE_STARTUP_PAGES 8
+#define J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_STARTUP_PAGES 16
+#define J9SHR_LOCAL_STARTUPHINTS_FLAG_WRITE_HINTS                                                      \
+    (J9SHR_LOCAL_STARTUPHINTS_FLAG_STORE_HEAPSIZES | J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_HEAPSIZES \
+        | J9SHR_LOCAL_STARTUPHINTS_FLAG_STORE_STARTUP_PAGES                                            \
+        | J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_STARTUP_PAGES)
+#define J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_HINTS \
+    (J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_HEAPSIZES | J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_STARTUP_PAGES)
 
 /* flags used by J9SharedStartupHintsDataDescriptor->flags */
 #define J9SHR_STARTUPHINTS_HEAPSIZES_SET 1
+#define J9SHR_STARTUPHINTS_STARTUP_PAGES_SET 2
 
 #define J9SHR_LOADTYPE_NORMAL 1
 #define J9SHR_LOADTYPE_REDEFINED 2
@@ -160,10 +166,15 @@
 #define J9SHR_EXTRA_FLAGS_MPROTECT_PARTIAL_PAGES 0x40
 #define J9SHR_EXTRA_FLAGS_RESTRICT_CLASSPATHS 0x80
 #define J9SHR_EXTRA_FLAGS_MPROTECT_PARTIAL_PAGES_ON_STARTUP 0x100
+#define J9SHR_EXTRA_FLAGS_COMPRESS_ATTACHED_DATA 0x200
 
 #define J9SHR_RESOURCE_TYPE_UNKNOWN 0
 #define J9SHR_ATTACHED_DATA_NO_FLAGS 0
 
+/* values of CompressedAttachedDataHeader->encoding */
+#define J9SHR_ATTACHED_DATA_ENCODING_STORED 0
+#define J9SHR_ATTACHED_DATA_ENCODING_LZ 1
+
 #define J9SHR_AOT_METHOD_FLAG_INVALIDATED 1
 
 /* Following flags are used to indicate cache is full */
@@ -2507,6 +2507,92 @@ void copyUTF8ToCompressedUnicode(
 UDATA
 compareStrings(J9VMThread* vmThread, j9object_t string1, j9object_t string2);
 
+/**
+ * @brief Compare compressed (Latin-1) string data to uncompressed string data for equality.
+ * @param *compressedData
+ * @param *uncompressedData
+ * @param length length for both arrays, in characters
+ * @returns 1 if the data is equal, 0 otherwise
+ */
+UDATA
+compareCompressedUnicodeData(const U_8* compressedData, const U_16* uncompressedData, UDATA length);
+
+/**
+ * @brief Count the leading characters of compressed string data which match single byte (ASCII) UTF8 data.
+ * @param *compressedData
+ * @param translateDots if non-zero, '.' in the string data matches '/' in the UTF8 data
+ * @param *utfData
+ * @param length maximum number of characters to match
+ * @returns the number of matching characters
+ */
+UDATA
+matchCompressedUnicodeToASCII(const U_8* compressedData, UDATA translateDots, const U_8* utfData, UDATA length);
+
+/**
+ * @brief Count the leading characters of uncompressed string data which match single byte (ASCII) UTF8 data.
+ * @param *uncompressedData
+ * @param translateDots if non-zero, '.' in the string data matches '/' in the UTF8 data
+ * @param *utfData
+ * @param length maximum number of characters to match
+ * @returns the number of matching characters
+ */
+UDATA
+matchUncompressedUnicodeToASCII(
+    const U_16* uncompressedData, UDATA translateDots, const U_8* utfData, UDATA length);
+
+/**
+ * @brief Count the leading bytes of UTF8 data which are single byte characters other than NUL.
+ * @param *utf8Data
+ * @param length number of bytes to examine
+ * @returns the number of leading single byte characters
+ */
+UDATA
+countUTF8ASCIIPrefix(const U_8* utf8Data, UDATA length);
+
+/**
+ * @brief Widen the leading single byte characters of UTF8 data into uncompressed string data.
+ * @param *utf8Data
+ * @param *unicodeData buffer receiving at least length characters
+ * @param length number of bytes to examine
+ * @param translateSlashes if non-zero, '/' is stored as '.'
+ * @returns the number of characters widened
+ */
+UDATA
+widenUTF8ASCIIToUnicode(const U_8* utf8Data, U_16* unicodeData, UDATA length, UDATA translateSlashes);
+
+/**
+ * @brief Copy the leading single byte characters of UTF8 data into compressed string data.
+ * @param *utf8Data
+ * @param *compressedData buffer receiving at least length characters
+ * @param length number of bytes to examine
+ * @param translateSlashes if non-zero, '/' is stored as '.'
+ * @returns the number of characters copied
+ */
+UDATA
+copyUTF8ASCIIToCompressedUnicode(const U_8* utf8Data, U_8* compressedData, UDATA length, UDATA translateSlashes);
+
+/**
+ * @brief Narrow the leading characters of uncompressed string data which encode as a single UTF8 byte.
+ * @param *unicodeData
+ * @param *utf8Data buffer receiving at least length bytes
+ * @param length number of characters to examine
+ * @param translateDots if non-zero, '.' is stored as '/'
+ * @returns the number of characters narrowed
+ */
+UDATA
+narrowUnicodeToUTF8ASCII(const U_16* unicodeData, U_8* utf8Data, UDATA length, UDATA translateDots);
+
+/**
+ * @brief Copy the leading characters of compressed string data which encode as a single UTF8 byte.
+ * @param *compressedData
+ * @param *utf8Data buffer receiving at least length bytes
+ * @param length number of characters to examine
+ * @param translateDots if non-zero, '.' is stored as '/'
+ * @returns the number of characters copied
+ */
+UDATA
+copyCompressedUnicodeToUTF8ASCII(const U_8* compressedData, U_8* utf8Data, UDATA length, UDATA translateDots);
+
 /**
  * @brief
  * @param *javaVM
@@ -309,6 +309,7 @@ private:
     void writeMonitorObject(J9ThreadMonitor* monitor, j9object_t obj, blocked_thread_record* threadStore);
     void writeMonitor(J9ThreadMonitor* monitor);
     void writeSystemMonitor(J9ThreadMonitor* monitor);
+    void writeAdaptiveSpinStatistics(void);
     void writeObject(j9object_t obj);
     void writeThread(J9VMThread* vmThread, J9PlatformThread* nativeThread, UDATA vmstate, UDATA javaState,
         UDATA javaPriority, j9object_t lockObject, J9VMThread* lockOwnerThread);
@@ -468,11 +469,15 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(const char* fileName, J9RASdumpContext* c
     CALL_PROTECT(writeMemorySection, _Error);
 
     /* The monitor section is crash prone as objects mutate under it.
-     * Lock ordering imposed by the lock inflation path means that we have to get the monitorTableMutex ahead of the
-     * thread lock as we will attempt to get it again for uninflated locks when calling getVMThreadRawState while
-     * looking for waiting threads on any given monitor
+     * Lock ordering imposed by the lock inflation path means that we have to get the monitor table locks ahead of the
+     * thread lock as we will attempt to get them again for uninflated locks when calling getVMThreadRawState while
+     * looking for waiting threads on any given monitor. The monitorTableMutex serializes dumps taking every table
+     * lock, which are always acquired in index order.
      */
     omrthread_monitor_enter(_VirtualMachine->monitorTableMutex);
+    for (UDATA tableIndex = 0; tableIndex < _VirtualMachine->monitorTableCount; tableIndex++) {
+        omrthread_monitor_enter(_VirtualMachine->monitorTableLocks[tableIndex].mutex);
+    }
     omrthread_t self = omrthread_self();
     if (!omrthread_lib_try_lock(self)) {
         /* got both locks so we shouldn't deadlock getting thread state */
@@ -487,6 +492,9 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(const char* fileName, J9RASdumpContext* c
             "1LKREGMONDUMP  JVM System Monitor Dump unavailable [locked]\n"
             "NULL           ------------------------------------------------------------------------\n");
     }
+    for (UDATA tableIndex = _VirtualMachine->monitorTableCount; tableIndex > 0; tableIndex--) {
+        omrthread_monitor_exit(_VirtualMachine->monitorTableLocks[tableIndex - 1].mutex);
+    }
     omrthread_monitor_exit(_VirtualMachine->monitorTableMutex);
 
     /* If request=preempt (for native stack collection) we attempt to acquire the mutex and note if we got it */
@@ -1636,8 +1644,8 @@ void JavaCoreDumpWriter::writeNativeAllocator(
 /**************************************************************************************************/
 void JavaCoreDumpWriter::writeMonitorSection(void)
 {
-    /* The code calling this method must have taken the monitorTableMutex and the thread library monitor_mutex
-     * (in that order) prior to calling and must release those locks on return from this method.
+    /* The code calling this method must have taken the monitorTableMutex, every monitor table lock and the thread
+     * library monitor_mutex (in that order) prior to calling and must release those locks on return from this method.
      */
     J9ThreadMonitor* monitor = NULL;
     omrthread_monitor_walk_state_t walkState;
@@ -1746,6 +1754,11 @@ void JavaCoreDumpWriter::writeMonitorSection(void)
         }
     }
 
+    /* Write the adaptive spinning statistics */
+    if (0 != _VirtualMachine->thrAdaptiveObjectSpin) {
+        writeAdaptiveSpinStatistics();
+    }
+
     /* Write the deadlocks */
     writeDeadLocks();
 
@@ -2747,6 +2760,12 @@ void JavaCoreDumpWriter::writeSharedClassSection(void)
             _OutputStream.writeCharacters("2SCLTEXTBCI        Restrict Classpaths   = false\n");
         }
 
+        if (0 != (javacoreData.extraFlags & J9SHR_EXTRA_FLAGS_COMPRESS_ATTACHED_DATA)) {
+            _OutputStream.writeCharacters("2SCLTEXTCAD        Compressed JIT data   = true\n");
+        } else {
+            _OutputStream.writeCharacters("2SCLTEXTCAD        Compressed JIT data   = false\n");
+        }
+
         _OutputStream.writeCharacters("NULL\n"
                                       "1SCLTEXTCSUM   Cache Summary\n"
                                       "NULL           ------------------\n"
@@ -2830,6 +2849,9 @@ void JavaCoreDumpWriter::writeSharedClassSection(void)
         _OutputStream.writeCharacters("\n2SCLTEXTJPB        JIT profile bytes                         = ");
         _OutputStream.writeInteger(javacoreData.jitProfileDataBytes, "%zu");
 
+        _OutputStream.writeCharacters("\n2SCLTEXTJPS        JIT profile bytes saved                   = ");
+        _OutputStream.writeInteger(javacoreData.jitProfileBytesSaved, "%zu");
+
         _OutputStream.writeCharacters("\n2SCLTEXTJRB        Reserved space for JIT data bytes         = ");
         _OutputStream.writeInteger(javacoreData.minJIT, "%zd");
 
@@ -2921,6 +2943,12 @@ void JavaCoreDumpWriter::writeSharedClassSection(void)
         _OutputStream.writeCharacters("\n2SCLTEXTNJC        Number JCL Entries                        = ");
         _OutputStream.writeInteger(javacoreData.numJclEntries, "%zu");
 
+        _OutputStream.writeCharacters("\n2SCLTEXTNLL        Number Locked Lookups                     = ");
+        _OutputStream.writeInteger(javacoreData.numLockedLookups, "%zu");
+
+        _OutputStream.writeCharacters("\n2SCLTEXTNCL        Number Contended Lookups                  = ");
+        _OutputStream.writeInteger(javacoreData.numContendedLookups, "%zu");
+
         _OutputStream.writeCharacters("\n2SCLTEXTNST        Number Stale classes                      = ");
         _OutputStream.writeInteger(javacoreData.numStaleClasses, "%zu");
 
@@ -3775,6 +3803,60 @@ void JavaCoreDumpWriter::writeMonitor(J9ThreadMonitor* monitor)
     _OutputStream.writeCharacters(":");
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* JavaCoreDumpWriter::writeAdaptiveSpinStatistics() method implementation                        */
+/*                                                                                                */
+/**************************************************************************************************/
+void JavaCoreDumpWriter::writeAdaptiveSpinStatistics(void)
+{
+    /* The caller holds every monitor table lock, so the tables can be walked directly. The counts mirror the
+     * JLM spin/slow split: "spun" enters were acquired by spinning, "parked" enters fell through to blocking.
+     */
+    UDATA totalAcquired = 0;
+    UDATA totalParked = 0;
+
+    _OutputStream.writeCharacters("NULL           \n"
+                                  "1LKSPINSTATS   Adaptive spin statistics (inflated object-monitors):\n");
+
+    for (UDATA tableIndex = 0; tableIndex < _VirtualMachine->monitorTableCount; tableIndex++) {
+        J9HashTable* monitorTable = _VirtualMachine->monitorTables[tableIndex];
+        J9HashTableState walkState;
+
+        if (NULL == monitorTable) {
+            continue;
+        }
+        J9ObjectMonitor* objectMonitor = (J9ObjectMonitor*)hashTableStartDo(monitorTable, &walkState);
+        while (NULL != objectMonitor) {
+            UDATA acquired = objectMonitor->spinAcquiredCount;
+            UDATA parked = objectMonitor->spinParkedCount;
+
+            if ((0 != acquired) || (0 != parked)) {
+                _OutputStream.writeCharacters("2LKSPINMON       ");
+                writeMonitor((J9ThreadMonitor*)objectMonitor->monitor);
+                _OutputStream.writeCharacters(" spun ");
+                _OutputStream.writeInteger(acquired, "%zu");
+                _OutputStream.writeCharacters(", parked ");
+                _OutputStream.writeInteger(parked, "%zu");
+                _OutputStream.writeCharacters(", budget shift ");
+                _OutputStream.writeInteger((UDATA)objectMonitor->spinBudgetShift, "%zu");
+                _OutputStream.writeCharacters(", hold time estimate ");
+                _OutputStream.writeInteger((UDATA)objectMonitor->holdTimeEstimate, "%zu");
+                _OutputStream.writeCharacters(" usec\n");
+                totalAcquired += acquired;
+                totalParked += parked;
+            }
+            objectMonitor = (J9ObjectMonitor*)hashTableNextDo(&walkState);
+        }
+    }
+
+    _OutputStream.writeCharacters("2LKSPINTOTAL     Total spun ");
+    _OutputStream.writeInteger(totalAcquired, "%zu");
+    _OutputStream.writeCharacters(", parked ");
+    _OutputStream.writeInteger(totalParked, "%zu");
+    _OutputStream.writeCharacters("\n");
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* JavaCoreDumpWriter::writeSystemMonitor() method implementation                                 */
@@ -0,0 +1,259 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup Shared_Common
+ */
+
+#include "AttachedDataCodec.hpp"
+#include <string.h>
+
+#define CODEC_MIN_MATCH 4
+/* the last bytes of a block are always literals so a match never reads past the end of the input */
+#define CODEC_LAST_LITERALS 5
+#define CODEC_MATCH_SEARCH_LIMIT 12
+#define CODEC_MAX_OFFSET 0xFFFF
+#define CODEC_RUN_MASK 0xF
+#define CODEC_HASH_BITS 12
+#define CODEC_HASH_ENTRIES (1 << CODEC_HASH_BITS)
+
+static U_32
+codecRead32(const U_8* address)
+{
+    U_32 value;
+
+    memcpy(&value, address, sizeof(value));
+    return value;
+}
+
+static UDATA
+codecHash(U_32 sequence)
+{
+    return (UDATA)((sequence * 2654435761U) >> (32 - CODEC_HASH_BITS));
+}
+
+static U_8*
+codecWriteRunLength(U_8* cursor, UDATA length)
+{
+    for (; length >= 0xFF; length -= 0xFF) {
+        *cursor++ = 0xFF;
+    }
+    *cursor++ = (U_8)length;
+    return cursor;
+}
+
+/**
+ * Append one sequence to the encoded block.
+ *
+ * @return the new output position, or NULL if the sequence does not fit
+ */
+static U_8*
+codecWriteSequence(U_8* cursor, U_8* end, const U_8* literals, UDATA literalLength, UDATA offset, UDATA matchLength)
+{
+    UDATA required = 1 + literalLength + (literalLength / 0xFF) + 1;
+    U_8* token = cursor;
+
+    if (0 != matchLength) {
+        required += 2 + ((matchLength - CODEC_MIN_MATCH) / 0xFF) + 1;
+    }
+    if (required > (UDATA)(end - cursor)) {
+        return NULL;
+    }
+
+    cursor += 1;
+    if (literalLength >= CODEC_RUN_MASK) {
+        *token = CODEC_RUN_MASK << 4;
+        cursor = codecWriteRunLength(cursor, literalLength - CODEC_RUN_MASK);
+    } else {
+        *token = (U_8)(literalLength << 4);
+    }
+    memcpy(cursor, literals, literalLength);
+    cursor += literalLength;
+
+    if (0 != matchLength) {
+        UDATA matchCode = matchLength - CODEC_MIN_MATCH;
+
+        *cursor++ = (U_8)(offset & 0xFF);
+        *cursor++ = (U_8)(offset >> 8);
+        if (matchCode >= CODEC_RUN_MASK) {
+            *token |= CODEC_RUN_MASK;
+            cursor = codecWriteRunLength(cursor, matchCode - CODEC_RUN_MASK);
+        } else {
+            *token |= (U_8)matchCode;
+        }
+    }
+    return cursor;
+}
+
+/**
+ * @param[in] length The length of the data to encode
+ *
+ * @return the size of an output buffer that can always hold the encoded data
+ */
+UDATA
+SH_AttachedDataCodec::getMaxEncodedLength(UDATA length)
+{
+    return length + (length / 0xFF) + 16;
+}
+
+/**
+ * @return the size of the scratch memory encode() requires
+ */
+UDATA
+SH_AttachedDataCodec::getScratchBytes(void)
+{
+    return CODEC_HASH_ENTRIES * sizeof(U_32);
+}
+
+/**
+ * Encode a block of data.
+ *
+ * @param[in] src The data to encode, at most 4GB
+ * @param[in] srcLength The length of the data
+ * @param[in] dest Buffer for the encoded data
+ * @param[in] destCapacity Size of dest
+ * @param[in] scratch Memory of getScratchBytes() bytes
+ *
+ * @return the length of the encoded data, or 0 if it does not fit in destCapacity bytes
+ */
+UDATA
+SH_AttachedDataCodec::encode(const U_8* src, UDATA srcLength, U_8* dest, UDATA destCapacity, void* scratch)
+{
+    U_32* table = (U_32*)scratch;
+    U_8* cursor = dest;
+    U_8* end = dest + destCapacity;
+    UDATA anchor = 0;
+
+    memset(table, 0, getScratchBytes());
+
+    if (srcLength >= CODEC_MATCH_SEARCH_LIMIT) {
+        UDATA searchLimit = srcLength - CODEC_MATCH_SEARCH_LIMIT;
+        UDATA matchLimit = srcLength - CODEC_LAST_LITERALS;
+        UDATA position = 0;
+
+        while (position <= searchLimit) {
+            U_32 sequence = codecRead32(src + position);
+            UDATA hash = codecHash(sequence);
+            UDATA candidate = table[hash];
+
+            table[hash] = (U_32)position;
+            if ((candidate < position) && ((position - candidate) <= CODEC_MAX_OFFSET)
+                && (codecRead32(src + candidate) == sequence)) {
+                UDATA matchLength = CODEC_MIN_MATCH;
+
+                while (((position + matchLength) < matchLimit)
+                    && (src[candidate + matchLength] == src[position + matchLength])) {
+                    matchLength += 1;
+                }
+                cursor = codecWriteSequence(
+                    cursor, end, src + anchor, position - anchor, position - candidate, matchLength);
+                if (NULL == cursor) {
+                    return 0;
+                }
+                position += matchLength;
+                anchor = position;
+            } else {
+                position += 1;
+            }
+        }
+    }
+
+    cursor = codecWriteSequence(cursor, end, src + anchor, srcLength - anchor, 0, 0);
+    if (NULL == cursor) {
+        return 0;
+    }
+    return (UDATA)(cursor - dest);
+}
+
+/**
+ * Decode a block produced by encode(). The input is untrusted; every length and offset is checked
+ * against the bounds of src and dest.
+ *
+ * @param[in] src The encoded data
+ * @param[in] srcLength The length of the encoded data
+ * @param[in] dest Buffer for the decoded data
+ * @param[in] destLength The exact length of the decoded data
+ *
+ * @return true if src decoded to exactly destLength bytes, false if it is malformed
+ */
+bool
+SH_AttachedDataCodec::decode(const U_8* src, UDATA srcLength, U_8* dest, UDATA destLength)
+{
+    const U_8* input = src;
+    const U_8* inputEnd = src + srcLength;
+    U_8* output = dest;
+    U_8* outputEnd = dest + destLength;
+
+    while (input < inputEnd) {
+        UDATA token = *input++;
+        UDATA literalLength = token >> 4;
+        UDATA matchLength = token & CODEC_RUN_MASK;
+        UDATA offset = 0;
+
+        if (CODEC_RUN_MASK == literalLength) {
+            UDATA next = 0xFF;
+
+            while ((0xFF == next) && (input < inputEnd)) {
+                next = *input++;
+                literalLength += next;
+            }
+        }
+        if ((literalLength > (UDATA)(inputEnd - input)) || (literalLength > (UDATA)(outputEnd - output))) {
+            return false;
+        }
+        memcpy(output, input, literalLength);
+        input += literalLength;
+        output += literalLength;
+
+        if (input == inputEnd) {
+            break;
+        }
+
+        if ((inputEnd - input) < 2) {
+            return false;
+        }
+        offset = (UDATA)input[0] | ((UDATA)input[1] << 8);
+        input += 2;
+        if ((0 == offset) || (offset > (UDATA)(output - dest))) {
+            return false;
+        }
+        if (CODEC_RUN_MASK == matchLength) {
+            UDATA next = 0xFF;
+
+            while ((0xFF == next) && (input < inputEnd)) {
+                next = *input++;
+                matchLength += next;
+            }
+        }
+        matchLength += CODEC_MIN_MATCH;
+        if (matchLength > (UDATA)(outputEnd - output)) {
+            return false;
+        }
+        /* byte by byte; the match may overlap the bytes it produces */
+        for (const U_8* match = output - offset; 0 != matchLength; matchLength--) {
+            *output++ = *match++;
+        }
+    }
+
+    return (output == outputEnd);
+}
@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(ATTACHED_DATA_CODEC_HPP_INCLUDED)
+#define ATTACHED_DATA_CODEC_HPP_INCLUDED
+
+/* @ddr_namespace: default */
+#include "j9.h"
+#include "shcflags.h"
+
+/**
+ * Compression of attached data in a cache created with -Xshareclasses:compressAttachedData.
+ *
+ * Only types that are written once and copied out by findAttachedData() are compressed, since their
+ * data is never read in place. The encoding is an LZ77 block format with 64K window: a token byte holding
+ * the literal run length and match length, the literals, then a 2 byte little-endian match offset. The
+ * last sequence of a block holds literals only. It is cheap to decode, which keeps the cost of a lookup low.
+ */
+class SH_AttachedDataCodec {
+public:
+    /**
+     * @param[in] runtimeFlags The shared classes runtime flags
+     * @param[in] type The attached data type
+     *
+     * @return true if attached data of this type is stored with a CompressedAttachedDataHeader
+     */
+    static bool isCompressedType(U_64 runtimeFlags, UDATA type)
+    {
+        return J9_ARE_ALL_BITS_SET(runtimeFlags, J9SHR_RUNTIMEFLAG_COMPRESS_ATTACHED_DATA)
+            && (J9SHR_ATTACHED_DATA_TYPE_JITPROFILE == type);
+    }
+
+    static UDATA getMaxEncodedLength(UDATA length);
+
+    static UDATA getScratchBytes(void);
+
+    static UDATA encode(const U_8* src, UDATA srcLength, U_8* dest, UDATA destCapacity, void* scratch);
+
+    static bool decode(const U_8* src, UDATA srcLength, U_8* dest, UDATA destLength);
+};
+
+#endif /* ATTACHED_DATA_CODEC_HPP_INCLUDED */
@@ -36,6 +36,8 @@ public:
 
     virtual UDATA getDataBytesForType(UDATA type) = 0;
 
+    virtual UDATA getSavedBytesForType(UDATA type) = 0;
+
     class SH_AttachedDataResourceDescriptor : public SH_ResourceDescriptor {
     public:
         typedef char* BlockPtr;
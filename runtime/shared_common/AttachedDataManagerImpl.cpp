@@ -26,6 +26,7 @@
  */
 
 #include "AttachedDataManagerImpl.hpp"
+#include "AttachedDataCodec.hpp"
 #include "ut_j9shr.h"
 #include "j9shrnls.h"
 #include "j9consts.h"
@@ -84,6 +85,7 @@ void SH_AttachedDataManagerImpl::initialize(J9JavaVM* vm, SH_SharedCache* cache_
     _htMutexName = "adTableMutex";
     memset(_bytesByType, 0, sizeof(_bytesByType));
     memset(_numBytesByType, 0, sizeof(_numBytesByType));
+    memset(_savedBytesByType, 0, sizeof(_savedBytesByType));
     _dataTypesRepresented[0] = TYPE_ATTACHED_DATA;
     _dataTypesRepresented[1] = _dataTypesRepresented[2] = 0;
 
@@ -121,6 +123,22 @@ SH_AttachedDataManagerImpl::getDataBytesForType(UDATA type)
     return _bytesByType[type];
 }
 
+/**
+ * @param[in] type The attached data type
+ *
+ * @return the number of bytes that compression has saved for attached data of the given type
+ */
+UDATA
+SH_AttachedDataManagerImpl::getSavedBytesForType(UDATA type)
+{
+    if (type > J9SHR_ATTACHED_DATA_TYPE_MAX) {
+        Trc_SHR_ADMI_getDataBytesForType_Error(type);
+        Trc_SHR_Assert_ShouldNeverHappen();
+        return 0;
+    }
+    return _savedBytesByType[type];
+}
+
 /**
  * Registers a new resource with the SH_AttachedDataManager
  * Calls super class method (SH_ROMClassResourceManager) to update the hash table.
@@ -153,6 +171,14 @@ bool SH_AttachedDataManagerImpl::storeNew(
     if (type <= J9SHR_ATTACHED_DATA_TYPE_MAX) {
         _bytesByType[type] += ITEMDATALEN(itemInCache);
         _numBytesByType[type] += 1;
+        if (SH_AttachedDataCodec::isCompressedType(*_runtimeFlagsPtr, type)
+            && (ADWLEN(adw) >= sizeof(CompressedAttachedDataHeader))) {
+            U_32 uncompressedLength = CADHUNCOMPRESSEDLEN((CompressedAttachedDataHeader*)ADWDATA(adw));
+
+            if (uncompressedLength > ADWLEN(adw)) {
+                _savedBytesByType[type] += uncompressedLength - ADWLEN(adw);
+            }
+        }
     } else {
         /* Unknown type */
         _bytesByType[J9SHR_ATTACHED_DATA_TYPE_UNKNOWN] += ITEMDATALEN(itemInCache);
@@ -46,6 +46,8 @@ public:
 
     virtual UDATA getDataBytesForType(UDATA type);
 
+    virtual UDATA getSavedBytesForType(UDATA type);
+
     virtual bool storeNew(J9VMThread* currentThread, const ShcItem* itemInCache, SH_CompositeCache* cachelet);
 
 protected:
@@ -56,6 +58,7 @@ protected:
 private:
     UDATA _numBytesByType[J9SHR_ATTACHED_DATA_TYPE_MAX + 1];
     UDATA _bytesByType[J9SHR_ATTACHED_DATA_TYPE_MAX + 1];
+    UDATA _savedBytesByType[J9SHR_ATTACHED_DATA_TYPE_MAX + 1];
 
     /* Copy prevention */
     SH_AttachedDataManagerImpl(const SH_AttachedDataManagerImpl&);
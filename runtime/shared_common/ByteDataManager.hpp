@@ -67,6 +67,9 @@ public:
     virtual UDATA getDataBytesForType(UDATA type) = 0;
 
     virtual UDATA getUnindexedDataBytes() = 0;
+
+    /* Total microseconds spent reading central directories by the JVMs which stored the zip caches */
+    virtual U_64 getZipCachePopulateTime() = 0;
 };
 
 #endif /* !defined(BYTEDATAMANAGER_HPP_INCLUDED) */
@@ -29,6 +29,7 @@
 #include "ut_j9shr.h"
 #include "j9shrnls.h"
 #include "j9consts.h"
+#include "zip_api.h"
 #include <string.h>
 
 SH_ByteDataManagerImpl::SH_ByteDataManagerImpl() {}
@@ -83,6 +84,7 @@ void SH_ByteDataManagerImpl::initialize(J9JavaVM* vm, SH_SharedCache* cache_, Bl
     memset(_indexedBytesByType, 0, sizeof(_indexedBytesByType));
     memset(_numIndexedBytesByType, 0, sizeof(_numIndexedBytesByType));
     _unindexedBytes = 0;
+    _zipCachePopulateTime = 0;
     _dataTypesRepresented[0] = TYPE_BYTE_DATA;
     _dataTypesRepresented[1] = TYPE_UNINDEXED_BYTE_DATA;
     _dataTypesRepresented[2] = TYPE_CACHELET;
@@ -169,6 +171,9 @@ bool SH_ByteDataManagerImpl::storeNew(
         if (type <= J9SHR_DATA_TYPE_MAX) {
             _indexedBytesByType[type] += ITEMDATALEN(itemInCache);
             _numIndexedBytesByType[type] += 1;
+            if (J9SHR_DATA_TYPE_ZIPCACHE == type) {
+                _zipCachePopulateTime += zipCache_copiedPopulateTime((void*)BDWDATA(bdw), BDWLEN(bdw));
+            }
         } else {
             /* Unidentified types */
             _indexedBytesByType[J9SHR_DATA_TYPE_UNKNOWN] += ITEMDATALEN(itemInCache);
@@ -476,6 +481,9 @@ SH_ByteDataManagerImpl::getDataBytesForType(UDATA type)
 UDATA
 SH_ByteDataManagerImpl::getUnindexedDataBytes() { return _unindexedBytes; }
 
+U_64
+SH_ByteDataManagerImpl::getZipCachePopulateTime() { return _zipCachePopulateTime; }
+
 #if defined(J9SHR_CACHELET_SUPPORT)
 
 /**
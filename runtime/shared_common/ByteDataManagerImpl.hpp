@@ -76,6 +76,8 @@ public:
 
     virtual UDATA getUnindexedDataBytes();
 
+    virtual U_64 getZipCachePopulateTime();
+
 protected:
     void* operator new(size_t size, void* memoryPtr) { return memoryPtr; };
 
@@ -108,6 +110,7 @@ private:
     UDATA _unindexedBytes;
     UDATA _indexedBytesByType[J9SHR_DATA_TYPE_MAX + 1];
     UDATA _numIndexedBytesByType[J9SHR_DATA_TYPE_MAX + 1];
+    U_64 _zipCachePopulateTime;
 
     void initialize(J9JavaVM* vm, SH_SharedCache* cache, BlockPtr memForConstructor);
 
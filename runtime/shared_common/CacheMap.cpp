@@ -28,6 +28,7 @@
 #include "ScopeManagerImpl.hpp"
 #include "ByteDataManagerImpl.hpp"
 #include "AttachedDataManagerImpl.hpp"
+#include "AttachedDataCodec.hpp"
 #include "CompositeCacheImpl.hpp"
 #include "UnitTest.hpp"
 #include "AtomicSupport.hpp"
@@ -243,6 +244,121 @@ void SH_CacheMap::dontNeedMetadata(J9VMThread* currentThread)
     _ccHead->dontNeedMetadata(currentThread, (const void*)min, length);
 }
 
+/**
+ * Record the chunks of the cache holding ROM classes, metadata and AOT code used during startup in the local
+ * startup hints, so that later JVMs with the same command line can prefault them using prefaultStartupPages().
+ * The cache is split into CM_STARTUP_PAGES_CHUNKS chunks of at least one page, and one bit is kept per chunk,
+ * so that data used by other applications sharing the cache between the used chunks is not recorded.
+ * Chunks already recorded in the cache are only overwritten when this JVM used chunks outside of them,
+ * in which case the union of the chunks is stored.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] localHints  The local startup hints to update
+ */
+void SH_CacheMap::recordStartupPages(J9VMThread* currentThread, J9SharedLocalStartupHints* localHints)
+{
+    J9SharedStartupHintsDataDescriptor* hintsData = &localHints->hintsData;
+    UDATA chunkSize = _startupPagesChunkSize;
+    UDATA startupPages[J9SHR_STARTUPHINTS_STARTUP_PAGES_WORDS];
+    bool newPages = false;
+    UDATA chunks = 0;
+
+    if (0 == chunkSize) {
+        return;
+    }
+    /* Stop marking, chunks used after this point are not part of startup */
+    _startupPagesChunkSize = 0;
+    memcpy(startupPages, _startupPages, sizeof(startupPages));
+
+    if (J9_ARE_ALL_BITS_SET(hintsData->flags, J9SHR_STARTUPHINTS_STARTUP_PAGES_SET)
+        && (chunkSize == hintsData->startupPagesChunkSize)) {
+        for (UDATA i = 0; i < J9SHR_STARTUPHINTS_STARTUP_PAGES_WORDS; i++) {
+            if (J9_ARE_ANY_BITS_SET(startupPages[i], ~hintsData->startupPages[i])) {
+                newPages = true;
+            }
+            startupPages[i] |= hintsData->startupPages[i];
+        }
+    } else {
+        for (UDATA i = 0; i < J9SHR_STARTUPHINTS_STARTUP_PAGES_WORDS; i++) {
+            if (0 != startupPages[i]) {
+                newPages = true;
+            }
+        }
+    }
+    if (!newPages) {
+        /* The recorded chunks already cover everything used by this JVM */
+        return;
+    }
+
+    if (J9_ARE_ALL_BITS_SET(hintsData->flags, J9SHR_STARTUPHINTS_STARTUP_PAGES_SET)) {
+        localHints->localStartupHintFlags |= J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_STARTUP_PAGES;
+    } else {
+        localHints->localStartupHintFlags |= J9SHR_LOCAL_STARTUPHINTS_FLAG_STORE_STARTUP_PAGES;
+    }
+    for (UDATA i = 0; i < J9SHR_STARTUPHINTS_STARTUP_PAGES_WORDS; i++) {
+        for (UDATA bits = startupPages[i]; 0 != bits; bits &= bits - 1) {
+            chunks += 1;
+        }
+    }
+    Trc_SHR_CM_recordStartupPages(currentThread, chunks, chunkSize);
+    hintsData->startupPagesChunkSize = chunkSize;
+    memcpy(hintsData->startupPages, startupPages, sizeof(startupPages));
+    hintsData->flags |= J9SHR_STARTUPHINTS_STARTUP_PAGES_SET;
+}
+
+/**
+ * Start marking the chunks of the cache used during startup, and advise the OS that the chunks recorded by
+ * recordStartupPages() will be accessed, so that the pages are read in before the first class loads fault
+ * on them. Adjacent chunks are advised as one range, and at most CM_STARTUP_PAGES_PREFAULT_MAX bytes are advised.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] hintsData  The startup hints found in the cache
+ */
+void SH_CacheMap::prefaultStartupPages(J9VMThread* currentThread, const J9SharedStartupHintsDataDescriptor* hintsData)
+{
+    PORT_ACCESS_FROM_PORT(_portlib);
+    UDATA pageSize = j9vmem_supported_page_sizes()[0];
+    UDATA cacheSize = (UDATA)_ccHead->getTotalSize();
+    UDATA chunkSize = ROUND_UP_TO(pageSize, (cacheSize + CM_STARTUP_PAGES_CHUNKS - 1) / CM_STARTUP_PAGES_CHUNKS);
+
+    if (0 == chunkSize) {
+        return;
+    }
+    if (J9_ARE_ALL_BITS_SET(hintsData->flags, J9SHR_STARTUPHINTS_STARTUP_PAGES_SET)
+        && (chunkSize == hintsData->startupPagesChunkSize)) {
+        U_8* cacheStart = (U_8*)_ccHead->getCacheHeaderAddress();
+        U_8* cacheEnd = (U_8*)_ccHead->getCacheEndAddress();
+        UDATA prefaulted = 0;
+        UDATA chunk = 0;
+
+        while ((chunk < CM_STARTUP_PAGES_CHUNKS) && (prefaulted < CM_STARTUP_PAGES_PREFAULT_MAX)) {
+            UDATA runStart = chunk;
+            U_8* start = NULL;
+            UDATA length = 0;
+
+            while ((chunk < CM_STARTUP_PAGES_CHUNKS)
+                && J9_ARE_ANY_BITS_SET(hintsData->startupPages[chunk / CM_STARTUP_PAGES_BITS_PER_WORD],
+                    (UDATA)1 << (chunk % CM_STARTUP_PAGES_BITS_PER_WORD))) {
+                chunk += 1;
+            }
+            if (runStart == chunk) {
+                chunk += 1;
+                continue;
+            }
+            start = cacheStart + (runStart * chunkSize);
+            if (start >= cacheEnd) {
+                break;
+            }
+            length = OMR_MIN((chunk - runStart) * chunkSize, (UDATA)(cacheEnd - start));
+            length = OMR_MIN(length, CM_STARTUP_PAGES_PREFAULT_MAX - prefaulted);
+            _ccHead->willNeedCacheData(currentThread, start, length);
+            prefaulted += length;
+        }
+        Trc_SHR_CM_prefaultStartupPages(currentThread, prefaulted, chunkSize);
+    }
+    _startupPagesChunkSize = chunkSize;
+}
+
 /**
  * Builds a new SH_CacheMap for retrieving cache statistics
  *
@@ -292,6 +408,8 @@ void SH_CacheMap::initialize(J9JavaVM* vm, J9SharedClassConfig* sharedClassConfi
     _isAssertEnabled = true;
     _minimumAccessedShrCacheMetadata = 0;
     _maximumAccessedShrCacheMetadata = 0;
+    _startupPagesChunkSize = 0;
+    memset(_startupPages, 0, sizeof(_startupPages));
     _metadataReleased = false;
 
     /* TODO: Need this function to be able to return pass/fail */
@@ -2763,6 +2881,7 @@ const J9ROMClass* SH_CacheMap::findROMClass(J9VMThread* currentThread, const cha
 #endif
         {
             updateAccessedShrCacheMetadataBounds(currentThread, (uintptr_t*)locateResult.known);
+            markStartupPages(returnVal, returnVal->romSize);
         }
 #endif /* !defined(J9ZOS390) && !defined(AIXPPC) */
     }
@@ -3234,7 +3353,10 @@ const U_8* SH_CacheMap::findCompiledMethod(J9VMThread* currentThread, const J9RO
             if (J9_ARE_ALL_BITS_SET(*_runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_PERSISTENT_CACHE))
 #endif
         {
+            const CompiledMethodWrapper* cmw = (const CompiledMethodWrapper*)(result - sizeof(CompiledMethodWrapper));
+
             updateAccessedShrCacheMetadataBounds(currentThread, (uintptr_t*)result);
+            markStartupPages(cmw, sizeof(CompiledMethodWrapper) + cmw->dataLength + cmw->codeLength);
         }
 #endif /* !defined(J9ZOS390) && !defined(AIXPPC) */
     }
@@ -3243,7 +3365,8 @@ const U_8* SH_CacheMap::findCompiledMethod(J9VMThread* currentThread, const J9RO
 }
 
 /**
- * Record the minimum and maximum addresses accessed in the shared classes cache.
+ * Record the minimum and maximum addresses accessed in the shared classes cache, and mark the chunk
+ * holding the address as used during startup.
  * @param [in] metadataAddress address accessed in metadata
  * @note an argument of 0 will reset the minimum and maximum
  */
@@ -3253,6 +3376,8 @@ void SH_CacheMap::updateAccessedShrCacheMetadataBounds(J9VMThread* currentThread
     uintptr_t currentValue = (uintptr_t)_minimumAccessedShrCacheMetadata;
     uintptr_t const newValue = (uintptr_t const)metadataAddress;
 
+    markStartupPages(metadataAddress, 1);
+
     if (0 == currentValue) { /* set initial value.  Don't care if someone beats us to this  */
         Trc_SHR_CM_updateAccessedShrCacheMetadataMinimum(currentThread, metadataAddress);
         compareAndSwapUDATA(updateAddress, currentValue, newValue);
@@ -3276,6 +3401,35 @@ void SH_CacheMap::updateAccessedShrCacheMetadataBounds(J9VMThread* currentThread
     }
 }
 
+/**
+ * Mark the chunks of the top layer cache covering [address, address + length) as used during startup.
+ * Does nothing once the startup pages have been recorded, or if the cache is not persistent.
+ * @param [in] address start of the data accessed in the cache
+ * @param [in] length length of the data accessed in the cache
+ */
+void SH_CacheMap::markStartupPages(const void* address, UDATA length)
+{
+    UDATA chunkSize = _startupPagesChunkSize;
+
+    if ((0 != chunkSize) && (0 != length) && _ccHead->isAddressInCache(address)) {
+        UDATA offset = (UDATA)address - (UDATA)_ccHead->getCacheHeaderAddress();
+        UDATA chunk = offset / chunkSize;
+        UDATA lastChunk = OMR_MIN((offset + length - 1) / chunkSize, CM_STARTUP_PAGES_CHUNKS - 1);
+
+        for (; chunk <= lastChunk; chunk++) {
+            UDATA* word = &_startupPages[chunk / CM_STARTUP_PAGES_BITS_PER_WORD];
+            UDATA bit = (UDATA)1 << (chunk % CM_STARTUP_PAGES_BITS_PER_WORD);
+            UDATA oldValue = *word;
+
+            /* Most lookups hit a chunk that is already marked, only swap when the bit is clear */
+            while (J9_ARE_NO_BITS_SET(oldValue, bit)) {
+                compareAndSwapUDATA(word, oldValue, oldValue | bit);
+                oldValue = *word;
+            }
+        }
+    }
+}
+
 /**
  * Store data in shared classes cache, keyed by the specified address in the shared cache.
  * Typically this is jit or aot related data.
@@ -3297,11 +3451,11 @@ SH_CacheMap::storeAttachedData(
     J9VMThread* currentThread, const void* addressInCache, const J9SharedDataDescriptor* data, UDATA forceReplace)
 {
     UDATA result = 0;
-    SH_AttachedDataManager::SH_AttachedDataResourceDescriptor descriptor(
-        data->address, (U_32)data->length, (U_16)data->type);
     SH_AttachedDataManager* localADM;
     J9SharedClassConfig* scconfig = currentThread->javaVM->sharedClassConfig;
     UDATA localVerboseFlags = scconfig->verboseFlags;
+    J9SharedDataDescriptor storedData = *data;
+    U_8* compressionBuffer = NULL;
     PORT_ACCESS_FROM_PORT(_portlib);
 
     Trc_SHR_CM_storeAttachedData_Entry(currentThread, addressInCache, data);
@@ -3310,6 +3464,17 @@ SH_CacheMap::storeAttachedData(
         return J9SHR_RESOURCE_STORE_ERROR;
     }
 
+    if (SH_AttachedDataCodec::isCompressedType(*_runtimeFlags, data->type)) {
+        compressionBuffer = compressAttachedData(currentThread, data, &storedData);
+        if (NULL == compressionBuffer) {
+            Trc_SHR_CM_storeAttachedData_Exit_CompressionFailed(currentThread, data->length);
+            return J9SHR_RESOURCE_STORE_ERROR;
+        }
+    }
+
+    SH_AttachedDataManager::SH_AttachedDataResourceDescriptor descriptor(
+        storedData.address, (U_32)storedData.length, (U_16)storedData.type);
+
     if (localVerboseFlags & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) {
         char subcstr[VERBOSE_BUFFER_SIZE];
         const char* pSubcstr = subcstr;
@@ -3359,10 +3524,103 @@ SH_CacheMap::storeAttachedData(
         }
     }
 
+    if (NULL != compressionBuffer) {
+        j9mem_free_memory(compressionBuffer);
+    }
+
     Trc_SHR_CM_storeAttachedData_Exit3(currentThread, result);
     return result;
 }
 
+/**
+ * Build the cache image of attached data of a compressed type: a CompressedAttachedDataHeader followed by
+ * the encoded data, or by the data as it is if encoding does not make it smaller.
+ *
+ * @param[in] currentThread  The current VM thread
+ * @param[in] data The attached data to store
+ * @param[out] compressedData Set to the image to store in the cache; the type is unchanged
+ *
+ * @return The buffer holding the image, to be freed by the caller, or NULL if it cannot be allocated
+ */
+U_8*
+SH_CacheMap::compressAttachedData(
+    J9VMThread* currentThread, const J9SharedDataDescriptor* data, J9SharedDataDescriptor* compressedData)
+{
+    UDATA scratchBytes = SH_AttachedDataCodec::getScratchBytes();
+    U_8* buffer = NULL;
+    CompressedAttachedDataHeader* header = NULL;
+    UDATA encodedLength = 0;
+    PORT_ACCESS_FROM_PORT(_portlib);
+
+    buffer = (U_8*)j9mem_allocate_memory(
+        scratchBytes + sizeof(CompressedAttachedDataHeader) + data->length, J9MEM_CATEGORY_CLASSES);
+    if (NULL == buffer) {
+        return NULL;
+    }
+    header = (CompressedAttachedDataHeader*)(buffer + scratchBytes);
+    header->uncompressedLength = (U_32)data->length;
+
+    /* Limiting the output to less than the input makes the encoder give up as soon as it stops paying off */
+    if (0 != data->length) {
+        encodedLength = SH_AttachedDataCodec::encode(
+            data->address, data->length, CADHDATA(header), data->length - 1, buffer);
+    }
+    if (0 != encodedLength) {
+        header->encoding = J9SHR_ATTACHED_DATA_ENCODING_LZ;
+    } else {
+        header->encoding = J9SHR_ATTACHED_DATA_ENCODING_STORED;
+        memcpy(CADHDATA(header), data->address, data->length);
+        encodedLength = data->length;
+    }
+    Trc_SHR_CM_compressAttachedData(currentThread, data->type, data->length, encodedLength);
+
+    compressedData->address = (U_8*)header;
+    compressedData->length = sizeof(CompressedAttachedDataHeader) + encodedLength;
+    compressedData->type = data->type;
+    compressedData->flags = data->flags;
+    return buffer;
+}
+
+/**
+ * Copy attached data found in the cache to the caller's buffer, decompressing it if it is of a compressed type.
+ *
+ * @param[in] currentThread  The current VM thread
+ * @param[in] dest The caller's buffer, of at least length bytes
+ * @param[in] dataInCache The attached data in the cache
+ * @param[in] lengthInCache The length of the attached data in the cache
+ * @param[in] length The length of the data as it was stored
+ * @param[in] isCompressed True if dataInCache starts with a CompressedAttachedDataHeader
+ *
+ * @return true if dest was filled, false if the data in the cache is malformed
+ */
+bool
+SH_CacheMap::copyAttachedData(J9VMThread* currentThread, U_8* dest, const U_8* dataInCache, UDATA lengthInCache,
+    UDATA length, bool isCompressed)
+{
+    if (isCompressed) {
+        const CompressedAttachedDataHeader* header = (const CompressedAttachedDataHeader*)dataInCache;
+        bool rc = false;
+
+        if (lengthInCache >= sizeof(CompressedAttachedDataHeader)) {
+            UDATA payloadLength = lengthInCache - sizeof(CompressedAttachedDataHeader);
+
+            if (J9SHR_ATTACHED_DATA_ENCODING_LZ == CADHENCODING(header)) {
+                rc = SH_AttachedDataCodec::decode(CADHDATA(header), payloadLength, dest, length);
+            } else if ((J9SHR_ATTACHED_DATA_ENCODING_STORED == CADHENCODING(header)) && (payloadLength == length)) {
+                memcpy(dest, CADHDATA(header), length);
+                rc = true;
+            }
+        }
+        if (false == rc) {
+            Trc_SHR_CM_copyAttachedData_Malformed(currentThread, dataInCache, lengthInCache, length);
+        }
+        return rc;
+    }
+
+    memcpy(dest, dataInCache, length);
+    return true;
+}
+
 /**
  * Update the existing data at updateAtOffset with the given new data.
  *
@@ -3396,6 +3654,11 @@ SH_CacheMap::updateAttachedData(
         Trc_SHR_CM_updateAttachedData_Exit1(currentThread);
         return J9SHR_RESOURCE_STORE_ERROR;
     }
+    /* Compressed data cannot be patched in place */
+    if (SH_AttachedDataCodec::isCompressedType(*_runtimeFlags, data->type)) {
+        Trc_SHR_CM_updateAttachedData_Exit_Compressed(currentThread, data->type);
+        return J9SHR_RESOURCE_STORE_ERROR;
+    }
     if (localVerboseFlags & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_JITDATA) {
         char subcstr[VERBOSE_BUFFER_SIZE];
         const char* pSubcstr = subcstr;
@@ -3477,6 +3740,10 @@ SH_CacheMap::updateAttachedUDATA(
         Trc_SHR_CM_updateAttachedUDATA_Exit1(currentThread);
         return J9SHR_RESOURCE_STORE_ERROR;
     }
+    if (SH_AttachedDataCodec::isCompressedType(*_runtimeFlags, type)) {
+        Trc_SHR_CM_updateAttachedUDATA_Exit_Compressed(currentThread, type);
+        return J9SHR_RESOURCE_STORE_ERROR;
+    }
     data.address = (U_8*)&value;
     data.length = sizeof(UDATA);
     data.type = type;
@@ -3632,13 +3899,20 @@ const U_8* SH_CacheMap::findAttachedData(J9VMThread* currentThread, const void*
         currentThread, addressInCache, localADM, &descriptor, false, p_subcstr, NULL);
     if (NULL != result) {
         I_32 corrupt;
-        U_32 wrapperLength, dataLength;
+        U_32 wrapperLength, dataLength, lengthInCache;
         const AttachedDataWrapper* wrapper;
+        const U_8* dataInCache = result;
+        bool isCompressed = SH_AttachedDataCodec::isCompressedType(*_runtimeFlags, data->type);
 
         wrapperLength = descriptor.getWrapperLength();
         wrapper = (AttachedDataWrapper*)(result - wrapperLength);
 
-        dataLength = ADWLEN(wrapper);
+        lengthInCache = ADWLEN(wrapper);
+        dataLength = lengthInCache;
+        if (isCompressed && (lengthInCache >= sizeof(CompressedAttachedDataHeader))) {
+            /* The caller's buffer is sized for the data as it was stored */
+            dataLength = CADHUNCOMPRESSEDLEN((const CompressedAttachedDataHeader*)dataInCache);
+        }
         if (NULL != data->address) {
             if (data->length < dataLength) {
                 result = (U_8*)J9SHR_RESOURCE_STORE_ERROR;
@@ -3664,7 +3938,10 @@ const U_8* SH_CacheMap::findAttachedData(J9VMThread* currentThread, const void*
         }
 
         if (false == _ccHead->isRunningReadOnly()) {
-            memcpy(data->address, result, dataLength);
+            if (!copyAttachedData(currentThread, data->address, dataInCache, lengthInCache, dataLength, isCompressed)) {
+                result = NULL;
+                goto _exitWithError;
+            }
             data->length = dataLength;
             result = data->address;
             corrupt = ADWCORRUPT(wrapper);
@@ -3686,7 +3963,12 @@ const U_8* SH_CacheMap::findAttachedData(J9VMThread* currentThread, const void*
                 initialUpdateCount = ADWUPDATECOUNT(wrapper);
                 VM_AtomicSupport::readBarrier();
 
-                memcpy(data->address, result, dataLength);
+                /* Compressed data is never updated, so a successful decode is always consistent */
+                if (!copyAttachedData(
+                        currentThread, data->address, dataInCache, lengthInCache, dataLength, isCompressed)) {
+                    result = NULL;
+                    goto _exitWithError;
+                }
                 data->length = dataLength;
                 result = data->address;
                 VM_AtomicSupport::readBarrier();
@@ -4279,6 +4561,7 @@ SH_CacheMap::getJavacoreData(J9JavaVM* vm, J9SharedClassJavacoreDataDescriptor*
         UDATA type;
 
         descriptor->unindexedDataBytes = _bdm->getUnindexedDataBytes();
+        descriptor->zipCachePopulateTime = _bdm->getZipCachePopulateTime();
 
         descriptor->indexedDataBytes = 0;
         for (type = 0; type <= J9SHR_DATA_TYPE_MAX; type++) {
@@ -4327,6 +4610,7 @@ SH_CacheMap::getJavacoreData(J9JavaVM* vm, J9SharedClassJavacoreDataDescriptor*
         descriptor->startupHintBytes = 0;
         descriptor->numJclEntries = 0;
         descriptor->numZipCaches = 0;
+        descriptor->zipCachePopulateTime = 0;
         descriptor->numJitHints = 0;
         descriptor->numJitProfiles = 0;
         descriptor->numAotDataEntries = 0;
@@ -4337,6 +4621,7 @@ SH_CacheMap::getJavacoreData(J9JavaVM* vm, J9SharedClassJavacoreDataDescriptor*
 
     descriptor->objectBytes = 0;
     descriptor->numObjects = 0;
+    descriptor->jitProfileBytesSaved = 0;
 
     if (_adm && (MANAGER_STATE_STARTED == _adm->getState())) {
         UDATA type;
@@ -4347,6 +4632,7 @@ SH_CacheMap::getJavacoreData(J9JavaVM* vm, J9SharedClassJavacoreDataDescriptor*
             case J9SHR_ATTACHED_DATA_TYPE_JITPROFILE:
                 descriptor->jitProfileDataBytes += _adm->getDataBytesForType(type);
                 descriptor->numJitProfiles += _adm->getNumOfType(type);
+                descriptor->jitProfileBytesSaved += _adm->getSavedBytesForType(type);
                 break;
             case J9SHR_ATTACHED_DATA_TYPE_JITHINT:
                 descriptor->jitHintDataBytes += _adm->getDataBytesForType(type);
@@ -4360,6 +4646,10 @@ SH_CacheMap::getJavacoreData(J9JavaVM* vm, J9SharedClassJavacoreDataDescriptor*
         }
     }
 
+    descriptor->numLockedLookups = 0;
+    descriptor->numContendedLookups = 0;
+    getLookupStats(&descriptor->numLockedLookups, &descriptor->numContendedLookups);
+
     descriptor->romClassBytes += descriptor->unindexedDataBytes;
     descriptor->otherBytes = descriptor->cacheSize - ((UDATA)descriptor->metadataStart - (UDATA)descriptor->romClassEnd)
         - descriptor->aotBytes - descriptor->romClassBytes - descriptor->readWriteBytes - descriptor->zipCacheDataBytes
@@ -5125,6 +5415,12 @@ SH_CacheMap::printCacheStats(J9VMThread* currentThread, UDATA showFlags, U_64 ru
         } else {
             CACHEMAP_PRINT(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_RESTRICT_CLASSPATHS_FALSE);
         }
+        j9tty_printf(_portlib, "\t");
+        if (true == this->_cc->isCompressAttachedDataSet(currentThread)) {
+            CACHEMAP_PRINT(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_COMPRESS_ATTACHED_DATA_TRUE);
+        } else {
+            CACHEMAP_PRINT(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_COMPRESS_ATTACHED_DATA_FALSE);
+        }
 
         j9tty_printf(_portlib, "\t");
         if (J9_ARE_ALL_BITS_SET(javacoreData.feature, J9SH_FEATURE_COMPRESSED_POINTERS)) {
@@ -5190,6 +5486,10 @@ SH_CacheMap::printCacheStats(J9VMThread* currentThread, UDATA showFlags, U_64 ru
                 javacoreData.jitHintDataBytes);
             CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_JIT_PROFILE_BYTES,
                 javacoreData.jitProfileDataBytes);
+            if (true == this->_cc->isCompressAttachedDataSet(currentThread)) {
+                CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG,
+                    J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_JIT_PROFILE_BYTES_SAVED, javacoreData.jitProfileBytesSaved);
+            }
             CACHEMAP_FMTPRINT1(
                 J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_JIT_MIN, javacoreData.minJIT);
             CACHEMAP_FMTPRINT1(
@@ -5296,6 +5596,8 @@ SH_CacheMap::printCacheStats(J9VMThread* currentThread, UDATA showFlags, U_64 ru
         }
         CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_NUM_ZIP_CACHES_V2,
             javacoreData.numZipCaches);
+        CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_ZIP_CACHE_READ_TIME,
+            (UDATA)(javacoreData.zipCachePopulateTime / 1000));
         CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_NUM_STARTUP_HINTS,
             javacoreData.numStartupHints);
         if (runtimeFlags & J9SHR_RUNTIMEFLAG_ENABLE_DETAILED_STATS) {
@@ -7625,5 +7927,36 @@ void SH_CacheMap::updateLocalHintsData(J9VMThread* currentThread, J9SharedLocalS
             updatedHintsData.flags |= J9SHR_STARTUPHINTS_HEAPSIZES_SET;
         }
     }
+
+    if (J9_ARE_ALL_BITS_SET(
+            localHints->localStartupHintFlags, J9SHR_LOCAL_STARTUPHINTS_FLAG_OVERWRITE_STARTUP_PAGES)) {
+        if (overwrite) {
+            Trc_SHR_CM_updateLocalHintsData_WriteStartupPages(
+                currentThread, localHints->hintsData.startupPagesChunkSize);
+            if (J9_ARE_ALL_BITS_SET(updatedHintsData.flags, J9SHR_STARTUPHINTS_STARTUP_PAGES_SET)
+                && (updatedHintsData.startupPagesChunkSize == localHints->hintsData.startupPagesChunkSize)) {
+                /* another JVM with the same command line may have recorded other chunks since they were fetched */
+                for (UDATA i = 0; i < J9SHR_STARTUPHINTS_STARTUP_PAGES_WORDS; i++) {
+                    updatedHintsData.startupPages[i] |= localHints->hintsData.startupPages[i];
+                }
+            } else {
+                memcpy(updatedHintsData.startupPages, localHints->hintsData.startupPages,
+                    sizeof(updatedHintsData.startupPages));
+            }
+            updatedHintsData.startupPagesChunkSize = localHints->hintsData.startupPagesChunkSize;
+            updatedHintsData.flags |= J9SHR_STARTUPHINTS_STARTUP_PAGES_SET;
+        }
+    } else if (J9_ARE_ALL_BITS_SET(
+                   localHints->localStartupHintFlags, J9SHR_LOCAL_STARTUPHINTS_FLAG_STORE_STARTUP_PAGES)) {
+        if (J9_ARE_NO_BITS_SET(updatedHintsData.flags, J9SHR_STARTUPHINTS_STARTUP_PAGES_SET)) {
+            /* another JVM with the same command line may have recorded its startup pages first */
+            Trc_SHR_CM_updateLocalHintsData_WriteStartupPages(
+                currentThread, localHints->hintsData.startupPagesChunkSize);
+            updatedHintsData.startupPagesChunkSize = localHints->hintsData.startupPagesChunkSize;
+            memcpy(updatedHintsData.startupPages, localHints->hintsData.startupPages,
+                sizeof(updatedHintsData.startupPages));
+            updatedHintsData.flags |= J9SHR_STARTUPHINTS_STARTUP_PAGES_SET;
+        }
+    }
     memcpy(&localHints->hintsData, &updatedHintsData, sizeof(J9SharedStartupHintsDataDescriptor));
 }
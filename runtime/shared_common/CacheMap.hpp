@@ -38,6 +38,10 @@
 #define CM_READ_CACHE_FAILED -1
 #define CM_CACHE_CORRUPT -2
 
+#define CM_STARTUP_PAGES_BITS_PER_WORD (sizeof(UDATA) * 8)
+#define CM_STARTUP_PAGES_CHUNKS (J9SHR_STARTUPHINTS_STARTUP_PAGES_WORDS * CM_STARTUP_PAGES_BITS_PER_WORD)
+#define CM_STARTUP_PAGES_PREFAULT_MAX (64 * 1024 * 1024)
+
 typedef struct MethodSpecTable {
     char* className;
     char* methodName;
@@ -130,6 +134,10 @@ public:
 
     void dontNeedMetadata(J9VMThread* currentThread);
 
+    void recordStartupPages(J9VMThread* currentThread, J9SharedLocalStartupHints* localHints);
+
+    void prefaultStartupPages(J9VMThread* currentThread, const J9SharedStartupHintsDataDescriptor* hintsData);
+
     /**
      * This function is extremely hot.
      * Peeks to see whether compiled code exists for a given ROMMethod in the CompiledMethodManager hashtable
@@ -222,6 +230,9 @@ public:
     /* @see CacheMapStats.hpp */
     IDATA shutdownForStats(J9VMThread* currentThread);
 
+    /* @see CacheMapStats.hpp */
+    void getLookupStats(UDATA* lockedLookups, UDATA* contendedLookups);
+
     // New Functions To Support New ROM Class Builder
     IDATA startClassTransaction(J9VMThread* currentThread, bool lockCache, const char* caller);
     IDATA exitClassTransaction(J9VMThread* currentThread, const char* caller);
@@ -327,6 +338,8 @@ private:
     J9Pool* _ccPool;
     uintptr_t _minimumAccessedShrCacheMetadata;
     uintptr_t _maximumAccessedShrCacheMetadata;
+    UDATA _startupPagesChunkSize;
+    UDATA _startupPages[J9SHR_STARTUPHINTS_STARTUP_PAGES_WORDS];
     bool _metadataReleased;
 
     /* True iff (*_runtimeFlags & J9SHR_RUNTIMEFLAG_ENABLE_NESTED). Set in startup().
@@ -397,6 +410,12 @@ private:
     const U_8* findAttachedData(J9VMThread* currentThread, const void* addressInCache, J9SharedDataDescriptor* data,
         IDATA* corruptOffset, const char** p_subcstr);
 
+    U_8* compressAttachedData(
+        J9VMThread* currentThread, const J9SharedDataDescriptor* data, J9SharedDataDescriptor* compressedData);
+
+    bool copyAttachedData(J9VMThread* currentThread, U_8* dest, const U_8* dataInCache, UDATA lengthInCache,
+        UDATA length, bool isCompressed);
+
     void updateROMSegmentList(J9VMThread* currentThread, bool hasClassSegmentMutex);
 
     void updateROMSegmentListForCache(J9VMThread* currentThread, SH_CompositeCacheImpl* forCache);
@@ -432,6 +451,8 @@ private:
     void updateAllManagersWithNewCacheArea(J9VMThread* currentThread, SH_CompositeCacheImpl* newArea);
     void updateAccessedShrCacheMetadataBounds(J9VMThread* currentThread, uintptr_t const* result);
 
+    void markStartupPages(const void* address, UDATA length);
+
     SH_CompositeCacheImpl* getCacheAreaForDataType(J9VMThread* currentThread, UDATA dataType, UDATA dataLength);
 
     IDATA startManager(J9VMThread* currentThread, SH_Manager* manager);
@@ -39,6 +39,8 @@ public:
     virtual IDATA shutdownForStats(J9VMThread* currentThread) = 0;
 
     virtual UDATA getJavacoreData(J9JavaVM* vm, J9SharedClassJavacoreDataDescriptor* descriptor) = 0;
+
+    virtual void getLookupStats(UDATA* lockedLookups, UDATA* contendedLookups) = 0;
 };
 
 #endif /*CACHEMAPSTATS_H_INCLUDED*/
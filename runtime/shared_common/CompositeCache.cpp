@@ -1444,6 +1444,10 @@ SH_CompositeCacheImpl::startup(J9VMThread* currentThread, J9SharedClassPreinitCo
                         extraFlags |= J9SHR_EXTRA_FLAGS_RESTRICT_CLASSPATHS;
                     }
 
+                    if (J9_ARE_ALL_BITS_SET(*_runtimeFlags, J9SHR_RUNTIMEFLAG_COMPRESS_ATTACHED_DATA)) {
+                        extraFlags |= J9SHR_EXTRA_FLAGS_COMPRESS_ATTACHED_DATA;
+                    }
+
                     setCacheHeaderExtraFlags(currentThread, extraFlags);
 
                     setCacheAreaBoundaries(currentThread, piconfig);
@@ -1486,6 +1490,17 @@ SH_CompositeCacheImpl::startup(J9VMThread* currentThread, J9SharedClassPreinitCo
                             J9NLS_SHRC_OSCACHE_STARTUP_CANNOT_STORE_CLASSPATHS);
                     }
 
+                    /* The format of attached data is fixed when the cache is created, so the mode of the cache
+                     * overrides the command line.
+                     */
+                    if (isCompressAttachedDataSet(currentThread)) {
+                        *_runtimeFlags |= J9SHR_RUNTIMEFLAG_COMPRESS_ATTACHED_DATA;
+                    } else if (J9_ARE_ALL_BITS_SET(*_runtimeFlags, J9SHR_RUNTIMEFLAG_COMPRESS_ATTACHED_DATA)) {
+                        CC_TRACE(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_WARNING,
+                            J9NLS_SHRC_OSCACHE_STARTUP_COMPRESS_ATTACHED_DATA_IGNORED);
+                        *_runtimeFlags &= ~J9SHR_RUNTIMEFLAG_COMPRESS_ATTACHED_DATA;
+                    }
+
                     /* If cache is created with partialpage protection enabled then use the cache in that mode,
                      * and ignore any incompatible option like mprotect=nopartialpages or mprotect=none.
                      * Similarly, if the cache is created with mprotect=nopartialpages, then use the cache in that mode,
@@ -4895,6 +4910,21 @@ bool SH_CompositeCacheImpl::isRestrictClasspathsSet(J9VMThread* currentThread)
     return (0 != (this->_theca->extraFlags & J9SHR_EXTRA_FLAGS_RESTRICT_CLASSPATHS));
 }
 
+/**
+ * This function returns true if cache was created with "-Xshareclasses:compressAttachedData",
+ * false otherwise
+ *
+ * @param [in] currentThread Pointer to J9VMThread structure for the current thread
+ *
+ * @return 	true if J9SHR_EXTRA_FLAGS_COMPRESS_ATTACHED_DATA is set in shared cache header, false otherwise.
+ *
+ */
+bool SH_CompositeCacheImpl::isCompressAttachedDataSet(J9VMThread* currentThread)
+{
+    Trc_SHR_Assert_True(NULL != this->_theca);
+    return (0 != (this->_theca->extraFlags & J9SHR_EXTRA_FLAGS_COMPRESS_ATTACHED_DATA));
+}
+
 void SH_CompositeCacheImpl::setCacheHeaderExtraFlags(J9VMThread* currentThread, UDATA extraFlags)
 {
     Trc_SHR_Assert_True(NULL != this->_theca);
@@ -6092,6 +6122,26 @@ void SH_CompositeCacheImpl::dontNeedMetadata(J9VMThread* currentThread, const vo
 {
     _oscache->dontNeedMetadata(currentThread, startAddress, length);
 }
+
+/**
+ * Advise the OS that a section of the shared classes cache will be accessed soon.
+ * The section is widened to whole OS pages.
+ */
+void SH_CompositeCacheImpl::willNeedCacheData(J9VMThread* currentThread, const void* startAddress, size_t length)
+{
+    UDATA pageSize = _osPageSize;
+
+    if (0 == pageSize) {
+        PORT_ACCESS_FROM_PORT(_portlib);
+        pageSize = j9vmem_supported_page_sizes()[0];
+    }
+    if (0 != length) {
+        UDATA start = ROUND_DOWN_TO(pageSize, (UDATA)startAddress);
+        UDATA end = ROUND_UP_TO(pageSize, (UDATA)startAddress + length);
+
+        _oscache->willNeedCacheData(currentThread, (const void*)start, (size_t)(end - start));
+    }
+}
 /**
  * This function changes the permission of the page containing given address by marking the page as read-only or
  * read-write. The address may belong to either segment region, metadata region or class debug data region. If the
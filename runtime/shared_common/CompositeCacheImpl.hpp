@@ -398,11 +398,15 @@ public:
 
     bool isRestrictClasspathsSet(J9VMThread* currentThread);
 
+    bool isCompressAttachedDataSet(J9VMThread* currentThread);
+
     bool canStoreClasspaths(void) const;
 
     IDATA restoreFromSnapshot(J9JavaVM* vm, const char* cacheName, bool* cacheExist);
     void dontNeedMetadata(J9VMThread* currentThread, const void* startAddress, size_t length);
 
+    void willNeedCacheData(J9VMThread* currentThread, const void* startAddress, size_t length);
+
     void changePartialPageProtection(J9VMThread* currentThread, void* addr, bool readOnly, bool phaseCheck = true);
 
     void protectPartiallyFilledPages(J9VMThread* currentThread, bool protectSegmentPage = true,
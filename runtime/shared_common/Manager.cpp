@@ -54,7 +54,11 @@ SH_Manager::SH_Manager()
     , _isRunningNested(false)
     ,
 #endif
-    _state(0)
+    _readIndex(NULL)
+    , _readIndexSequence(0)
+    , _lockedLookups(0)
+    , _contendedLookups(0)
+    , _state(0)
 #if defined(J9SHR_CACHELET_SUPPORT)
     , _allCacheletsStarted(false)
 #endif
@@ -132,6 +136,8 @@ void SH_Manager::tearDownHashTable(J9VMThread* currentThread)
 {
     Trc_SHR_M_tearDownHashTable_Entry(currentThread, _managerType);
 
+    /* The index refers to links which are freed with the pools */
+    readIndexTearDown();
 #if defined(J9SHR_CACHELET_SUPPORT)
     _hints.destroy();
 #endif
@@ -392,9 +398,15 @@ SH_Manager::HashLinkedListImpl* SH_Manager::hllTableAdd(J9VMThread* currentThrea
     }
 
     while (retryCount < MONITOR_ENTER_RETRY_TIMES) {
+        bool contended = isHashTableContended();
+
         if (_cache->enterLocalMutex(currentThread, _htMutex, "hllTableMutex", "hllTableAdd") == 0) {
             HashLinkedListImpl** rc;
 
+            if (contended) {
+                _contendedLookups += 1;
+            }
+
             /* This call will not actually add the new item if there is already an entry of the same key in the
                hashtable. Instead, the value returned by hashTableAdd is passed back as the addToList parameter. The
                value returned by this function should then be linked to addToList */
@@ -405,6 +417,7 @@ SH_Manager::HashLinkedListImpl* SH_Manager::hllTableAdd(J9VMThread* currentThrea
             } else {
                 Trc_SHR_M_hllTableAdd_HashtableAdd(currentThread, rc);
                 *addToList = *rc;
+                readIndexPublish(currentThread, *rc);
             }
 
             _cache->exitLocalMutex(currentThread, _htMutex, "hllTableMutex", "hllTableAdd");
@@ -422,6 +435,7 @@ SH_Manager::HashLinkedListImpl* SH_Manager::hllTableAdd(J9VMThread* currentThrea
 }
 
 /* Hashtable lookup function. Returns value if found, otherwise returns NULL
+ * Entries already in the read index are returned without taking the hashtable mutex.
  * TODO: allowCacheletStart is a way to prevent recursive calls to hllTableLookup by reuniteOrphan.
  * However, it's possible for an orphan to be in a different cachelet to a ROMClass pointer, so need to work this out.
  */
@@ -432,6 +446,18 @@ SH_Manager::HashLinkedListImpl* SH_Manager::hllTableLookup(
 
     Trc_SHR_M_hllTableLookup_Entry(currentThread, nameLen, name);
 
+#if defined(J9SHR_CACHELET_SUPPORT)
+    /* Cachelets for the hint must be started under the hashtable mutex before the lookup */
+    if (!(_isRunningNested && allowCacheletStartup))
+#endif
+    {
+        result = readIndexLookup(currentThread, (U_8*)name, nameLen);
+        if (NULL != result) {
+            Trc_SHR_M_hllTableLookup_Exit2(currentThread, result);
+            return result;
+        }
+    }
+
     if (lockHashTable(currentThread, "hllTableLookup")) {
 #if defined(J9SHR_CACHELET_SUPPORT)
         if (_isRunningNested && allowCacheletStartup) {
@@ -443,6 +469,10 @@ SH_Manager::HashLinkedListImpl* SH_Manager::hllTableLookup(
         }
 #endif
         result = hllTableLookupHelper(currentThread, (U_8*)name, nameLen, 0, NULL);
+        _lockedLookups += 1;
+        if (NULL != result) {
+            readIndexPublish(currentThread, result);
+        }
         unlockHashTable(currentThread, "hllTableLookup");
     } else {
 #if defined(J9SHR_CACHELET_SUPPORT)
@@ -480,6 +510,144 @@ SH_Manager::HashLinkedListImpl* SH_Manager::hllTableLookupHelper(
     return (p_result ? *p_result : NULL);
 }
 
+/* Index of the first slot of the read index bucket for a hash value */
+#define READ_INDEX_BUCKET_START(hashValue) \
+    ((((hashValue) ^ ((hashValue) >> 13)) & (MANAGER_READ_INDEX_BUCKETS - 1)) * MANAGER_READ_INDEX_BUCKET_SLOTS)
+
+/**
+ * Find the hashtable entry for a key in the read index without taking the hashtable mutex.
+ *
+ * Entries are only published into the index with the hashtable mutex held, after the link has been
+ * initialized, and links are only freed by tearDownHashTable(), which first tears down the index.
+ * A reader that overlaps a tear down sees _readIndexSequence change and discards its result,
+ * as with a seqlock. Links in the index are never unlinked from the hashtable, so an entry found
+ * here is the same one hashTableFind() would return.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] key The key to find
+ * @param[in] keySize The length of the key
+ *
+ * @return The hashtable entry, or NULL if the key is not in the index
+ */
+SH_Manager::HashLinkedListImpl* SH_Manager::readIndexLookup(J9VMThread* currentThread, U_8* key, U_16 keySize)
+{
+    HashLinkedListImpl* result = NULL;
+    UDATA sequence = _readIndexSequence;
+    HashLinkedListImpl* volatile* index = NULL;
+
+    VM_AtomicSupport::readBarrier();
+    index = _readIndex;
+    if ((0 == (sequence & 1)) && (NULL != index)) {
+        UDATA hashValue = generateHash(currentThread->javaVM->internalVMFunctions, key, keySize);
+        HashLinkedListImpl* volatile* bucket = index + READ_INDEX_BUCKET_START(hashValue);
+
+        for (UDATA i = 0; i < MANAGER_READ_INDEX_BUCKET_SLOTS; i++) {
+            HashLinkedListImpl* candidate = bucket[i];
+
+            if ((NULL != candidate) && (candidate->_keySize == keySize)
+                && J9UTF8_DATA_EQUALS(candidate->_key, keySize, key, keySize)) {
+                result = candidate;
+                break;
+            }
+        }
+        VM_AtomicSupport::readBarrier();
+        if (sequence != _readIndexSequence) {
+            result = NULL;
+        }
+    }
+    return result;
+}
+
+/**
+ * Publish a hashtable entry into the read index. A full bucket evicts the slot chosen by the hash value;
+ * the evicted entry is still found through the hashtable.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] link The hashtable entry
+ *
+ * THREADING: Must be protected by hashtable mutex
+ */
+void SH_Manager::readIndexPublish(J9VMThread* currentThread, HashLinkedListImpl* link)
+{
+    PORT_ACCESS_FROM_PORT(_portlib);
+    UDATA hashValue = 0;
+    HashLinkedListImpl* volatile* bucket = NULL;
+    UDATA slot = 0;
+
+    if (NULL == link->_key) {
+        return;
+    }
+    if (NULL == _readIndex) {
+        UDATA indexBytes = sizeof(HashLinkedListImpl*) * MANAGER_READ_INDEX_BUCKETS * MANAGER_READ_INDEX_BUCKET_SLOTS;
+        HashLinkedListImpl** newIndex = (HashLinkedListImpl**)j9mem_allocate_memory(indexBytes, J9MEM_CATEGORY_CLASSES);
+
+        if (NULL == newIndex) {
+            /* Lookups keep using the hashtable */
+            return;
+        }
+        memset(newIndex, 0, indexBytes);
+        VM_AtomicSupport::writeBarrier();
+        _readIndex = newIndex;
+    }
+
+    hashValue = generateHash(currentThread->javaVM->internalVMFunctions, link->_key, link->_keySize);
+    bucket = _readIndex + READ_INDEX_BUCKET_START(hashValue);
+    slot = (hashValue >> 24) & (MANAGER_READ_INDEX_BUCKET_SLOTS - 1);
+    for (UDATA i = 0; i < MANAGER_READ_INDEX_BUCKET_SLOTS; i++) {
+        if (link == bucket[i]) {
+            return;
+        }
+        if (NULL == bucket[i]) {
+            slot = i;
+            break;
+        }
+    }
+    VM_AtomicSupport::writeBarrier();
+    bucket[slot] = link;
+}
+
+/**
+ * Free the read index. Concurrent lookups in the index see the sequence change and fall back to the hashtable.
+ *
+ * THREADING: Must be protected by hashtable mutex
+ */
+void SH_Manager::readIndexTearDown(void)
+{
+    PORT_ACCESS_FROM_PORT(_portlib);
+    HashLinkedListImpl* volatile* index = _readIndex;
+
+    _readIndexSequence += 1;
+    VM_AtomicSupport::writeBarrier();
+    _readIndex = NULL;
+    VM_AtomicSupport::writeBarrier();
+    _readIndexSequence += 1;
+    if (NULL != index) {
+        j9mem_free_memory((void*)index);
+    }
+}
+
+/**
+ * Returns true if another thread owns the hashtable mutex. Used to count contended acquisitions.
+ */
+bool SH_Manager::isHashTableContended(void)
+{
+    return (NULL != _htMutex) && (NULL != ((J9ThreadAbstractMonitor*)_htMutex)->owner);
+}
+
+/**
+ * Get the number of lookups which needed the hashtable mutex and the number of acquisitions of the
+ * mutex which had to wait for another thread. Lookups served by the read index are not counted, to keep
+ * them free of shared writes.
+ *
+ * @param[out] lockedLookups Incremented by the number of lookups which took the hashtable mutex
+ * @param[out] contendedLookups Incremented by the number of contended acquisitions of the hashtable mutex
+ */
+void SH_Manager::getLookupStats(UDATA* lockedLookups, UDATA* contendedLookups)
+{
+    *lockedLookups += _lockedLookups;
+    *contendedLookups += _contendedLookups;
+}
+
 #if defined(J9SHR_CACHELET_SUPPORT)
 
 /**
@@ -571,8 +739,13 @@ bool SH_Manager::lockHashTable(J9VMThread* currentThread, const char* funcName)
     IDATA retryCount = MONITOR_ENTER_RETRY_TIMES;
 
     while (retryCount-- > 0) {
+        bool contended = isHashTableContended();
+
         /* WARNING - currentThread can be NULL */
         if (_cache->enterLocalMutex(currentThread, _htMutex, _htMutexName, funcName) == 0) {
+            if (contended) {
+                _contendedLookups += 1;
+            }
             return true;
         }
     }
@@ -55,6 +55,10 @@
 
 #define MAX_TYPES_PER_MANAGER 3
 
+/* Size of the lock-free read index in front of the manager hashtable. Must be powers of 2. */
+#define MANAGER_READ_INDEX_BUCKETS 512
+#define MANAGER_READ_INDEX_BUCKET_SLOTS 4
+
 class SH_Managers;
 class SH_SharedCache;
 class SH_CacheMap;
@@ -206,6 +210,8 @@ public:
 
     bool isDataTypeRepresended(UDATA type);
 
+    void getLookupStats(UDATA* lockedLookups, UDATA* contendedLookups);
+
 protected:
     J9HashTable* _hashTable;
     SH_SharedCache* _cache;
@@ -232,6 +238,13 @@ protected:
 #if defined(J9SHR_CACHELET_SUPPORT)
     ManagerHintTable _hints;
 #endif
+    /* Lock-free index of the hashtable entries found or added by this JVM. See readIndexLookup(). */
+    HashLinkedListImpl* volatile* _readIndex;
+    /* Odd while _readIndex is being torn down. Only changed with _htMutex held. */
+    volatile UDATA _readIndexSequence;
+    /* Lookups which missed _readIndex and took _htMutex, and acquisitions of _htMutex which found it owned */
+    UDATA _lockedLookups;
+    UDATA _contendedLookups;
 
     /* Functions which must be implemented by manager subclasses */
 
@@ -321,6 +334,11 @@ private:
     HashLinkedListImpl* hllTableLookupHelper(
         J9VMThread* currentThread, U_8* key, U_16 keySize, UDATA hashValue, SH_CompositeCache* cachelet);
 
+    HashLinkedListImpl* readIndexLookup(J9VMThread* currentThread, U_8* key, U_16 keySize);
+    void readIndexPublish(J9VMThread* currentThread, HashLinkedListImpl* link);
+    void readIndexTearDown(void);
+    bool isHashTableContended(void);
+
     static UDATA countItemsInList(void* node, void* countData);
 
 #if defined(J9SHR_CACHELET_SUPPORT)
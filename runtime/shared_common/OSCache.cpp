@@ -431,6 +431,9 @@ SH_OSCache::commonStartup(J9JavaVM* vm, const char* ctrlDirName, UDATA cacheDirP
 /* override if the cache is persistent */
 void SH_OSCache::dontNeedMetadata(J9VMThread* currentThread, const void* startAddress, size_t length) { return; }
 
+/* override if the cache is persistent */
+void SH_OSCache::willNeedCacheData(J9VMThread* currentThread, const void* startAddress, size_t length) { return; }
+
 /* Function that initializes class variables common to OSCache subclasses */
 void SH_OSCache::commonInit(J9PortLibrary* portLibrary, UDATA generation)
 {
@@ -282,6 +282,8 @@ public:
 
     virtual void dontNeedMetadata(J9VMThread* currentThread, const void* startAddress, size_t length);
 
+    virtual void willNeedCacheData(J9VMThread* currentThread, const void* startAddress, size_t length);
+
 protected:
     /*This constructor should only be used by this class*/
     SH_OSCache() {};
@@ -26,6 +26,10 @@
  */
 
 #include <string.h>
+#if defined(LINUX)
+#include <errno.h>
+#include <sys/mman.h>
+#endif /* LINUX */
 #include "j2sever.h"
 #include "j9cfg.h"
 #include "j9port.h"
@@ -464,6 +468,19 @@ void SH_OSCachemmap::dontNeedMetadata(J9VMThread* currentThread, const void* sta
 #endif
 }
 
+/**
+ * Advise the OS that a section of the shared classes cache will be accessed soon,
+ * so that the pages can be read in from the cache file ahead of the first access
+ */
+void SH_OSCachemmap::willNeedCacheData(J9VMThread* currentThread, const void* startAddress, size_t length)
+{
+#if defined(LINUX)
+    if (0 != madvise((void*)startAddress, length, MADV_WILLNEED)) {
+        Trc_SHR_OSC_Mmap_willNeedCacheData_madviseFailed(currentThread, startAddress, length, errno);
+    }
+#endif /* LINUX */
+}
+
 /**
  * Destroy a persistent shared classes cache
  *
@@ -93,6 +93,7 @@ public:
 
     SH_CacheAccess isCacheAccessible(void) const;
     virtual void dontNeedMetadata(J9VMThread* currentThread, const void* startAddress, size_t length);
+    virtual void willNeedCacheData(J9VMThread* currentThread, const void* startAddress, size_t length);
 
 protected:
     virtual void* getAttachedMemory();
@@ -272,7 +272,8 @@ J9SharedClassesHelpText J9SHAREDCLASSESHELPTEXT[] = { { OPTION_HELP, J9NLS_SHRC_
     { OPTION_ENABLE_BCI, J9NLS_SHRC_SHRINIT_HELPTEXT_ENABLE_BCI, 0, 0 },
     { OPTION_DISABLE_BCI, J9NLS_SHRC_SHRINIT_HELPTEXT_DISABLE_BCI, 0, 0 },
     { OPTION_RESTRICT_CLASSPATHS, J9NLS_SHRC_SHRINIT_HELPTEXT_RESTRICT_CLASSPATHS, 0, 0 },
-    { OPTION_ALLOW_CLASSPATHS, J9NLS_SHRC_SHRINIT_HELPTEXT_ALLOW_CLASSPATHS, 0, 0 }, HELPTEXT_NEWLINE,
+    { OPTION_ALLOW_CLASSPATHS, J9NLS_SHRC_SHRINIT_HELPTEXT_ALLOW_CLASSPATHS, 0, 0 },
+    { OPTION_COMPRESS_ATTACHED_DATA, J9NLS_SHRC_SHRINIT_HELPTEXT_COMPRESS_ATTACHED_DATA, 0, 0 }, HELPTEXT_NEWLINE,
     { HELPTEXT_INVALIDATE_AOT_METHODS_OPTION, J9NLS_SHRC_SHRINIT_HELPTEXT_INVALIDATE_AOT_METHODS, 0, 0 },
     { HELPTEXT_REVALIDATE_AOT_METHODS_OPTION, J9NLS_SHRC_SHRINIT_HELPTEXT_REVALIDATE_AOT_METHODS, 0, 0 },
     { HELPTEXT_FIND_AOT_METHODS_OPTION, J9NLS_SHRC_SHRINIT_HELPTEXT_FIND_AOT_METHODS, 0, 0 }, HELPTEXT_NEWLINE,
@@ -401,6 +402,8 @@ J9SharedClassesOptions J9SHAREDCLASSESOPTIONS[] = { { OPTION_MORE_HELP, PARSE_TY
     { OPTION_STORAGE_KEY_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_ADD_STORAGE_KEY_EQUALS, 0 },
     { OPTION_RESTRICT_CLASSPATHS, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG, J9SHR_RUNTIMEFLAG_RESTRICT_CLASSPATHS },
     { OPTION_ALLOW_CLASSPATHS, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG, J9SHR_RUNTIMEFLAG_ALLOW_CLASSPATHS },
+    { OPTION_COMPRESS_ATTACHED_DATA, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG,
+        J9SHR_RUNTIMEFLAG_COMPRESS_ATTACHED_DATA },
     { OPTION_INVALIDATE_AOT_METHODS_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_INVALIDATE_AOT_METHODS_EQUALS,
         J9SHR_RUNTIMEFLAG_DO_NOT_CREATE_CACHE },
     { OPTION_REVALIDATE_AOT_METHODS_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_REVALIDATE_AOT_METHODS_EQUALS,
@@ -435,6 +438,7 @@ static J9Module* getModule(J9VMThread* vmThread, U_8* className, UDATA className
 static bool isFreeDiskSpaceLow(J9JavaVM* vm, U_64* maxsize);
 static char* generateStartupHintsKey(J9JavaVM* vm);
 static void fetchStartupHintsFromSharedCache(J9VMThread* vmThread);
+static void prefaultStartupPagesOfSharedCache(J9VMThread* currentThread);
 
 typedef struct J9SharedVerifyStringTable {
     void* romClassAreaStart;
@@ -3664,6 +3668,10 @@ j9shr_init(J9JavaVM* vm, UDATA loadFlags, UDATA* nonfatal)
 
     vm->sharedClassConfig->runtimeFlags |= J9SHR_RUNTIMEFLAG_CACHE_INITIALIZATION_COMPLETE;
 
+    if (J9VMDLLMAIN_OK == returnVal) {
+        prefaultStartupPagesOfSharedCache(currentThread);
+    }
+
     if (RESULT_DO_SNAPSHOTCACHE == parseResult) {
         *nonfatal = 0;
         if (0 == j9shr_createCacheSnapshot(vm, cacheName)) {
@@ -4833,6 +4841,8 @@ void j9shr_jvmPhaseChange(J9VMThread* currentThread, UDATA phase)
         /* OpenJ9 issue; https://github.com/eclipse/openj9/issues/3743
          * GC decides whether to calls vm->sharedClassConfig->storeGCHints() to store the GC hints into the shared
          * cache. */
+        ((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)
+            ->recordStartupPages(currentThread, &vm->sharedClassConfig->localStartupHints);
         storeStartupHintsToSharedCache(currentThread);
         if (J9_ARE_NO_BITS_SET(
                 vm->sharedClassConfig->runtimeFlags, J9SHR_RUNTIMEFLAG_MPROTECT_PARTIAL_PAGES_ON_STARTUP)) {
@@ -5126,6 +5136,23 @@ const U_8* storeStartupHintsToSharedCache(J9VMThread* currentThread)
     return ret;
 }
 
+/**
+ * This function asks the OS to read in the pages of the shared cache that a JVM with the same command line
+ * accessed during its startup, as recorded in the startup hints by SH_CacheMap::recordStartupPages().
+ * @param[in] currentThread  The current VM thread
+ *
+ */
+static void prefaultStartupPagesOfSharedCache(J9VMThread* currentThread)
+{
+    J9JavaVM* vm = currentThread->javaVM;
+
+    if (J9_ARE_ALL_BITS_SET(vm->sharedClassConfig->runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_PERSISTENT_CACHE)) {
+        fetchStartupHintsFromSharedCache(currentThread);
+        ((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)
+            ->prefaultStartupPages(currentThread, &vm->sharedClassConfig->localStartupHints.hintsData);
+    }
+}
+
 /**
  * Stores the GC hints into vm->sharedClassConfig->localStartupHints.hintsData. This function is not thread safe.
  * @param[in] vmThread  The current thread
@@ -183,6 +183,7 @@ typedef struct J9SharedClassesOptions {
 #define OPTION_STORAGE_KEY_EQUALS "storageKey="
 #define OPTION_RESTRICT_CLASSPATHS "restrictClasspaths"
 #define OPTION_ALLOW_CLASSPATHS "allowClasspaths"
+#define OPTION_COMPRESS_ATTACHED_DATA "compressAttachedData"
 #define OPTION_INVALIDATE_AOT_METHODS_EQUALS "invalidateAotMethods="
 #define OPTION_REVALIDATE_AOT_METHODS_EQUALS "revalidateAotMethods="
 #define OPTION_FIND_AOT_METHODS_EQUALS "findAotMethods="
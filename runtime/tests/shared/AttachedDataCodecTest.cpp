@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+extern "C" {
+#include "shrinit.h"
+}
+#include "AttachedDataCodec.hpp"
+#include "SCTestCommon.h"
+#include "main.h"
+
+#define CODEC_TEST_MAX_LENGTH (200 * 1024)
+
+/* Exports */
+extern "C" {
+IDATA testAttachedDataCodec(J9JavaVM* vm);
+}
+
+/* Function prototypes */
+static IDATA roundTripTest(J9JavaVM* vm, U_8* scratch, const U_8* data, UDATA length, bool expectSmaller);
+static IDATA malformedInputTest(J9JavaVM* vm, U_8* scratch);
+
+IDATA testAttachedDataCodec(J9JavaVM* vm)
+{
+    IDATA success = PASS;
+    IDATA rc = 0;
+    U_8* data = NULL;
+    U_8* scratch = NULL;
+    UDATA seed = 12345;
+    UDATA scratchBytes = SH_AttachedDataCodec::getScratchBytes()
+        + (2 * SH_AttachedDataCodec::getMaxEncodedLength(CODEC_TEST_MAX_LENGTH));
+
+    PORT_ACCESS_FROM_JAVAVM(vm);
+
+    REPORT_START("Attached Data Codec");
+
+    data = (U_8*)j9mem_allocate_memory(CODEC_TEST_MAX_LENGTH, J9MEM_CATEGORY_CLASSES);
+    scratch = (U_8*)j9mem_allocate_memory(scratchBytes, J9MEM_CATEGORY_CLASSES);
+    if ((NULL == data) || (NULL == scratch)) {
+        j9tty_printf(PORTLIB, "Failed to allocate memory for Attached Data Codec Test\n");
+        success = FAIL;
+        goto done;
+    }
+
+    SHC_TEST_ASSERT("Empty", roundTripTest(vm, scratch, data, 0, false), success, rc);
+
+    memcpy(data, "profile", 7);
+    SHC_TEST_ASSERT("Short", roundTripTest(vm, scratch, data, 7, false), success, rc);
+
+    /* profile-like data: small records with repeating fields */
+    for (UDATA i = 0; i < CODEC_TEST_MAX_LENGTH; i++) {
+        data[i] = (U_8)(((i % 16) < 8) ? (i / 64) : (i % 7));
+    }
+    SHC_TEST_ASSERT("Repetitive", roundTripTest(vm, scratch, data, 4096, true), success, rc);
+    SHC_TEST_ASSERT("Beyond window", roundTripTest(vm, scratch, data, CODEC_TEST_MAX_LENGTH, true), success, rc);
+
+    memset(data, 0x5A, CODEC_TEST_MAX_LENGTH);
+    SHC_TEST_ASSERT("Long run", roundTripTest(vm, scratch, data, CODEC_TEST_MAX_LENGTH, true), success, rc);
+
+    for (UDATA i = 0; i < CODEC_TEST_MAX_LENGTH; i++) {
+        seed = (seed * 1103515245) + 12345;
+        data[i] = (U_8)(seed >> 16);
+    }
+    SHC_TEST_ASSERT("Random", roundTripTest(vm, scratch, data, 65536, false), success, rc);
+
+    SHC_TEST_ASSERT("Malformed", malformedInputTest(vm, scratch), success, rc);
+
+done:
+    j9mem_free_memory(scratch);
+    j9mem_free_memory(data);
+
+    REPORT_SUMMARY("Attached Data Codec", success);
+
+    return success;
+}
+
+static IDATA
+roundTripTest(J9JavaVM* vm, U_8* scratch, const U_8* data, UDATA length, bool expectSmaller)
+{
+    U_8* encoded = scratch + SH_AttachedDataCodec::getScratchBytes();
+    UDATA capacity = SH_AttachedDataCodec::getMaxEncodedLength(length);
+    U_8* decoded = encoded + capacity;
+    UDATA encodedLength = 0;
+
+    PORT_ACCESS_FROM_JAVAVM(vm);
+
+    encodedLength = SH_AttachedDataCodec::encode(data, length, encoded, capacity, scratch);
+    if (0 == encodedLength) {
+        j9tty_printf(PORTLIB, "\tencoding %zu bytes did not fit in %zu bytes\n", length, capacity);
+        return 1;
+    }
+    if (expectSmaller && (encodedLength >= length)) {
+        j9tty_printf(PORTLIB, "\tencoding %zu bytes produced %zu bytes\n", length, encodedLength);
+        return 2;
+    }
+    if (!SH_AttachedDataCodec::decode(encoded, encodedLength, decoded, length)) {
+        j9tty_printf(PORTLIB, "\tdecoding %zu bytes failed\n", encodedLength);
+        return 3;
+    }
+    if (0 != memcmp(data, decoded, length)) {
+        j9tty_printf(PORTLIB, "\tdecoded data does not match the original\n");
+        return 4;
+    }
+    /* the encoded length must be exact: a shorter destination is rejected, not overrun */
+    if ((0 != length) && SH_AttachedDataCodec::decode(encoded, encodedLength, decoded, length - 1)) {
+        j9tty_printf(PORTLIB, "\tdecoding into a short buffer succeeded\n");
+        return 5;
+    }
+    return 0;
+}
+
+static IDATA
+malformedInputTest(J9JavaVM* vm, U_8* scratch)
+{
+    U_8* decoded = scratch + SH_AttachedDataCodec::getScratchBytes();
+    /* literal run longer than the input */
+    const U_8 longLiterals[] = { 0x50, 'a', 'b' };
+    /* match offset before the start of the output */
+    const U_8 badOffset[] = { 0x10, 'a', 0x02, 0x00, 0x00 };
+    /* match without a complete offset */
+    const U_8 truncatedOffset[] = { 0x10, 'a', 0x01 };
+
+    PORT_ACCESS_FROM_JAVAVM(vm);
+
+    if (SH_AttachedDataCodec::decode(longLiterals, sizeof(longLiterals), decoded, 5)) {
+        j9tty_printf(PORTLIB, "\toverlong literal run was accepted\n");
+        return 1;
+    }
+    if (SH_AttachedDataCodec::decode(badOffset, sizeof(badOffset), decoded, 5)) {
+        j9tty_printf(PORTLIB, "\tout of range match offset was accepted\n");
+        return 2;
+    }
+    if (SH_AttachedDataCodec::decode(truncatedOffset, sizeof(truncatedOffset), decoded, 5)) {
+        j9tty_printf(PORTLIB, "\ttruncated match offset was accepted\n");
+        return 3;
+    }
+    return 0;
+}
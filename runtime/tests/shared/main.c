@@ -71,6 +71,7 @@ IDATA testCacheDirPerm(J9JavaVM* vm);
 IDATA testCacheFull(J9JavaVM* vm);
 IDATA testProtectSharedCacheData(J9JavaVM* vm);
 IDATA testStartupHints(J9JavaVM* vm);
+IDATA testAttachedDataCodec(J9JavaVM* vm);
 
 UDATA
 buildChildCmdlineOption(int argc, char** argv, const char* options, char* newargv[SHRTEST_MAX_CMD_OPTS])
@@ -361,6 +362,9 @@ signalProtectedMain(struct J9PortLibrary* portLibrary, void* vargs)
     HEADING(PORTLIB, "Startup Hints Test");
     rc |= testStartupHints(vm);
 
+    HEADING(PORTLIB, "Attached Data Codec Test");
+    rc |= testAttachedDataCodec(vm);
+
     if ((*((JavaVM*)vm))->DestroyJavaVM((JavaVM*)vm) != JNI_OK) {
         args->shutdownPortLib = FALSE;
     }
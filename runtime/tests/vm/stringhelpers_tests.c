@@ -0,0 +1,557 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "j9comp.h"
+#include "j9.h"
+
+#include "testHelpers.h"
+#include "vm_api.h"
+
+/* Longest string data used by the tests; the benchmark uses up to STRINGTEST_BENCHMARK_MAX_LENGTH characters. */
+#define STRINGTEST_MAX_LENGTH 80
+#define STRINGTEST_BENCHMARK_MAX_LENGTH 4096
+#define STRINGTEST_BENCHMARK_CHARACTERS ((UDATA)16 * 1024 * 1024)
+#define STRINGTEST_UTF8_BENCHMARK_LENGTH ((UDATA)64 * 1024)
+#define STRINGTEST_UTF8_BENCHMARK_ITERATIONS 256
+
+extern UDATA isValidUtf8(const U_8* utf8Data, size_t length);
+
+/* Function prototypes. */
+static UDATA scalarCompareCompressedUnicodeData(const U_8* compressedData, const U_16* uncompressedData, UDATA length);
+static UDATA scalarMatchCompressedUnicodeToASCII(
+    const U_8* compressedData, UDATA translateDots, const U_8* utfData, UDATA length);
+static UDATA scalarMatchUncompressedUnicodeToASCII(
+    const U_16* uncompressedData, UDATA translateDots, const U_8* utfData, UDATA length);
+static IDATA testCompareCompressedUnicodeData(J9PortLibrary* portLib);
+static IDATA testMatchUnicodeToASCII(J9PortLibrary* portLib);
+static IDATA benchmarkStringCompare(J9PortLibrary* portLib);
+static UDATA scalarDecodeUTF8Char(const U_8* input, U_16* result);
+static UDATA scalarTranscodeUTF8(const U_8* utf8Data, UDATA length, U_16* unicodeData);
+static UDATA vectorTranscodeUTF8(const U_8* utf8Data, UDATA length, U_16* unicodeData);
+static UDATA fillUTF8BenchmarkData(U_8* utf8Data, UDATA length, UDATA kind);
+static IDATA testUTF8ASCIIRuns(J9PortLibrary* portLib);
+static IDATA testIsValidUtf8(J9PortLibrary* portLib);
+static IDATA benchmarkUTF8Transcode(J9PortLibrary* portLib);
+
+/* Reference implementations, matching the character at a time loops used for discontiguous arrays. */
+static UDATA scalarCompareCompressedUnicodeData(const U_8* compressedData, const U_16* uncompressedData, UDATA length)
+{
+    UDATA i;
+    for (i = 0; i < length; i++) {
+        if ((U_16)compressedData[i] != uncompressedData[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static UDATA scalarMatchCompressedUnicodeToASCII(
+    const U_8* compressedData, UDATA translateDots, const U_8* utfData, UDATA length)
+{
+    UDATA i;
+    for (i = 0; i < length; i++) {
+        U_8 unicodeChar = compressedData[i];
+        if (0 != (utfData[i] & 0x80)) {
+            break;
+        }
+        if (translateDots && ('.' == unicodeChar)) {
+            unicodeChar = '/';
+        }
+        if (unicodeChar != utfData[i]) {
+            break;
+        }
+    }
+    return i;
+}
+
+static UDATA scalarMatchUncompressedUnicodeToASCII(
+    const U_16* uncompressedData, UDATA translateDots, const U_8* utfData, UDATA length)
+{
+    UDATA i;
+    for (i = 0; i < length; i++) {
+        U_16 unicodeChar = uncompressedData[i];
+        if (0 != (utfData[i] & 0x80)) {
+            break;
+        }
+        if (translateDots && ('.' == unicodeChar)) {
+            unicodeChar = '/';
+        }
+        if (unicodeChar != (U_16)utfData[i]) {
+            break;
+        }
+    }
+    return i;
+}
+
+static IDATA testCompareCompressedUnicodeData(J9PortLibrary* portLib)
+{
+    PORT_ACCESS_FROM_PORT(portLib);
+    const char* testName = "testCompareCompressedUnicodeData";
+    U_8 compressed[STRINGTEST_MAX_LENGTH];
+    U_16 uncompressed[STRINGTEST_MAX_LENGTH];
+    UDATA length;
+
+    reportTestEntry(PORTLIB, testName);
+
+    /* Cover every length up to several vector widths, with Latin-1 characters above 0x7F */
+    for (length = 0; length < STRINGTEST_MAX_LENGTH; length++) {
+        UDATA i;
+        for (i = 0; i < length; i++) {
+            compressed[i] = (U_8)(0x20 + ((i * 37) % 0xDF));
+            uncompressed[i] = compressed[i];
+        }
+        if (1 != compareCompressedUnicodeData(compressed, uncompressed, length)) {
+            outputErrorMessage(TEST_ERROR_ARGS, "equal data of length %zu compared unequal\n", length);
+        }
+        /* A difference at every position, including one only in the high byte of the character, must be found */
+        for (i = 0; i < length; i++) {
+            U_16 original = uncompressed[i];
+            uncompressed[i] = (U_16)(original ^ 0x1);
+            if (0 != compareCompressedUnicodeData(compressed, uncompressed, length)) {
+                outputErrorMessage(TEST_ERROR_ARGS, "difference at %zu of %zu not found\n", i, length);
+            }
+            uncompressed[i] = (U_16)(original | 0x100);
+            if (0 != compareCompressedUnicodeData(compressed, uncompressed, length)) {
+                outputErrorMessage(TEST_ERROR_ARGS, "high byte difference at %zu of %zu not found\n", i, length);
+            }
+            uncompressed[i] = original;
+        }
+    }
+
+    return reportTestExit(PORTLIB, testName);
+}
+
+static IDATA testMatchUnicodeToASCII(J9PortLibrary* portLib)
+{
+    PORT_ACCESS_FROM_PORT(portLib);
+    const char* testName = "testMatchUnicodeToASCII";
+    const char* className = "java.lang.invoke.MethodHandles$Lookup.findVirtual.internal";
+    U_8 compressed[STRINGTEST_MAX_LENGTH];
+    U_16 uncompressed[STRINGTEST_MAX_LENGTH];
+    U_8 utf[STRINGTEST_MAX_LENGTH];
+    UDATA length = strlen(className);
+    UDATA translateDots;
+    UDATA i;
+
+    reportTestEntry(PORTLIB, testName);
+
+    for (i = 0; i < length; i++) {
+        compressed[i] = (U_8)className[i];
+        uncompressed[i] = (U_16)className[i];
+    }
+
+    for (translateDots = 0; translateDots < 2; translateDots++) {
+        UDATA stop;
+        for (i = 0; i < length; i++) {
+            utf[i] = (translateDots && ('.' == className[i])) ? '/' : (U_8)className[i];
+        }
+        if (length != matchCompressedUnicodeToASCII(compressed, translateDots, utf, length)) {
+            outputErrorMessage(TEST_ERROR_ARGS, "compressed match failed, translateDots=%zu\n", translateDots);
+        }
+        if (length != matchUncompressedUnicodeToASCII(uncompressed, translateDots, utf, length)) {
+            outputErrorMessage(TEST_ERROR_ARGS, "uncompressed match failed, translateDots=%zu\n", translateDots);
+        }
+        /* Matching must stop at the first mismatch and at the first multi-byte UTF8 sequence */
+        for (stop = 0; stop < length; stop++) {
+            U_8 original = utf[stop];
+            UDATA expected;
+
+            utf[stop] = (U_8)(original ^ 0x1);
+            expected = scalarMatchCompressedUnicodeToASCII(compressed, translateDots, utf, length);
+            if (expected != matchCompressedUnicodeToASCII(compressed, translateDots, utf, length)) {
+                outputErrorMessage(TEST_ERROR_ARGS, "compressed mismatch at %zu not found\n", stop);
+            }
+            expected = scalarMatchUncompressedUnicodeToASCII(uncompressed, translateDots, utf, length);
+            if (expected != matchUncompressedUnicodeToASCII(uncompressed, translateDots, utf, length)) {
+                outputErrorMessage(TEST_ERROR_ARGS, "uncompressed mismatch at %zu not found\n", stop);
+            }
+            utf[stop] = 0xC3;
+            if (stop != matchCompressedUnicodeToASCII(compressed, translateDots, utf, length)) {
+                outputErrorMessage(TEST_ERROR_ARGS, "compressed match did not stop at UTF8 sequence %zu\n", stop);
+            }
+            if (stop != matchUncompressedUnicodeToASCII(uncompressed, translateDots, utf, length)) {
+                outputErrorMessage(TEST_ERROR_ARGS, "uncompressed match did not stop at UTF8 sequence %zu\n", stop);
+            }
+            utf[stop] = original;
+        }
+    }
+
+    return reportTestExit(PORTLIB, testName);
+}
+
+/*
+ * Time the vector helpers against the character at a time loops over a range of string lengths,
+ * for compressed and uncompressed strings. Results are reported, never checked.
+ */
+static IDATA benchmarkStringCompare(J9PortLibrary* portLib)
+{
+    PORT_ACCESS_FROM_PORT(portLib);
+    const char* testName = "benchmarkStringCompare";
+    static const UDATA lengths[] = { 8, 16, 32, 64, 256, 1024, STRINGTEST_BENCHMARK_MAX_LENGTH };
+    U_8* compressed = NULL;
+    U_16* uncompressed = NULL;
+    U_8* utf = NULL;
+    UDATA lengthIndex;
+    UDATA volatile sink = 0;
+
+    reportTestEntry(PORTLIB, testName);
+
+    compressed = j9mem_allocate_memory(STRINGTEST_BENCHMARK_MAX_LENGTH, OMRMEM_CATEGORY_VM);
+    uncompressed = j9mem_allocate_memory(STRINGTEST_BENCHMARK_MAX_LENGTH * sizeof(U_16), OMRMEM_CATEGORY_VM);
+    utf = j9mem_allocate_memory(STRINGTEST_BENCHMARK_MAX_LENGTH, OMRMEM_CATEGORY_VM);
+    if ((NULL == compressed) || (NULL == uncompressed) || (NULL == utf)) {
+        outputErrorMessage(TEST_ERROR_ARGS, "failed to allocate benchmark data\n");
+        goto done;
+    }
+    for (lengthIndex = 0; lengthIndex < STRINGTEST_BENCHMARK_MAX_LENGTH; lengthIndex++) {
+        /* Package style names: the dots are translated to slashes in the UTF8 data */
+        U_8 c = (U_8)((7 == (lengthIndex % 8)) ? '.' : ('a' + (lengthIndex % 26)));
+        compressed[lengthIndex] = c;
+        uncompressed[lengthIndex] = c;
+        utf[lengthIndex] = ('.' == c) ? '/' : c;
+    }
+
+    outputComment(PORTLIB, "%8s %14s %12s %12s\n", "length", "mode", "scalar(ns)", "vector(ns)");
+    for (lengthIndex = 0; lengthIndex < sizeof(lengths) / sizeof(lengths[0]); lengthIndex++) {
+        UDATA length = lengths[lengthIndex];
+        UDATA iterations = STRINGTEST_BENCHMARK_CHARACTERS / length;
+        UDATA mode;
+
+        for (mode = 0; mode < 3; mode++) {
+            const char* modeName = NULL;
+            U_64 scalarTime = 0;
+            U_64 vectorTime = 0;
+            U_64 start = 0;
+            UDATA i;
+
+            switch (mode) {
+            case 0:
+                modeName = "compressed";
+                start = j9time_hires_clock();
+                for (i = 0; i < iterations; i++) {
+                    sink += scalarMatchCompressedUnicodeToASCII(compressed, TRUE, utf, length);
+                }
+                scalarTime = j9time_hires_delta(start, j9time_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+                start = j9time_hires_clock();
+                for (i = 0; i < iterations; i++) {
+                    sink += matchCompressedUnicodeToASCII(compressed, TRUE, utf, length);
+                }
+                vectorTime = j9time_hires_delta(start, j9time_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+                break;
+            case 1:
+                modeName = "uncompressed";
+                start = j9time_hires_clock();
+                for (i = 0; i < iterations; i++) {
+                    sink += scalarMatchUncompressedUnicodeToASCII(uncompressed, TRUE, utf, length);
+                }
+                scalarTime = j9time_hires_delta(start, j9time_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+                start = j9time_hires_clock();
+                for (i = 0; i < iterations; i++) {
+                    sink += matchUncompressedUnicodeToASCII(uncompressed, TRUE, utf, length);
+                }
+                vectorTime = j9time_hires_delta(start, j9time_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+                break;
+            default:
+                modeName = "mixed";
+                start = j9time_hires_clock();
+                for (i = 0; i < iterations; i++) {
+                    sink += scalarCompareCompressedUnicodeData(compressed, uncompressed, length);
+                }
+                scalarTime = j9time_hires_delta(start, j9time_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+                start = j9time_hires_clock();
+                for (i = 0; i < iterations; i++) {
+                    sink += compareCompressedUnicodeData(compressed, uncompressed, length);
+                }
+                vectorTime = j9time_hires_delta(start, j9time_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+                break;
+            }
+            outputComment(PORTLIB, "%8zu %14s %12llu %12llu\n", length, modeName, scalarTime / iterations,
+                vectorTime / iterations);
+        }
+    }
+
+done:
+    j9mem_free_memory(utf);
+    j9mem_free_memory(uncompressed);
+    j9mem_free_memory(compressed);
+    return reportTestExit(PORTLIB, testName);
+}
+
+/* Same decoding as VM_VMHelpers::decodeUTF8Char, which is not available to C code. */
+static UDATA scalarDecodeUTF8Char(const U_8* input, U_16* result)
+{
+    U_8 c = input[0];
+    UDATA consumed = 1;
+    *result = (U_16)c;
+    if (0xC0 == (c & 0xE0)) {
+        *result = (U_16)(((c & 0x1F) << 6) | (input[1] & 0x3F));
+        consumed = 2;
+    } else if (0xE0 == (c & 0xF0)) {
+        *result = (U_16)(((c & 0x0F) << 12) | ((input[1] & 0x3F) << 6) | (input[2] & 0x3F));
+        consumed = 3;
+    }
+    return consumed;
+}
+
+static UDATA scalarTranscodeUTF8(const U_8* utf8Data, UDATA length, U_16* unicodeData)
+{
+    U_16* start = unicodeData;
+    while (length > 0) {
+        UDATA consumed = scalarDecodeUTF8Char(utf8Data, unicodeData);
+        unicodeData += 1;
+        utf8Data += consumed;
+        length -= consumed;
+    }
+    return (UDATA)(unicodeData - start);
+}
+
+/* The loop used by copyUTF8ToUnicode for contiguous arrays. */
+static UDATA vectorTranscodeUTF8(const U_8* utf8Data, UDATA length, U_16* unicodeData)
+{
+    U_16* start = unicodeData;
+    while (length > 0) {
+        UDATA widened = widenUTF8ASCIIToUnicode(utf8Data, unicodeData, length, FALSE);
+        UDATA asciiRunLength = 0;
+        unicodeData += widened;
+        utf8Data += widened;
+        length -= widened;
+        /* as in copyUTF8ToUnicode, short single byte runs are decoded inline */
+        while ((length > 0) && (asciiRunLength < 8)) {
+            UDATA consumed = scalarDecodeUTF8Char(utf8Data, unicodeData);
+            asciiRunLength = (1 == consumed) ? (asciiRunLength + 1) : 0;
+            unicodeData += 1;
+            utf8Data += consumed;
+            length -= consumed;
+        }
+    }
+    return (UDATA)(unicodeData - start);
+}
+
+/*
+ * Fill utf8Data with valid modified UTF8 of the given kind: 0 is ASCII, 1 is Latin-1 text (one accented
+ * character in eight) and 2 mixes ASCII words with three byte CJK characters. Returns the bytes written.
+ */
+static UDATA fillUTF8BenchmarkData(U_8* utf8Data, UDATA length, UDATA kind)
+{
+    UDATA written = 0;
+    UDATA i = 0;
+    while ((written + 3) <= length) {
+        if ((1 == kind) && (7 == (i % 8))) {
+            /* U+00E9 */
+            utf8Data[written++] = 0xC3;
+            utf8Data[written++] = 0xA9;
+        } else if ((2 == kind) && (0 != (i % 4))) {
+            /* U+4E2D */
+            utf8Data[written++] = 0xE4;
+            utf8Data[written++] = 0xB8;
+            utf8Data[written++] = 0xAD;
+        } else {
+            utf8Data[written++] = (U_8)('a' + (i % 26));
+        }
+        i += 1;
+    }
+    return written;
+}
+
+static IDATA testUTF8ASCIIRuns(J9PortLibrary* portLib)
+{
+    PORT_ACCESS_FROM_PORT(portLib);
+    const char* testName = "testUTF8ASCIIRuns";
+    static const U_8 stopBytes[] = { 0x00, 0x80, 0xC3 };
+    U_8 utf[STRINGTEST_MAX_LENGTH];
+    U_8 bytes[STRINGTEST_MAX_LENGTH];
+    U_16 chars[STRINGTEST_MAX_LENGTH];
+    UDATA length;
+
+    reportTestEntry(PORTLIB, testName);
+
+    for (length = 1; length < STRINGTEST_MAX_LENGTH; length++) {
+        UDATA stop;
+        for (stop = 0; stop <= length; stop++) {
+            UDATA stopIndex;
+            for (stopIndex = 0; stopIndex < sizeof(stopBytes); stopIndex++) {
+                U_8 stopByte = stopBytes[stopIndex];
+                /* NUL is a single byte for the decoding helpers but not for validation and encoding */
+                UDATA decodeStop = ((0 == stopByte) && (stop < length)) ? length : stop;
+                UDATA i;
+
+                for (i = 0; i < length; i++) {
+                    utf[i] = (0 == (i % 5)) ? '/' : (U_8)('a' + (i % 26));
+                    chars[i] = utf[i];
+                }
+                if (stop < length) {
+                    utf[stop] = stopByte;
+                    chars[stop] = (0 == stopByte) ? 0 : (U_16)(stopByte << 1);
+                }
+                if (stop != countUTF8ASCIIPrefix(utf, length)) {
+                    outputErrorMessage(TEST_ERROR_ARGS, "count stopped wrongly at %zu of %zu\n", stop, length);
+                }
+                memset(bytes, 0, sizeof(bytes));
+                if (decodeStop != copyUTF8ASCIIToCompressedUnicode(utf, bytes, length, TRUE)) {
+                    outputErrorMessage(TEST_ERROR_ARGS, "copy stopped wrongly at %zu of %zu\n", stop, length);
+                }
+                if (decodeStop != widenUTF8ASCIIToUnicode(utf, chars, length, TRUE)) {
+                    outputErrorMessage(TEST_ERROR_ARGS, "widen stopped wrongly at %zu of %zu\n", stop, length);
+                }
+                for (i = 0; i < decodeStop; i++) {
+                    U_8 expected = ('/' == utf[i]) ? '.' : utf[i];
+                    if ((expected != bytes[i]) || (expected != chars[i])) {
+                        outputErrorMessage(TEST_ERROR_ARGS, "bad translation at %zu of %zu\n", i, length);
+                        break;
+                    }
+                }
+                /* chars now holds '.' where utf held '/': narrowing must translate them back */
+                if (stop < length) {
+                    chars[stop] = (0 == stopByte) ? 0 : (U_16)(stopByte << 1);
+                }
+                if (stop != narrowUnicodeToUTF8ASCII(chars, bytes, length, TRUE)) {
+                    outputErrorMessage(TEST_ERROR_ARGS, "narrow stopped wrongly at %zu of %zu\n", stop, length);
+                }
+                if (0 != memcmp(bytes, utf, stop)) {
+                    outputErrorMessage(TEST_ERROR_ARGS, "bad narrowing of length %zu\n", length);
+                }
+                if (stop != copyCompressedUnicodeToUTF8ASCII(utf, bytes, length, FALSE)) {
+                    outputErrorMessage(
+                        TEST_ERROR_ARGS, "compressed copy stopped wrongly at %zu of %zu\n", stop, length);
+                }
+            }
+        }
+    }
+
+    return reportTestExit(PORTLIB, testName);
+}
+
+static IDATA testIsValidUtf8(J9PortLibrary* portLib)
+{
+    PORT_ACCESS_FROM_PORT(portLib);
+    const char* testName = "testIsValidUtf8";
+    U_8 utf[STRINGTEST_MAX_LENGTH];
+    UDATA length;
+
+    reportTestEntry(PORTLIB, testName);
+
+    for (length = 0; length < (STRINGTEST_MAX_LENGTH - 3); length++) {
+        memset(utf, 'x', length);
+        if (!isValidUtf8(utf, length)) {
+            outputErrorMessage(TEST_ERROR_ARGS, "ASCII of length %zu rejected\n", length);
+        }
+        /* valid two and three byte sequences after the ASCII run */
+        utf[length] = 0xC3;
+        utf[length + 1] = 0xA9;
+        if (!isValidUtf8(utf, length + 2)) {
+            outputErrorMessage(TEST_ERROR_ARGS, "two byte sequence after %zu bytes rejected\n", length);
+        }
+        utf[length] = 0xE4;
+        utf[length + 1] = 0xB8;
+        utf[length + 2] = 0xAD;
+        if (!isValidUtf8(utf, length + 3)) {
+            outputErrorMessage(TEST_ERROR_ARGS, "three byte sequence after %zu bytes rejected\n", length);
+        }
+        /* truncated sequence and embedded NUL */
+        if (isValidUtf8(utf, length + 2)) {
+            outputErrorMessage(TEST_ERROR_ARGS, "truncated sequence after %zu bytes accepted\n", length);
+        }
+        utf[length] = 0;
+        if (isValidUtf8(utf, length + 1)) {
+            outputErrorMessage(TEST_ERROR_ARGS, "NUL after %zu bytes accepted\n", length);
+        }
+    }
+
+    return reportTestExit(PORTLIB, testName);
+}
+
+/*
+ * Report validation and transcoding throughput for ASCII, Latin-1 and mixed multi-byte input.
+ * Results are reported, never checked.
+ */
+static IDATA benchmarkUTF8Transcode(J9PortLibrary* portLib)
+{
+    PORT_ACCESS_FROM_PORT(portLib);
+    const char* testName = "benchmarkUTF8Transcode";
+    static const char* kindNames[] = { "ASCII", "Latin-1", "multibyte" };
+    U_8* utf = NULL;
+    U_16* chars = NULL;
+    UDATA kind;
+    UDATA volatile sink = 0;
+
+    reportTestEntry(PORTLIB, testName);
+
+    utf = j9mem_allocate_memory(STRINGTEST_UTF8_BENCHMARK_LENGTH, OMRMEM_CATEGORY_VM);
+    chars = j9mem_allocate_memory(STRINGTEST_UTF8_BENCHMARK_LENGTH * sizeof(U_16), OMRMEM_CATEGORY_VM);
+    if ((NULL == utf) || (NULL == chars)) {
+        outputErrorMessage(TEST_ERROR_ARGS, "failed to allocate benchmark data\n");
+        goto done;
+    }
+
+    outputComment(PORTLIB, "%10s %14s %14s %14s\n", "input", "validate(MB/s)", "scalar(MB/s)", "vector(MB/s)");
+    for (kind = 0; kind < sizeof(kindNames) / sizeof(kindNames[0]); kind++) {
+        UDATA length = fillUTF8BenchmarkData(utf, STRINGTEST_UTF8_BENCHMARK_LENGTH, kind);
+        U_64 totalBytes = (U_64)length * STRINGTEST_UTF8_BENCHMARK_ITERATIONS;
+        U_64 validateTime = 0;
+        U_64 scalarTime = 0;
+        U_64 vectorTime = 0;
+        U_64 start = 0;
+        UDATA i;
+
+        start = j9time_hires_clock();
+        for (i = 0; i < STRINGTEST_UTF8_BENCHMARK_ITERATIONS; i++) {
+            sink += isValidUtf8(utf, length);
+        }
+        validateTime = j9time_hires_delta(start, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+        start = j9time_hires_clock();
+        for (i = 0; i < STRINGTEST_UTF8_BENCHMARK_ITERATIONS; i++) {
+            sink += scalarTranscodeUTF8(utf, length, chars);
+        }
+        scalarTime = j9time_hires_delta(start, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+        start = j9time_hires_clock();
+        for (i = 0; i < STRINGTEST_UTF8_BENCHMARK_ITERATIONS; i++) {
+            sink += vectorTranscodeUTF8(utf, length, chars);
+        }
+        vectorTime = j9time_hires_delta(start, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+
+        /* bytes per microsecond is MB/s */
+        outputComment(PORTLIB, "%10s %14llu %14llu %14llu\n", kindNames[kind],
+            totalBytes / ((0 == validateTime) ? 1 : validateTime), totalBytes / ((0 == scalarTime) ? 1 : scalarTime),
+            totalBytes / ((0 == vectorTime) ? 1 : vectorTime));
+    }
+
+done:
+    j9mem_free_memory(chars);
+    j9mem_free_memory(utf);
+    return reportTestExit(PORTLIB, testName);
+}
+
+IDATA
+testStringHelpers(J9PortLibrary* portLib)
+{
+    PORT_ACCESS_FROM_PORT(portLib);
+    IDATA rc = 0;
+
+    HEADING(PORTLIB, "testStringHelpers");
+    rc |= testCompareCompressedUnicodeData(PORTLIB);
+    rc |= testMatchUnicodeToASCII(PORTLIB);
+    rc |= benchmarkStringCompare(PORTLIB);
+    rc |= testUTF8ASCIIRuns(PORTLIB);
+    rc |= testIsValidUtf8(PORTLIB);
+    rc |= benchmarkUTF8Transcode(PORTLIB);
+    return rc;
+}
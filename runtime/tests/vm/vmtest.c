@@ -27,8 +27,10 @@
 
 #define VMTEST_ALL ((UDATA)0xFFFFFFFF)
 #define VMTEST_RESOLVEFIELD ((UDATA)0x00000001)
+#define VMTEST_STRINGHELPERS ((UDATA)0x00000002)
 
 extern IDATA testResolveField(J9PortLibrary* portLib);
+extern IDATA testStringHelpers(J9PortLibrary* portLib);
 
 static BOOLEAN startsWith(const char* s, const char* prefix)
 {
@@ -80,6 +82,8 @@ static UDATA parseForAreasToTests(struct J9PortLibrary* portLibrary, const char*
     while ('\0' != *allOptions) {
         if (consumeOption(&allOptions, "resolvefield")) {
             tests |= VMTEST_RESOLVEFIELD;
+        } else if (consumeOption(&allOptions, "stringhelpers")) {
+            tests |= VMTEST_STRINGHELPERS;
         } else {
             j9tty_printf(portLibrary, "\n\nWarning: invalid option (%s) ignored\n\n", allOptions);
             break;
@@ -137,6 +141,10 @@ signalProtectedMain(struct J9PortLibrary* portLibrary, void* arg)
         rc |= testResolveField(PORTLIB);
     }
 
+    if (VMTEST_STRINGHELPERS == (areasToTest & VMTEST_STRINGHELPERS)) {
+        rc |= testStringHelpers(PORTLIB);
+    }
+
     if (rc) {
         dumpTestFailuresToConsole(portLibrary);
     } else {
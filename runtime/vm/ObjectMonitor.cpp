@@ -47,8 +47,19 @@ extern "C" {
 
 #define J9VM_SAMPLE_TIMESTAMP_FREQUENCY 1024
 
+/* Adaptive object monitor spinning (-Xthr:adaptObjectSpin). The try-enter spin and yield budgets of an inflated
+ * monitor are shifted right by spinBudgetShift. The shift is re-evaluated after every window of contended enters:
+ * it grows when fewer than a quarter of them were won by spinning and shrinks when at least three quarters were.
+ */
+#define J9VM_ADAPTIVE_SPIN_WINDOW 32
+#define J9VM_ADAPTIVE_SPIN_MAX_SHIFT 6
+
 static bool spinOnFlatLock(J9VMThread* currentThread, j9objectmonitor_t volatile* lwEA, j9object_t object);
 
+static void updateAdaptiveSpin(J9ObjectMonitor* objectMonitor, bool acquired);
+
+static void updateAdaptiveHoldTime(J9JavaVM* vm, J9ObjectMonitor* objectMonitor, U_64 parkStartTime);
+
 static bool spinOnTryEnter(
     J9VMThread* currentThread, J9ObjectMonitor* objectMonitor, j9objectmonitor_t volatile* lwEA, j9object_t object);
 
@@ -161,6 +172,12 @@ objectMonitorEnterBlocking(J9VMThread* currentThread)
          * using the sequence 1, 4, 16, 64 and then 64 thereafter.
          */
         IDATA waitTime = 1;
+        /* The time spent parked approximates how long the owner holds the lock */
+        U_64 parkStartTime = 0;
+        if (0 != vm->thrAdaptiveObjectSpin) {
+            PORT_ACCESS_FROM_JAVAVM(vm);
+            parkStartTime = j9time_hires_clock();
+        }
         if (J9_EVENT_IS_HOOKED(vm->hookInterface, J9HOOK_VM_MONITOR_CONTENDED_ENTER)) {
             bool frameBuilt = saveBlockingEnterObject(currentThread);
             ALWAYS_TRIGGER_J9HOOK_VM_MONITOR_CONTENDED_ENTER(vm->hookInterface, currentThread, monitor);
@@ -238,6 +255,9 @@ objectMonitorEnterBlocking(J9VMThread* currentThread)
             }
         }
     done:
+        if (0 != vm->thrAdaptiveObjectSpin) {
+            updateAdaptiveHoldTime(vm, objectMonitor, parkStartTime);
+        }
         clearEventFlag(currentThread, J9_PUBLIC_FLAGS_THREAD_BLOCKED);
         /* Clear the SUPPRESS_CONTENDED_EXITS bit in the monitor saying that CONTENDED EXIT can be sent again */
         ((J9ThreadMonitor*)monitor)->flags &= ~(UDATA)J9THREAD_MONITOR_SUPPRESS_CONTENDED_EXIT;
@@ -471,6 +491,20 @@ static bool spinOnTryEnter(
     UDATA const tryEnterSpinCount1 = vm->thrMaxTryEnterSpins1BeforeBlocking;
 #endif /* J9VM_INTERP_CUSTOM_SPIN_OPTIONS */
 
+    bool const adaptiveSpin = (0 != vm->thrAdaptiveObjectSpin);
+    if (adaptiveSpin) {
+        /* Shrink the budgets of monitors which have not been won by spinning recently, keeping at least one attempt */
+        U_32 const shift = objectMonitor->spinBudgetShift;
+        tryEnterSpinCount2 >>= shift;
+        if (0 == tryEnterSpinCount2) {
+            tryEnterSpinCount2 = 1;
+        }
+        tryEnterYieldCount >>= shift;
+        if (0 == tryEnterYieldCount) {
+            tryEnterYieldCount = 1;
+        }
+    }
+
 #if defined(OMR_THR_JLM)
     /* Initialize JLM */
     J9ThreadMonitorTracing* tracing = NULL;
@@ -596,7 +630,82 @@ update_jlm:
     }
 #endif /* defined(OMR_THR_THREE_TIER_LOCKING) && defined(OMR_THR_SPIN_WAKE_CONTROL) */
 
+    if (adaptiveSpin) {
+        updateAdaptiveSpin(objectMonitor, rc);
+    }
+
     return rc;
 }
 
+/**
+ * Record the outcome of spinning on an inflated monitor and re-evaluate its spin budget
+ * at the end of each sample window.
+ *
+ * The counters are updated without atomics. As with the deflation votes, they only drive
+ * a heuristic and an occasional lost update is harmless.
+ *
+ * @param objectMonitor[in] the object monitor which was spun on
+ * @param acquired[in] true if the monitor was acquired by spinning, false if the thread will park
+ */
+static void updateAdaptiveSpin(J9ObjectMonitor* objectMonitor, bool acquired)
+{
+    U_32 windowCount = objectMonitor->spinWindowCount + 1;
+    U_32 windowAcquiredCount = objectMonitor->spinWindowAcquiredCount;
+
+    if (acquired) {
+        objectMonitor->spinAcquiredCount += 1;
+        windowAcquiredCount += 1;
+    } else {
+        objectMonitor->spinParkedCount += 1;
+    }
+
+    if (windowCount >= J9VM_ADAPTIVE_SPIN_WINDOW) {
+        U_32 shift = objectMonitor->spinBudgetShift;
+        if ((windowAcquiredCount * 4) < windowCount) {
+            if (shift < J9VM_ADAPTIVE_SPIN_MAX_SHIFT) {
+                shift += 1;
+            }
+        } else if ((windowAcquiredCount * 4) >= (windowCount * 3)) {
+            if (shift > 0) {
+                shift -= 1;
+            }
+        }
+        if (shift != objectMonitor->spinBudgetShift) {
+            Trc_VM_objectMonitorAdaptiveSpin_BudgetChanged(objectMonitor, windowAcquiredCount, windowCount, shift);
+            objectMonitor->spinBudgetShift = shift;
+        }
+        windowCount = 0;
+        windowAcquiredCount = 0;
+    }
+
+    objectMonitor->spinWindowCount = windowCount;
+    objectMonitor->spinWindowAcquiredCount = windowAcquiredCount;
+}
+
+/**
+ * Fold the time a thread spent parked on an inflated monitor into the monitor's hold time
+ * estimate. Monitors which are held longer than -Xthr:adaptObjectSpinHoldtime microseconds
+ * go straight to the minimum spin budget, since spinning cannot outlast the owner.
+ *
+ * @param vm[in] the J9JavaVM
+ * @param objectMonitor[in] the object monitor which was acquired after parking
+ * @param parkStartTime[in] the hires clock value when the thread started to block
+ */
+static void updateAdaptiveHoldTime(J9JavaVM* vm, J9ObjectMonitor* objectMonitor, U_64 parkStartTime)
+{
+    PORT_ACCESS_FROM_JAVAVM(vm);
+    U_64 parkTime = j9time_hires_delta(parkStartTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+    U_64 estimate = (((U_64)objectMonitor->holdTimeEstimate * 7) + parkTime) / 8;
+
+    if (estimate > U_32_MAX) {
+        estimate = U_32_MAX;
+    }
+    objectMonitor->holdTimeEstimate = (U_32)estimate;
+    if ((estimate > vm->thrAdaptiveObjectSpinHoldTime)
+        && (J9VM_ADAPTIVE_SPIN_MAX_SHIFT != objectMonitor->spinBudgetShift)) {
+        Trc_VM_objectMonitorAdaptiveSpin_LongHold(objectMonitor, estimate);
+        objectMonitor->spinBudgetShift = J9VM_ADAPTIVE_SPIN_MAX_SHIFT;
+    }
+}
+
 } /* extern "C" */
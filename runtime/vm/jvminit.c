@@ -2017,19 +2017,24 @@ IDATA VMInitStages(J9JavaVM* vm, IDATA stage, void* reserved)
         detectAgentXruns(vm);
 #endif
         /* Idle GC tuning is currently enabled for Linux x86-64, i386. For other supported GC policies and platforms,
-         * need further study as heap layout/structure and commit/decommit native support differs. For example, balanced
-         * GC policy: the logic needs to arrive at the right no. & regions from right set needs to picked up for
-         * releasing the pages. Line Item: 50329 continued to be extended for other GC policies and platforms.
+         * need further study as heap layout/structure and commit/decommit native support differs. The balanced GC
+         * policy releases its free regions on an idle GC, which is only implemented on Linux.
+         * Line Item: 50329 continued to be extended for other GC policies and platforms.
          */
         if (J9_ARE_ANY_BITS_SET(vm->vmRuntimeStateListener.idleTuningFlags,
                 J9_IDLE_TUNING_GC_ON_IDLE | J9_IDLE_TUNING_COMPACT_ON_IDLE)) {
             BOOLEAN idleGCTuningSupported = FALSE;
 #if (defined(LINUX) && (defined(J9HAMMER) || defined(J9X86) || defined(S39064) || defined(PPC64))) \
     || defined(J9ZOS39064)
-            /* & only for gencon GC policy */
+            /* & only for gencon GC policy, or balanced on Linux */
             if (J9_GC_POLICY_GENCON == ((OMR_VM*)vm->omrVM)->gcPolicy) {
                 idleGCTuningSupported = TRUE;
             }
+#if defined(LINUX)
+            if (J9_GC_POLICY_BALANCED == ((OMR_VM*)vm->omrVM)->gcPolicy) {
+                idleGCTuningSupported = TRUE;
+            }
+#endif /* defined(LINUX) */
 #endif
             if (!idleGCTuningSupported) {
                 vm->vmRuntimeStateListener.idleTuningFlags
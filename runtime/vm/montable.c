@@ -156,6 +156,14 @@ initializeMonitorTable(J9JavaVM* vm)
     }
     memset(vm->monitorTables, 0, sizeof(J9HashTable*) * tableCount);
 
+    /* Each table has its own lock so that inflations which hash to different tables don't serialize */
+    vm->monitorTableLocks
+        = (J9MonitorTableLock*)j9mem_allocate_memory(sizeof(J9MonitorTableLock) * tableCount, OMRMEM_CATEGORY_VM);
+    if (NULL == vm->monitorTableLocks) {
+        return -1;
+    }
+    memset(vm->monitorTableLocks, 0, sizeof(J9MonitorTableLock) * tableCount);
+
     vm->monitorTableList = NULL;
 
     for (tableIndex = 0; tableIndex < tableCount; tableIndex++) {
@@ -163,6 +171,10 @@ initializeMonitorTable(J9JavaVM* vm)
         if (NULL == table) {
             return -1;
         }
+        if (omrthread_monitor_init_with_name(&vm->monitorTableLocks[tableIndex].mutex, 0, "VM monitor table lock")) {
+            hashTableFree(table);
+            return -1;
+        }
         monitorTableListEntry = pool_newElement(vm->monitorTableListPool);
         if (NULL == monitorTableListEntry) {
             return -1;
@@ -204,6 +216,23 @@ void destroyMonitorTable(J9JavaVM* vm)
         vm->monitorTables = NULL;
     }
 
+    if (NULL != vm->monitorTableLocks) {
+        PORT_ACCESS_FROM_JAVAVM(vm);
+        UDATA tableIndex = 0;
+        for (tableIndex = 0; tableIndex < vm->monitorTableCount; tableIndex++) {
+            J9MonitorTableLock* lock = &vm->monitorTableLocks[tableIndex];
+            if (NULL != lock->mutex) {
+                Trc_VM_destroyMonitorTable_LockStats(
+                    tableIndex, lock->lookupCount, lock->addCount, lock->contendedCount);
+                omrthread_monitor_destroy(lock->mutex);
+                lock->mutex = NULL;
+            }
+        }
+
+        j9mem_free_memory(vm->monitorTableLocks);
+        vm->monitorTableLocks = NULL;
+    }
+
     /* free the monitorTableListPool */
     if (NULL != vm->monitorTableListPool) {
         pool_kill(vm->monitorTableListPool);
@@ -229,7 +258,7 @@ void destroyMonitorTable(J9JavaVM* vm)
 J9ObjectMonitor* monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 {
     J9JavaVM* vm = vmStruct->javaVM;
-    omrthread_monitor_t mutex = vm->monitorTableMutex;
+    J9MonitorTableLock* lock = NULL;
     J9ObjectMonitor* objectMonitor = NULL;
     J9ObjectMonitor key_objectMonitor;
     J9ThreadAbstractMonitor key_monitor;
@@ -285,8 +314,14 @@ J9ObjectMonitor* monitorTableAt(J9VMThread* vmStruct, j9object_t object)
     key_objectMonitor.hash = objectHashCode(vm, object);
     index = key_objectMonitor.hash % (U_32)vm->monitorTableCount;
     monitorTable = vm->monitorTables[index];
+    lock = &vm->monitorTableLocks[index];
 
-    omrthread_monitor_enter(mutex);
+    if (0 != omrthread_monitor_try_enter(lock->mutex)) {
+        omrthread_monitor_enter(lock->mutex);
+        lock->contendedCount += 1;
+        Trc_VM_monitorTableAt_Contended(vmStruct, index);
+    }
+    lock->lookupCount += 1;
 
     if (NULL == monitorTable) {
         TRACE("Out of memory creating tenant monitor table");
@@ -329,6 +364,12 @@ J9ObjectMonitor* monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 #endif /* J9VM_INTERP_CUSTOM_SPIN_OPTIONS */
 
                 key_objectMonitor.monitor = monitor;
+                key_objectMonitor.spinBudgetShift = 0;
+                key_objectMonitor.spinWindowCount = 0;
+                key_objectMonitor.spinWindowAcquiredCount = 0;
+                key_objectMonitor.holdTimeEstimate = 0;
+                key_objectMonitor.spinAcquiredCount = 0;
+                key_objectMonitor.spinParkedCount = 0;
 
 #ifdef J9VM_THR_SMART_DEFLATION
                 key_objectMonitor.proDeflationCount = 0;
@@ -339,6 +380,8 @@ J9ObjectMonitor* monitorTableAt(J9VMThread* vmStruct, j9object_t object)
                 if (objectMonitor == NULL) {
                     omrthread_monitor_destroy(monitor);
                     TRACE("Out of memory adding to hash table");
+                } else {
+                    lock->addCount += 1;
                 }
             } else {
                 TRACE("Out of memory creating omrthread_monitor_t");
@@ -357,7 +400,7 @@ J9ObjectMonitor* monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 #endif
     }
 
-    omrthread_monitor_exit(mutex);
+    omrthread_monitor_exit(lock->mutex);
 
     Trc_VM_monitorTableAt_Exit(vmStruct, objectMonitor);
 
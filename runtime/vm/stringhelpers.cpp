@@ -30,8 +30,369 @@
 
 #include "VMHelpers.hpp"
 
+#include <string.h>
+
+/* SSE2 is part of the x86-64 baseline, so the vector paths need neither compiler flags nor runtime dispatch.
+ * Same-width comparisons go through memcmp, which the C library already dispatches to its widest vector unit.
+ */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define J9VM_STRING_SSE2
+#include <emmintrin.h>
+#endif /* __SSE2__ || _M_X64 || _M_IX86_FP >= 2 */
+
+/* Short runs of single byte characters in mixed UTF8 are decoded inline rather than handed to the vector helpers */
+#define J9VM_UTF8_ASCII_RUN_THRESHOLD 8
+
+/* Contiguous array data may only be read directly when the collector does not require an access barrier */
+#if defined(J9VM_GC_ALWAYS_CALL_OBJECT_ACCESS_BARRIER)
+#define CONTIGUOUS_ARRAY_DATA(vmThread, array, elemType) ((elemType*)NULL)
+#else /* J9VM_GC_ALWAYS_CALL_OBJECT_ACCESS_BARRIER */
+#define CONTIGUOUS_ARRAY_DATA(vmThread, array, elemType) \
+    (J9ISCONTIGUOUSARRAY(vmThread, array) ? J9JAVAARRAYCONTIGUOUS_EA(vmThread, array, 0, elemType) : (elemType*)NULL)
+#endif /* J9VM_GC_ALWAYS_CALL_OBJECT_ACCESS_BARRIER */
+
 extern "C" {
 
+/**
+ * Compare compressed (Latin-1) string data to uncompressed string data for equality.
+ * @param *compressedData
+ * @param *uncompressedData
+ * @param length length for both arrays, in characters
+ * @returns 1 if the data is equal, 0 otherwise
+ */
+UDATA
+compareCompressedUnicodeData(const U_8* compressedData, const U_16* uncompressedData, UDATA length)
+{
+    UDATA i = 0;
+#if defined(J9VM_STRING_SSE2)
+    __m128i const zero = _mm_setzero_si128();
+    while ((length - i) >= 16) {
+        __m128i const bytes = _mm_loadu_si128((const __m128i*)(compressedData + i));
+        __m128i const chars0 = _mm_loadu_si128((const __m128i*)(uncompressedData + i));
+        __m128i const chars1 = _mm_loadu_si128((const __m128i*)(uncompressedData + i + 8));
+        __m128i const equal = _mm_and_si128(_mm_cmpeq_epi16(_mm_unpacklo_epi8(bytes, zero), chars0),
+            _mm_cmpeq_epi16(_mm_unpackhi_epi8(bytes, zero), chars1));
+        if (0xFFFF != _mm_movemask_epi8(equal)) {
+            return 0;
+        }
+        i += 16;
+    }
+#endif /* J9VM_STRING_SSE2 */
+    for (; i < length; i++) {
+        if ((U_16)compressedData[i] != uncompressedData[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Count the leading characters of compressed string data which match single byte (ASCII) UTF8 data.
+ * @param *compressedData
+ * @param translateDots if non-zero, '.' in the string data matches '/' in the UTF8 data
+ * @param *utfData
+ * @param length maximum number of characters to match
+ * @returns the number of matching characters
+ */
+UDATA
+matchCompressedUnicodeToASCII(const U_8* compressedData, UDATA translateDots, const U_8* utfData, UDATA length)
+{
+    UDATA i = 0;
+#if defined(J9VM_STRING_SSE2)
+    __m128i const dot = _mm_set1_epi8('.');
+    __m128i const slash = _mm_set1_epi8('/');
+    while ((length - i) >= 16) {
+        __m128i const utf = _mm_loadu_si128((const __m128i*)(utfData + i));
+        __m128i chars = _mm_loadu_si128((const __m128i*)(compressedData + i));
+        if (0 != _mm_movemask_epi8(utf)) {
+            /* multi-byte UTF8 sequence in this block */
+            break;
+        }
+        if (translateDots) {
+            __m128i const dots = _mm_cmpeq_epi8(chars, dot);
+            chars = _mm_or_si128(_mm_andnot_si128(dots, chars), _mm_and_si128(dots, slash));
+        }
+        if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(chars, utf))) {
+            break;
+        }
+        i += 16;
+    }
+#endif /* J9VM_STRING_SSE2 */
+    for (; i < length; i++) {
+        U_8 utfChar = utfData[i];
+        U_8 unicodeChar = compressedData[i];
+        if (J9_ARE_ANY_BITS_SET(utfChar, 0x80)) {
+            break;
+        }
+        if (translateDots && ('.' == unicodeChar)) {
+            unicodeChar = '/';
+        }
+        if (unicodeChar != utfChar) {
+            break;
+        }
+    }
+    return i;
+}
+
+/**
+ * Count the leading characters of uncompressed string data which match single byte (ASCII) UTF8 data.
+ * @param *uncompressedData
+ * @param translateDots if non-zero, '.' in the string data matches '/' in the UTF8 data
+ * @param *utfData
+ * @param length maximum number of characters to match
+ * @returns the number of matching characters
+ */
+UDATA
+matchUncompressedUnicodeToASCII(const U_16* uncompressedData, UDATA translateDots, const U_8* utfData, UDATA length)
+{
+    UDATA i = 0;
+#if defined(J9VM_STRING_SSE2)
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const dot = _mm_set1_epi16('.');
+    __m128i const slash = _mm_set1_epi16('/');
+    while ((length - i) >= 16) {
+        __m128i const utf = _mm_loadu_si128((const __m128i*)(utfData + i));
+        __m128i chars0 = _mm_loadu_si128((const __m128i*)(uncompressedData + i));
+        __m128i chars1 = _mm_loadu_si128((const __m128i*)(uncompressedData + i + 8));
+        if (0 != _mm_movemask_epi8(utf)) {
+            /* multi-byte UTF8 sequence in this block */
+            break;
+        }
+        if (translateDots) {
+            __m128i const dots0 = _mm_cmpeq_epi16(chars0, dot);
+            __m128i const dots1 = _mm_cmpeq_epi16(chars1, dot);
+            chars0 = _mm_or_si128(_mm_andnot_si128(dots0, chars0), _mm_and_si128(dots0, slash));
+            chars1 = _mm_or_si128(_mm_andnot_si128(dots1, chars1), _mm_and_si128(dots1, slash));
+        }
+        __m128i const equal = _mm_and_si128(_mm_cmpeq_epi16(chars0, _mm_unpacklo_epi8(utf, zero)),
+            _mm_cmpeq_epi16(chars1, _mm_unpackhi_epi8(utf, zero)));
+        if (0xFFFF != _mm_movemask_epi8(equal)) {
+            break;
+        }
+        i += 16;
+    }
+#endif /* J9VM_STRING_SSE2 */
+    for (; i < length; i++) {
+        U_8 utfChar = utfData[i];
+        U_16 unicodeChar = uncompressedData[i];
+        if (J9_ARE_ANY_BITS_SET(utfChar, 0x80)) {
+            break;
+        }
+        if (translateDots && ('.' == unicodeChar)) {
+            unicodeChar = '/';
+        }
+        if (unicodeChar != (U_16)utfChar) {
+            break;
+        }
+    }
+    return i;
+}
+
+/**
+ * Count the leading bytes of UTF8 data which are single byte characters other than NUL,
+ * which modified UTF8 encodes as two bytes.
+ * @param *utf8Data
+ * @param length number of bytes to examine
+ * @returns the number of leading single byte characters
+ */
+UDATA
+countUTF8ASCIIPrefix(const U_8* utf8Data, UDATA length)
+{
+    UDATA i = 0;
+#if defined(J9VM_STRING_SSE2)
+    __m128i const zero = _mm_setzero_si128();
+    while ((length - i) >= 16) {
+        __m128i const bytes = _mm_loadu_si128((const __m128i*)(utf8Data + i));
+        if (0 != _mm_movemask_epi8(_mm_or_si128(bytes, _mm_cmpeq_epi8(bytes, zero)))) {
+            break;
+        }
+        i += 16;
+    }
+#endif /* J9VM_STRING_SSE2 */
+    for (; i < length; i++) {
+        U_8 c = utf8Data[i];
+        if ((0 == c) || J9_ARE_ANY_BITS_SET(c, 0x80)) {
+            break;
+        }
+    }
+    return i;
+}
+
+/**
+ * Widen the leading single byte characters of UTF8 data into uncompressed string data.
+ * @param *utf8Data
+ * @param *unicodeData buffer receiving at least length characters
+ * @param length number of bytes to examine
+ * @param translateSlashes if non-zero, '/' is stored as '.'
+ * @returns the number of characters widened
+ */
+UDATA
+widenUTF8ASCIIToUnicode(const U_8* utf8Data, U_16* unicodeData, UDATA length, UDATA translateSlashes)
+{
+    UDATA i = 0;
+#if defined(J9VM_STRING_SSE2)
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const slash = _mm_set1_epi8('/');
+    __m128i const dot = _mm_set1_epi8('.');
+    while ((length - i) >= 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(utf8Data + i));
+        if (0 != _mm_movemask_epi8(bytes)) {
+            break;
+        }
+        if (translateSlashes) {
+            __m128i const slashes = _mm_cmpeq_epi8(bytes, slash);
+            bytes = _mm_or_si128(_mm_andnot_si128(slashes, bytes), _mm_and_si128(slashes, dot));
+        }
+        _mm_storeu_si128((__m128i*)(unicodeData + i), _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128((__m128i*)(unicodeData + i + 8), _mm_unpackhi_epi8(bytes, zero));
+        i += 16;
+    }
+#endif /* J9VM_STRING_SSE2 */
+    for (; i < length; i++) {
+        U_8 c = utf8Data[i];
+        if (J9_ARE_ANY_BITS_SET(c, 0x80)) {
+            break;
+        }
+        if (translateSlashes && ('/' == c)) {
+            c = '.';
+        }
+        unicodeData[i] = (U_16)c;
+    }
+    return i;
+}
+
+/**
+ * Copy the leading single byte characters of UTF8 data into compressed string data.
+ * @param *utf8Data
+ * @param *compressedData buffer receiving at least length characters
+ * @param length number of bytes to examine
+ * @param translateSlashes if non-zero, '/' is stored as '.'
+ * @returns the number of characters copied
+ */
+UDATA
+copyUTF8ASCIIToCompressedUnicode(const U_8* utf8Data, U_8* compressedData, UDATA length, UDATA translateSlashes)
+{
+    UDATA i = 0;
+#if defined(J9VM_STRING_SSE2)
+    __m128i const slash = _mm_set1_epi8('/');
+    __m128i const dot = _mm_set1_epi8('.');
+    while ((length - i) >= 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(utf8Data + i));
+        if (0 != _mm_movemask_epi8(bytes)) {
+            break;
+        }
+        if (translateSlashes) {
+            __m128i const slashes = _mm_cmpeq_epi8(bytes, slash);
+            bytes = _mm_or_si128(_mm_andnot_si128(slashes, bytes), _mm_and_si128(slashes, dot));
+        }
+        _mm_storeu_si128((__m128i*)(compressedData + i), bytes);
+        i += 16;
+    }
+#endif /* J9VM_STRING_SSE2 */
+    for (; i < length; i++) {
+        U_8 c = utf8Data[i];
+        if (J9_ARE_ANY_BITS_SET(c, 0x80)) {
+            break;
+        }
+        if (translateSlashes && ('/' == c)) {
+            c = '.';
+        }
+        compressedData[i] = c;
+    }
+    return i;
+}
+
+/**
+ * Narrow the leading characters of uncompressed string data which encode as a single UTF8 byte.
+ * @param *unicodeData
+ * @param *utf8Data buffer receiving at least length bytes
+ * @param length number of characters to examine
+ * @param translateDots if non-zero, '.' is stored as '/'
+ * @returns the number of characters narrowed
+ */
+UDATA
+narrowUnicodeToUTF8ASCII(const U_16* unicodeData, U_8* utf8Data, UDATA length, UDATA translateDots)
+{
+    UDATA i = 0;
+#if defined(J9VM_STRING_SSE2)
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const asciiLimit = _mm_set1_epi16(0x7F);
+    __m128i const dot = _mm_set1_epi8('.');
+    __m128i const slash = _mm_set1_epi8('/');
+    while ((length - i) >= 16) {
+        __m128i const chars0 = _mm_loadu_si128((const __m128i*)(unicodeData + i));
+        __m128i const chars1 = _mm_loadu_si128((const __m128i*)(unicodeData + i + 8));
+        /* The compares are signed: 0x0080..0x7FFF are greater than 0x7F and 0x8000..0xFFFF are negative */
+        __m128i const over = _mm_or_si128(_mm_cmpgt_epi16(chars0, asciiLimit), _mm_cmpgt_epi16(chars1, asciiLimit));
+        __m128i const negative = _mm_or_si128(_mm_cmplt_epi16(chars0, zero), _mm_cmplt_epi16(chars1, zero));
+        __m128i const nul = _mm_or_si128(_mm_cmpeq_epi16(chars0, zero), _mm_cmpeq_epi16(chars1, zero));
+        if (0 != _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(over, negative), nul))) {
+            break;
+        }
+        __m128i bytes = _mm_packus_epi16(chars0, chars1);
+        if (translateDots) {
+            __m128i const dots = _mm_cmpeq_epi8(bytes, dot);
+            bytes = _mm_or_si128(_mm_andnot_si128(dots, bytes), _mm_and_si128(dots, slash));
+        }
+        _mm_storeu_si128((__m128i*)(utf8Data + i), bytes);
+        i += 16;
+    }
+#endif /* J9VM_STRING_SSE2 */
+    for (; i < length; i++) {
+        U_16 c = unicodeData[i];
+        if ((0 == c) || (c > 0x7F)) {
+            break;
+        }
+        if (translateDots && ('.' == c)) {
+            c = '/';
+        }
+        utf8Data[i] = (U_8)c;
+    }
+    return i;
+}
+
+/**
+ * Copy the leading characters of compressed string data which encode as a single UTF8 byte.
+ * @param *compressedData
+ * @param *utf8Data buffer receiving at least length bytes
+ * @param length number of characters to examine
+ * @param translateDots if non-zero, '.' is stored as '/'
+ * @returns the number of characters copied
+ */
+UDATA
+copyCompressedUnicodeToUTF8ASCII(const U_8* compressedData, U_8* utf8Data, UDATA length, UDATA translateDots)
+{
+    UDATA i = 0;
+#if defined(J9VM_STRING_SSE2)
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const dot = _mm_set1_epi8('.');
+    __m128i const slash = _mm_set1_epi8('/');
+    while ((length - i) >= 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(compressedData + i));
+        if (0 != _mm_movemask_epi8(_mm_or_si128(bytes, _mm_cmpeq_epi8(bytes, zero)))) {
+            break;
+        }
+        if (translateDots) {
+            __m128i const dots = _mm_cmpeq_epi8(bytes, dot);
+            bytes = _mm_or_si128(_mm_andnot_si128(dots, bytes), _mm_and_si128(dots, slash));
+        }
+        _mm_storeu_si128((__m128i*)(utf8Data + i), bytes);
+        i += 16;
+    }
+#endif /* J9VM_STRING_SSE2 */
+    for (; i < length; i++) {
+        U_8 c = compressedData[i];
+        if ((0 == c) || J9_ARE_ANY_BITS_SET(c, 0x80)) {
+            break;
+        }
+        if (translateDots && ('.' == c)) {
+            c = '/';
+        }
+        utf8Data[i] = c;
+    }
+    return i;
+}
+
 /**
  * Compress the UTF8 string into compressed format into byteArray at offset
  * @param *vmThread
@@ -46,18 +407,48 @@ void copyUTF8ToCompressedUnicode(
 {
     UDATA writeIndex = startIndex;
     UDATA originalLength = length;
-    while (length > 0) {
-        U_16 unicode = 0;
-        UDATA consumed = VM_VMHelpers::decodeUTF8Char(data, &unicode);
-        if (J9_ARE_ANY_BITS_SET(stringFlags, J9_STR_XLAT)) {
-            if ((U_16)'/' == unicode) {
-                unicode = (U_16)'.';
+    U_8* compressedData = CONTIGUOUS_ARRAY_DATA(vmThread, charArray, U_8);
+    if (NULL != compressedData) {
+        UDATA const translateSlashes = stringFlags & J9_STR_XLAT;
+        compressedData += writeIndex;
+        while (length > 0) {
+            /* copy the run of single byte characters, then decode one character at a time until another run starts */
+            UDATA copied = copyUTF8ASCIIToCompressedUnicode(data, compressedData, length, translateSlashes);
+            UDATA asciiRunLength = 0;
+            compressedData += copied;
+            data += copied;
+            length -= copied;
+            while ((length > 0) && (asciiRunLength < J9VM_UTF8_ASCII_RUN_THRESHOLD)) {
+                U_16 unicode = 0;
+                UDATA consumed = VM_VMHelpers::decodeUTF8Char(data, &unicode);
+                if (1 == consumed) {
+                    asciiRunLength += 1;
+                    if (translateSlashes && ((U_16)'/' == unicode)) {
+                        unicode = (U_16)'.';
+                    }
+                } else {
+                    asciiRunLength = 0;
+                }
+                *compressedData = (U_8)unicode;
+                compressedData += 1;
+                data += consumed;
+                length -= consumed;
             }
         }
-        J9JAVAARRAYOFBYTE_STORE(vmThread, charArray, writeIndex, (U_8)unicode);
-        writeIndex += 1;
-        data += consumed;
-        length -= consumed;
+    } else {
+        while (length > 0) {
+            U_16 unicode = 0;
+            UDATA consumed = VM_VMHelpers::decodeUTF8Char(data, &unicode);
+            if (J9_ARE_ANY_BITS_SET(stringFlags, J9_STR_XLAT)) {
+                if ((U_16)'/' == unicode) {
+                    unicode = (U_16)'.';
+                }
+            }
+            J9JAVAARRAYOFBYTE_STORE(vmThread, charArray, writeIndex, (U_8)unicode);
+            writeIndex += 1;
+            data += consumed;
+            length -= consumed;
+        }
     }
 
     /* anonClasses have the following name format [className]/[ROMADDRESS], we have to
@@ -86,6 +477,11 @@ compareUncompressedUnicode(J9VMThread* vmThread, j9object_t unicodeBytes1, j9obj
 {
     UDATA result = 1;
     if (unicodeBytes1 != unicodeBytes2) {
+        const U_16* data1 = CONTIGUOUS_ARRAY_DATA(vmThread, unicodeBytes1, U_16);
+        const U_16* data2 = CONTIGUOUS_ARRAY_DATA(vmThread, unicodeBytes2, U_16);
+        if ((NULL != data1) && (NULL != data2)) {
+            return (0 == memcmp(data1, data2, length * sizeof(U_16))) ? 1 : 0;
+        }
         UDATA i = 0;
         while (0 != length) {
             U_16 unicodeChar1 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes1, i);
@@ -114,6 +510,11 @@ compareCompressedUnicode(J9VMThread* vmThread, j9object_t unicodeBytes1, j9objec
 {
     UDATA result = 1;
     if (unicodeBytes1 != unicodeBytes2) {
+        const U_8* data1 = CONTIGUOUS_ARRAY_DATA(vmThread, unicodeBytes1, U_8);
+        const U_8* data2 = CONTIGUOUS_ARRAY_DATA(vmThread, unicodeBytes2, U_8);
+        if ((NULL != data1) && (NULL != data2)) {
+            return (0 == memcmp(data1, data2, length)) ? 1 : 0;
+        }
         UDATA i = 0;
         while (0 != length) {
             U_16 unicodeChar1 = (U_16)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes1, i);
@@ -143,9 +544,14 @@ compareCompressedUnicodeToUncompressedUnicode(
 {
     UDATA result = 1;
     UDATA i = 0;
+    const U_8* compressedData = CONTIGUOUS_ARRAY_DATA(vmThread, unicodeBytes1, U_8);
+    const U_16* uncompressedData = CONTIGUOUS_ARRAY_DATA(vmThread, unicodeBytes2, U_16);
+    if ((NULL != compressedData) && (NULL != uncompressedData)) {
+        return compareCompressedUnicodeData(compressedData, uncompressedData, length);
+    }
     while (0 != length) {
-        U_16 unicodeChar1 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes1, i);
-        U_16 unicodeChar2 = (U_16)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes2, i);
+        U_16 unicodeChar1 = (U_16)(U_8)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes1, i);
+        U_16 unicodeChar2 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes2, i);
         if (unicodeChar1 != unicodeChar2) {
             result = 0;
             break;
@@ -218,8 +624,32 @@ compareStringToUTF8(J9VMThread* vmThread, j9object_t string, UDATA translateDots
     UDATA stringLength = J9VMJAVALANGSTRING_LENGTH(vmThread, string);
     UDATA tmpStringLength = stringLength;
     j9object_t unicodeBytes = J9VMJAVALANGSTRING_VALUE(vmThread, string);
+    bool isCompressed = IS_STRING_COMPRESSED(vmThread, string);
 
-    if (IS_STRING_COMPRESSED(vmThread, string)) {
+    /* Match the leading ASCII run directly against contiguous string data, then decode the rest one character at a
+     * time. ASCII characters are a single UTF8 byte, so the string and UTF8 indices advance together over the run.
+     */
+    if ((0 != tmpUtfLength) && (0 != tmpStringLength)) {
+        UDATA prefixLength = (tmpUtfLength < tmpStringLength) ? tmpUtfLength : tmpStringLength;
+        UDATA matched = 0;
+        if (isCompressed) {
+            const U_8* stringData = CONTIGUOUS_ARRAY_DATA(vmThread, unicodeBytes, U_8);
+            if (NULL != stringData) {
+                matched = matchCompressedUnicodeToASCII(stringData, translateDots, tmpUtfData, prefixLength);
+            }
+        } else {
+            const U_16* stringData = CONTIGUOUS_ARRAY_DATA(vmThread, unicodeBytes, U_16);
+            if (NULL != stringData) {
+                matched = matchUncompressedUnicodeToASCII(stringData, translateDots, tmpUtfData, prefixLength);
+            }
+        }
+        i = matched;
+        tmpStringLength -= matched;
+        tmpUtfData += matched;
+        tmpUtfLength -= matched;
+    }
+
+    if (isCompressed) {
         while ((tmpUtfLength != 0) && (tmpStringLength != 0)) {
             U_16 unicodeChar = (U_16)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes, i);
             U_16 utfChar;
@@ -269,8 +699,45 @@ copyStringToUTF8Helper(J9VMThread* vmThread, j9object_t string, UDATA stringFlag
 
     j9object_t stringValue = J9VMJAVALANGSTRING_VALUE(vmThread, string);
     U_8* data = utf8Data;
+    bool const isCompressed = IS_STRING_COMPRESSED(vmThread, string);
+    const U_8* compressedData = NULL;
+    const U_16* unicodeData = NULL;
 
-    if (IS_STRING_COMPRESSED(vmThread, string)) {
+    if (isCompressed) {
+        compressedData = CONTIGUOUS_ARRAY_DATA(vmThread, stringValue, U_8);
+    } else {
+        unicodeData = CONTIGUOUS_ARRAY_DATA(vmThread, stringValue, U_16);
+    }
+
+    if ((NULL != compressedData) || (NULL != unicodeData)) {
+        /* Copy runs of characters which encode as a single byte, then encode the characters which follow the run.
+         * Those characters are NUL or above 0x7F, so they never need the '.' translation.
+         */
+        UDATA const translateDots = stringFlags & J9_STR_XLAT;
+        UDATA const end = stringOffset + stringLength;
+        UDATA i = stringOffset;
+        if (NULL != compressedData) {
+            while (i < end) {
+                UDATA copied = copyCompressedUnicodeToUTF8ASCII(compressedData + i, data, end - i, translateDots);
+                i += copied;
+                data += copied;
+                while ((i < end) && ((0 == compressedData[i]) || J9_ARE_ANY_BITS_SET(compressedData[i], 0x80))) {
+                    data += VM_VMHelpers::encodeUTF8CharI8((I_8)compressedData[i], data);
+                    i += 1;
+                }
+            }
+        } else {
+            while (i < end) {
+                UDATA copied = narrowUnicodeToUTF8ASCII(unicodeData + i, data, end - i, translateDots);
+                i += copied;
+                data += copied;
+                while ((i < end) && ((0 == unicodeData[i]) || (unicodeData[i] > 0x7F))) {
+                    data += VM_VMHelpers::encodeUTF8Char(unicodeData[i], data);
+                    i += 1;
+                }
+            }
+        }
+    } else if (isCompressed) {
         /* Manually version J9_STR_XLAT flag checking from the loop for performance as the compiler does not do it */
         if ((stringFlags & J9_STR_XLAT) == 0) {
             for (UDATA i = stringOffset; i < stringOffset + stringLength; i++) {
@@ -470,13 +937,19 @@ UDATA
 isValidUtf8(const U_8* utf8Data, size_t length)
 {
     while (length > 0) {
-        U_16 dummy;
-        U_32 consumed = decodeUTF8CharN(utf8Data, &dummy, length);
-        if (0 == consumed) { /* 0 indicates parsing error */
-            return 0;
+        /* single byte characters are always valid, so skip over runs of them */
+        UDATA asciiLength = countUTF8ASCIIPrefix(utf8Data, length);
+        utf8Data += asciiLength;
+        length -= asciiLength;
+        while ((length > 0) && ((0 == *utf8Data) || J9_ARE_ANY_BITS_SET(*utf8Data, 0x80))) {
+            U_16 dummy;
+            U_32 consumed = decodeUTF8CharN(utf8Data, &dummy, length);
+            if (0 == consumed) { /* 0 indicates parsing error */
+                return 0;
+            }
+            utf8Data += consumed;
+            length -= consumed;
         }
-        utf8Data += consumed;
-        length -= consumed;
     }
     return 1;
 }
@@ -492,12 +965,19 @@ void fixBadUtf8(const U_8* original, U_8* corrected, size_t length)
     strcpy((char*)corrected, (const char*)original);
     while (length > 0) {
         U_16 dummy;
-        U_32 consumed = decodeUTF8CharN(corrected, &dummy, length);
+        U_32 consumed = 0;
+        UDATA asciiLength = countUTF8ASCIIPrefix(corrected, length);
+        corrected += asciiLength;
+        length -= asciiLength;
+        if (0 == length) {
+            break;
+        }
+        consumed = decodeUTF8CharN(corrected, &dummy, length);
         if (0 == consumed) { /* 0 indicates parsing error */
             *corrected = '?';
             /*
-             * next time through the loop, decodeUTF8CharN() will recognize
-             * this as a good character and we will advance the pointer
+             * next time through the loop, the '?' is skipped as a single
+             * byte character and we will advance the pointer
              */
         }
         corrected += consumed;
@@ -511,18 +991,48 @@ void copyUTF8ToUnicode(
 {
     UDATA writeIndex = startIndex;
     UDATA originalLength = length;
-    while (length > 0) {
-        U_16 unicode = 0;
-        UDATA consumed = VM_VMHelpers::decodeUTF8Char(data, &unicode);
-        if (J9_ARE_ANY_BITS_SET(stringFlags, J9_STR_XLAT)) {
-            if ((U_16)'/' == unicode) {
-                unicode = (U_16)'.';
+    U_16* unicodeData = CONTIGUOUS_ARRAY_DATA(vmThread, charArray, U_16);
+    if (NULL != unicodeData) {
+        UDATA const translateSlashes = stringFlags & J9_STR_XLAT;
+        unicodeData += writeIndex;
+        while (length > 0) {
+            /* widen the run of single byte characters, then decode one character at a time until another run starts */
+            UDATA widened = widenUTF8ASCIIToUnicode(data, unicodeData, length, translateSlashes);
+            UDATA asciiRunLength = 0;
+            unicodeData += widened;
+            data += widened;
+            length -= widened;
+            while ((length > 0) && (asciiRunLength < J9VM_UTF8_ASCII_RUN_THRESHOLD)) {
+                U_16 unicode = 0;
+                UDATA consumed = VM_VMHelpers::decodeUTF8Char(data, &unicode);
+                if (1 == consumed) {
+                    asciiRunLength += 1;
+                    if (translateSlashes && ((U_16)'/' == unicode)) {
+                        unicode = (U_16)'.';
+                    }
+                } else {
+                    asciiRunLength = 0;
+                }
+                *unicodeData = unicode;
+                unicodeData += 1;
+                data += consumed;
+                length -= consumed;
             }
         }
-        J9JAVAARRAYOFCHAR_STORE(vmThread, charArray, writeIndex, unicode);
-        writeIndex += 1;
-        data += consumed;
-        length -= consumed;
+    } else {
+        while (length > 0) {
+            U_16 unicode = 0;
+            UDATA consumed = VM_VMHelpers::decodeUTF8Char(data, &unicode);
+            if (J9_ARE_ANY_BITS_SET(stringFlags, J9_STR_XLAT)) {
+                if ((U_16)'/' == unicode) {
+                    unicode = (U_16)'.';
+                }
+            }
+            J9JAVAARRAYOFCHAR_STORE(vmThread, charArray, writeIndex, unicode);
+            writeIndex += 1;
+            data += consumed;
+            length -= consumed;
+        }
     }
 
     /* anonClasses have the following name format [className]/[ROMADDRESS], we have to
@@ -157,7 +157,8 @@ I_32 vmizip_openZipFile(VMInterface* vmi, char* filename, VMIZipFile* vmizipFile
             readCacheData = !result;
         }
         sharedConfig = vm->sharedClassConfig;
-        /* bootstrap jars are controlled by the J9VM_ZERO_SHAREBOOTZIPCACHE flag */
+        /* bootstrap jars are controlled by the J9VM_ZERO_SHAREBOOTZIPCACHE flag. Class path jars are read by the
+         * class library's zip support, which does not use this zip cache, so only bootstrap jars are shared. */
         if ((0 == result) && (NULL != sharedConfig)
             && ((flags & ZIP_FLAG_BOOTSTRAP) && (vm->zeroOptions & J9VM_ZERO_SHAREBOOTZIPCACHE))
             && !zipCache_isCopied(zipFile->cache)) {
@@ -204,7 +205,12 @@ I_32 vmizip_openZipFile(VMInterface* vmi, char* filename, VMIZipFile* vmizipFile
                         if (numElem == 1) {
                             /* Found the zip cache data, use it */
                             cacheData = (J9ZipCache*)descriptor.address;
-                            if (NULL != cacheData) {
+                            if ((NULL != cacheData)
+                                && !zipCache_isValidCopy(zipFile->cache, cacheData, descriptor.length)) {
+                                /* Read the central directory from the zip file instead */
+                                Trc_VM_sharedZipCacheValidationFailed(env, uniqueId, zipFile->filename);
+                                cacheData = NULL;
+                            } else if (NULL != cacheData) {
                                 Trc_VM_useSharedZipCache(env, uniqueId, zipFile->filename);
                                 zipCache_useCopiedCache(zipFile->cache, cacheData);
                                 readCacheData = FALSE;
@@ -496,6 +496,8 @@ jint threadParseArguments(J9JavaVM* vm, char* optArg)
     vm->thrNestedSpinning = 1;
     vm->thrTryEnterNestedSpinning = 1;
     vm->thrDeflationPolicy = J9VM_DEFLATION_POLICY_ASAP;
+    vm->thrAdaptiveObjectSpin = 0;
+    vm->thrAdaptiveObjectSpinHoldTime = 1000;
 
     if (cpus > 1) {
 #if defined(AIXPPC) || defined(LINUXPPC)
@@ -882,6 +884,23 @@ jint threadParseArguments(J9JavaVM* vm, char* optArg)
             continue;
         }
 
+        if (try_scan(&scan_start, "adaptObjectSpinHoldtime=")) {
+            if (scan_udata(&scan_start, &vm->thrAdaptiveObjectSpinHoldTime)) {
+                goto _error;
+            }
+            continue;
+        }
+
+        if (try_scan(&scan_start, "adaptObjectSpin")) {
+            vm->thrAdaptiveObjectSpin = 1;
+            continue;
+        }
+
+        if (try_scan(&scan_start, "noAdaptObjectSpin")) {
+            vm->thrAdaptiveObjectSpin = 0;
+            continue;
+        }
+
 #if defined(J9VM_INTERP_CUSTOM_SPIN_OPTIONS)
         if (try_scan(&scan_start, "customSpinOptions=")) {
             vm->customSpinOptions = pool_new(sizeof(J9VMCustomSpinOptions), 0, 0, 0, J9_GET_CALLSITE(),
@@ -1303,6 +1322,8 @@ static void dumpThreadingInfo(J9JavaVM* jvm)
         (jvm->thrDeflationPolicy == J9VM_DEFLATION_POLICY_ASAP)
             ? "asap"
             : (jvm->thrDeflationPolicy == J9VM_DEFLATION_POLICY_NEVER) ? "never" : "smart");
+    j9tty_printf(PORTLIB, ",\n" LEADING_SPACE "%sdaptObjectSpin", (jvm->thrAdaptiveObjectSpin) ? "a" : "noA");
+    j9tty_printf(PORTLIB, ",\n" LEADING_SPACE "adaptObjectSpinHoldtime=%zu", jvm->thrAdaptiveObjectSpinHoldTime);
 #if defined(OMR_THR_THREE_TIER_LOCKING)
     j9tty_printf(PORTLIB, ",\n");
     j9tty_printf(
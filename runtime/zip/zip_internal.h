@@ -113,14 +113,50 @@ void zipCachePool_doKillHandler(J9ZipCachePoolEntry* entry, J9ZipCachePool* zcp)
  * @typedef
  * @struct
  */
+/**
+ * @typedef
+ * @struct
+ * One slot of the hashed directory index.  entry is either a J9ZipFileEntry
+ * or a J9ZipDirEntry (isDir) whose parent directory is parent.
+ */
+typedef struct J9ZipCacheIndexSlot {
+    J9ZipDirEntry* parent;
+    void* entry;
+    U_32 hash;
+    U_32 isDir;
+} J9ZipCacheIndexSlot;
+
+/**
+ * @typedef
+ * @struct
+ * Open addressing index over every (parent directory, name, isClass) element of the
+ * cache.  The index is process local and is never copied with the cache.  Lookups do
+ * not take a lock, so an index is never freed while the cache is alive: slot arrays
+ * which have been outgrown are kept on the retired list, and a dropped index (with its
+ * retired list) moves to the droppedIndex list of the cache.  Both are freed by
+ * zipCache_kill(), when no lookup can be running.
+ */
+typedef struct J9ZipCacheIndex {
+    J9ZipCacheIndexSlot* slots;
+    UDATA size;
+    UDATA count;
+    struct J9ZipCacheIndex* retired;
+} J9ZipCacheIndex;
+
 /* trick: a J9ZipCache * is really a pointer to a J9ZipCacheInternal. */
 typedef struct J9ZipCacheInternal {
     J9ZipCache info;
     J9ZipCacheEntry* entry;
     IDATA zipFileFd;
     U_8 zipFileType;
+    J9ZipCacheIndex* volatile index;
+    J9ZipCacheIndex* droppedIndex;
+    J9MmapHandle* zipFileMapping;
 } J9ZipCacheInternal;
 
+/* Reads from a mapped zip file fault with SIGBUS if the file is truncated underneath the mapping. */
+#define ZIP_MAPPED_READ_SIG_FLAGS (J9PORT_SIG_FLAG_MAY_RETURN | J9PORT_SIG_FLAG_SIGBUS)
+
 /**
  * @typedef
  * @struct
@@ -162,6 +198,30 @@ zipCache_getStartCentralDir(J9ZipCache* zipCache);
  */
 void zipCache_invalidateCache(J9ZipCache* zipCache);
 
+/**
+ * @brief
+ * @param zipCache
+ * @param populateTime
+ * @return void
+ */
+void zipCache_setPopulateTime(J9ZipCache* zipCache, U_64 populateTime);
+
+/**
+ * @brief
+ * @param zipCache
+ * @return void
+ */
+void zipCache_mapZipFile(J9ZipCache* zipCache);
+
+/**
+ * @brief
+ * @param zipCache
+ * @param offset
+ * @param length
+ * @return U_8*
+ */
+U_8* zipCache_getMappedData(J9ZipCache* zipCache, UDATA offset, UDATA length);
+
 #endif /* J9VM_OPT_ZIP_SUPPORT */ /* End File Level Build Flags */
 
 /* ---------------- zipsup.c ---------------- */
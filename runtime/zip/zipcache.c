@@ -45,7 +45,7 @@
  * The zip cache version number must be changed if the zip
  * cache format changes.
  */
-#define ZIP_CACHE_VERSION 1
+#define ZIP_CACHE_VERSION 2
 
 #define UDATA_TOP_BIT (((UDATA)1) << (sizeof(UDATA) * 8 - 1))
 #define ISCLASS_BIT UDATA_TOP_BIT
@@ -70,6 +70,14 @@ J9ZipDirEntry* zipCache_copyDirEntry(
     J9ZipCacheEntry* orgzce, J9ZipDirEntry* orgDirEntry, J9ZipCacheEntry* zce, J9ZipDirEntry* rootEntry);
 void zipCache_freeChunks(J9PortLibrary* portLib, J9ZipCacheEntry* zce);
 void zipCache_walkCache(J9PortLibrary* portLib, J9ZipCacheEntry* zce, J9ZipDirEntry* dirEntry);
+static U_32 zipCache_hashName(J9ZipDirEntry* parent, const char* namePtr, UDATA nameSize, BOOLEAN isClass);
+static void* zipCache_indexLookup(
+    J9ZipCacheIndex* index, J9ZipDirEntry* parent, const char* namePtr, UDATA nameSize, BOOLEAN isClass, U_32 isDir);
+static BOOLEAN zipCache_indexInsert(J9ZipCacheInternal* zci, J9ZipDirEntry* parent, void* entry, U_32 hash, U_32 isDir);
+static J9ZipCacheIndex* zipCache_allocateIndex(J9PortLibrary* portLib, UDATA size);
+static BOOLEAN zipCache_indexDirEntry(J9ZipCacheInternal* zci, J9ZipDirEntry* dirEntry);
+static void zipCache_freeIndex(J9PortLibrary* portLib, J9ZipCacheIndex* index);
+static void zipCache_dropIndex(J9ZipCacheInternal* zci);
 
 #define ZIP_SRP_SET(field, value) WSRP_PTR_SET(&field, value)
 #define ZIP_SRP_GET(field, type) WSRP_PTR_GET(&field, type)
@@ -82,6 +90,18 @@ void zipCache_walkCache(J9PortLibrary* portLib, J9ZipCacheEntry* zce, J9ZipDirEn
 
 #define ALIGN_ENTRY(stringBytes) ((stringBytes + sizeof(UDATA) - 1) & ~(sizeof(UDATA) - 1))
 
+/* Initial number of slots in the directory index; must be a power of two. */
+#define ZIP_INDEX_INITIAL_SIZE 256
+/* The index grows when it becomes more than 3/4 full. */
+#define ZIP_INDEX_NEEDS_GROWTH(index) (((index)->count + 1) * 4 > (index)->size * 3)
+
+#if defined(J9VM_ENV_DATA64)
+#define ZIP_MMAP_MAX_SIZE ((UDATA)0xFFFFFFFF)
+#else /* J9VM_ENV_DATA64 */
+/* Don't let a large jar consume the address space of a 32-bit process. */
+#define ZIP_MMAP_MAX_SIZE ((UDATA)64 * 1024 * 1024)
+#endif /* J9VM_ENV_DATA64 */
+
 #if 0
 #define ZIP_SRP_SET(field, value) field = value
 #define ZIP_SRP_GET(field, type) field
@@ -128,6 +148,9 @@ J9ZipCache* zipCache_new(
     zci->entry = zce;
     zci->zipFileFd = -1;
     zci->zipFileType = ZIP_Unknown;
+    zci->index = NULL;
+    zci->droppedIndex = NULL;
+    zci->zipFileMapping = NULL;
 
     zci->info.portLib = portLib;
     ZIP_SRP_SET(zce->currentChunk, chunk);
@@ -151,6 +174,9 @@ J9ZipCache* zipCache_new(
     zce->zipTimeStamp = zipTimeStamp;
     zce->root.zipFileOffset = 1;
 
+    /* Without an index, lookups fall back to searching the lists linearly */
+    zci->index = zipCache_allocateIndex(portLib, ZIP_INDEX_INITIAL_SIZE);
+
     return (J9ZipCache*)zci;
 }
 
@@ -170,10 +196,10 @@ void zipCache_setStartCentralDir(J9ZipCache* zipCache, IDATA startCentralDir)
 #if defined(J9VM_OPT_SHARED_CLASSES)
 /**
  * Returns a unique id for the zip cache. Used to identify the zip
- * cache data in shared memory. Consists of the zip file name (but
- * not the path), the zip file timestamp, the zip file size, and a
- * zip cache version number. The zip cache version number must be
- * changed if the zip cache format changes.
+ * cache data in shared memory. Consists of the zip file path, the
+ * zip file timestamp, the zip file size, and a zip cache version
+ * number. The zip cache version number must be changed if the zip
+ * cache format changes.
  *
  * The unique id is allocated by j9mem_allocate_memory() and must be
  * freed using j9mem_free_memory().
@@ -192,19 +218,9 @@ const char* zipCache_uniqueId(J9ZipCache* zipCache)
     UDATA sizeRequired;
     char* buf;
     const char* fileName = ZIP_SRP_GET(zce->zipFileName, const char*);
-    UDATA nameLength;
-    IDATA i = 0;
     if (!fileName) {
         return NULL;
     }
-    nameLength = strlen(fileName);
-
-    for (i = nameLength - 1; i >= 0; i--) {
-        if (fileName[i] == '\\' || fileName[i] == '/') {
-            fileName = &fileName[i + 1];
-            break;
-        }
-    }
 
     sizeRequired = j9str_printf(
         PORTLIB, NULL, 0, "%s_%d_%lld_%d", fileName, zce->zipFileSize, zce->zipTimeStamp, ZIP_CACHE_VERSION);
@@ -340,6 +356,7 @@ BOOLEAN zipCache_copy(J9ZipCache* zipCache, void* cacheData, UDATA dataSize)
     zce->zipFileSize = orgzce->zipFileSize;
     zce->zipTimeStamp = orgzce->zipTimeStamp;
     zce->startCentralDir = orgzce->startCentralDir;
+    zce->populateTime = orgzce->populateTime;
     zce->root.zipFileOffset = 1;
 
     orgDirEntry = &orgzce->root;
@@ -411,6 +428,73 @@ void zipCache_useCopiedCache(J9ZipCache* zipCache, void* cacheData)
     zce = (J9ZipCacheEntry*)(chunk + 1);
     /*	zipCache_walkCache(portLib, zce, &zce->root); */
     orgzci->entry = zce;
+
+    /* The index refers to the freed chunks, rebuild it over the copied entries */
+    zipCache_dropIndex(orgzci);
+    orgzci->index = zipCache_allocateIndex(portLib, ZIP_INDEX_INITIAL_SIZE);
+    if ((NULL != orgzci->index) && !zipCache_indexDirEntry(orgzci, &zce->root)) {
+        zipCache_dropIndex(orgzci);
+    }
+}
+#endif
+
+#if defined(J9VM_OPT_SHARED_CLASSES)
+/**
+ * Checks that zip cache data found in shared memory describes the same zip
+ * file as the zip cache.  The unique id used to find the data already
+ * includes the path, size and timestamp, so this guards against a damaged
+ * or truncated store rather than a mismatched key.
+ *
+ * @param[in] zipCache the zip cache
+ * @param[in] cacheData the cache data populated by zipCache_copy()
+ * @param[in] dataSize the size of cacheData
+ *
+ * @return TRUE if cacheData may be passed to zipCache_useCopiedCache()
+ */
+BOOLEAN zipCache_isValidCopy(J9ZipCache* zipCache, void* cacheData, UDATA dataSize)
+{
+    J9ZipCacheInternal* zci = (J9ZipCacheInternal*)zipCache;
+    J9ZipCacheEntry* zce = zci->entry;
+    J9ZipChunkHeader* chunk = cacheData;
+    J9ZipCacheEntry* copyzce = (J9ZipCacheEntry*)(chunk + 1);
+    const char* zipFileName = ZIP_SRP_GET(zce->zipFileName, const char*);
+    const char* copyZipFileName;
+    UDATA zipNameLength;
+
+    if ((NULL == cacheData) || (dataSize < (sizeof(J9ZipChunkHeader) + sizeof(J9ZipCacheEntry)))
+        || (NULL == zipFileName)) {
+        return FALSE;
+    }
+    if ((copyzce->zipFileSize != zce->zipFileSize) || (copyzce->zipTimeStamp != zce->zipTimeStamp)) {
+        return FALSE;
+    }
+    zipNameLength = strlen(zipFileName);
+    copyZipFileName = ZIP_SRP_GET(copyzce->zipFileName, const char*);
+    if (((U_8*)copyZipFileName < (U_8*)(copyzce + 1)) || ((U_8*)copyZipFileName >= ((U_8*)cacheData + dataSize))
+        || ((UDATA)(((U_8*)cacheData + dataSize) - (U_8*)copyZipFileName) <= zipNameLength)) {
+        return FALSE;
+    }
+    return (0 == memcmp(copyZipFileName, zipFileName, zipNameLength)) && ('\0' == copyZipFileName[zipNameLength]);
+}
+
+/**
+ * Returns the time, in microseconds, the JVM which stored the zip cache data
+ * spent reading the central directory.  A JVM using the copied data avoids
+ * this cost.
+ *
+ * @param[in] cacheData the cache data populated by zipCache_copy()
+ * @param[in] dataSize the size of cacheData
+ *
+ * @return the populate time, or 0 if cacheData is too small
+ */
+U_64 zipCache_copiedPopulateTime(void* cacheData, UDATA dataSize)
+{
+    J9ZipChunkHeader* chunk = cacheData;
+
+    if ((NULL == cacheData) || (dataSize < (sizeof(J9ZipChunkHeader) + sizeof(J9ZipCacheEntry)))) {
+        return 0;
+    }
+    return ((J9ZipCacheEntry*)(chunk + 1))->populateTime;
 }
 #endif
 
@@ -484,6 +568,19 @@ IDATA zipCache_getStartCentralDir(J9ZipCache* zipCache)
     return zce->startCentralDir;
 }
 
+/**
+ * Record how long it took to read the central directory into the cache.
+ *
+ * @param[in] zipCache the zip cache to modify
+ * @param[in] populateTime the time in microseconds
+ */
+void zipCache_setPopulateTime(J9ZipCache* zipCache, U_64 populateTime)
+{
+    J9ZipCacheInternal* zci = (J9ZipCacheInternal*)zipCache;
+    J9ZipCacheEntry* zce = zci->entry;
+    zce->populateTime = populateTime;
+}
+
 /**
  * Whack the cache timestamp to keep other people from starting to use it.  Once all the current
  * users of the cache have stopped using it, it will go away.
@@ -503,6 +600,57 @@ void zipCache_invalidateCache(J9ZipCache* zipCache)
     zce->zipTimeStamp = -2;
 }
 
+/**
+ * Maps the zip file of the cache read-only so entry data can be inflated in place.
+ * zipFileFd must already be set.  Failure is not an error; readers fall back to
+ * reading through the file descriptor.
+ *
+ * If the file is truncated while it is mapped, touching the lost pages raises SIGBUS.
+ * The file is therefore only mapped when the port library can protect against that
+ * signal, and readers access the mapping under j9sig_protect(), reverting to the
+ * file descriptor when a fault is caught.
+ *
+ * @param[in] zipCache the zip cache
+ */
+void zipCache_mapZipFile(J9ZipCache* zipCache)
+{
+    J9ZipCacheInternal* zci = (J9ZipCacheInternal*)zipCache;
+    J9ZipCacheEntry* zce = zci->entry;
+    J9PortLibrary* portLib = zipCache->portLib;
+    const char* zipFileName = ZIP_SRP_GET(zce->zipFileName, const char*);
+    PORT_ACCESS_FROM_PORT(portLib);
+
+    if ((NULL != zci->zipFileMapping) || (-1 == zci->zipFileFd) || (zce->zipFileSize <= 0)
+        || ((UDATA)zce->zipFileSize > ZIP_MMAP_MAX_SIZE)
+        || J9_ARE_NO_BITS_SET(j9mmap_capabilities(), J9PORT_MMAP_CAPABILITY_READ)
+        || !j9sig_can_protect(ZIP_MAPPED_READ_SIG_FLAGS)) {
+        return;
+    }
+    zci->zipFileMapping = j9mmap_map_file(
+        zci->zipFileFd, 0, (UDATA)zce->zipFileSize, zipFileName, J9PORT_MMAP_FLAG_READ, J9MEM_CATEGORY_VM_JCL);
+}
+
+/**
+ * Returns a pointer to length bytes at offset in the mapped zip file, or NULL if the
+ * zip file is not mapped or the range lies outside the mapping.
+ *
+ * @param[in] zipCache the zip cache
+ * @param[in] offset the offset in the zip file
+ * @param[in] length the number of bytes required
+ *
+ * @return the mapped bytes, or NULL
+ */
+U_8* zipCache_getMappedData(J9ZipCache* zipCache, UDATA offset, UDATA length)
+{
+    J9ZipCacheInternal* zci = (J9ZipCacheInternal*)zipCache;
+    J9MmapHandle* mapping = zci->zipFileMapping;
+
+    if ((NULL == mapping) || (offset > mapping->size) || (length > (mapping->size - offset))) {
+        return NULL;
+    }
+    return (U_8*)mapping->pointer + offset;
+}
+
 #if defined(J9VM_OPT_SHARED_CLASSES)
 J9ZipDirEntry* zipCache_copyDirEntry(
     J9ZipCacheEntry* orgzce, J9ZipDirEntry* orgDirEntry, J9ZipCacheEntry* zce, J9ZipDirEntry* rootEntry)
@@ -563,6 +711,7 @@ zipCache_addElement(J9ZipCache* zipCache, char* elementName, IDATA elementNameLe
     J9ZipCacheEntry* zce = zci->entry;
     J9ZipDirEntry* dirEntry;
     J9ZipFileEntry* fileEntry;
+    J9ZipCacheIndex* index;
     char* curName;
     IDATA nameLength;
     IDATA curSize;
@@ -609,13 +758,24 @@ zipCache_addElement(J9ZipCache* zipCache, char* elementName, IDATA elementNameLe
             /* The prefix we're looking at doesn't end with a '/', which means */
             /* it is really the suffix of the elementName, and it's a filename. */
 
-            fileEntry = zipCache_searchFileList(dirEntry, curName, curSize, isClass);
+            index = zci->index;
+            if (NULL != index) {
+                fileEntry = zipCache_indexLookup(index, dirEntry, curName, curSize, isClass, FALSE);
+            } else {
+                fileEntry = zipCache_searchFileList(dirEntry, curName, curSize, isClass);
+            }
             if (fileEntry) {
                 /* We've seen this file before...update the entry to the new offset. */
                 fileEntry->zipFileOffset = elementOffset | (isClass ? ISCLASS_BIT : 0);
             } else {
-                if (!zipCache_addToFileList(portLib, zce, dirEntry, curName, curSize, isClass, elementOffset))
+                if (!(fileEntry
+                        = zipCache_addToFileList(portLib, zce, dirEntry, curName, curSize, isClass, elementOffset)))
                     return FALSE;
+                if ((NULL != zci->index)
+                    && !zipCache_indexInsert(
+                        zci, dirEntry, fileEntry, zipCache_hashName(dirEntry, curName, curSize, isClass), FALSE)) {
+                    zipCache_dropIndex(zci);
+                }
             }
             return TRUE;
         }
@@ -623,10 +783,21 @@ zipCache_addElement(J9ZipCache* zipCache, char* elementName, IDATA elementNameLe
         /* If we got here, we're looking at a prefix which ends with '/' */
         /* Treat that prefix as a subdirectory.  If it doesn't exist, create it implicitly */
 
-        if (!(d = zipCache_searchDirList(dirEntry, curName, curSize, isClass))) {
+        index = zci->index;
+        if (NULL != index) {
+            d = zipCache_indexLookup(index, dirEntry, curName, curSize, isClass, TRUE);
+        } else {
+            d = zipCache_searchDirList(dirEntry, curName, curSize, isClass);
+        }
+        if (!d) {
             if (!(d = zipCache_addToDirList(portLib, zce, dirEntry, curName, curSize, isClass))) {
                 return FALSE;
             }
+            if ((NULL != zci->index)
+                && !zipCache_indexInsert(
+                    zci, dirEntry, d, zipCache_hashName(dirEntry, curName, curSize, isClass), TRUE)) {
+                zipCache_dropIndex(zci);
+            }
         }
         dirEntry = d;
         curName += prefixSize;
@@ -654,6 +825,7 @@ zipCache_findElement(J9ZipCache* zipCache, const char* elementName, IDATA elemen
     J9ZipCacheEntry* zce = zci->entry;
     J9ZipDirEntry* dirEntry;
     J9ZipFileEntry* fileEntry;
+    J9ZipCacheIndex* index;
     const char* curName;
     IDATA nameLength;
     IDATA curSize;
@@ -697,7 +869,12 @@ zipCache_findElement(J9ZipCache* zipCache, const char* elementName, IDATA elemen
             /* The prefix we're looking at doesn't end with a '/', which means */
             /* it is really the suffix of the elementName, and it's a filename. */
 
-            fileEntry = zipCache_searchFileList(dirEntry, curName, curSize, isClass);
+            index = zci->index;
+            if (NULL != index) {
+                fileEntry = zipCache_indexLookup(index, dirEntry, curName, curSize, isClass, FALSE);
+            } else {
+                fileEntry = zipCache_searchFileList(dirEntry, curName, curSize, isClass);
+            }
             if (fileEntry) {
                 return fileEntry->zipFileOffset & OFFSET_MASK;
             }
@@ -709,7 +886,12 @@ zipCache_findElement(J9ZipCache* zipCache, const char* elementName, IDATA elemen
         /* If we got here, we're looking at a prefix which ends with '/', or searchDirList is TRUE */
         /* Treat that prefix as a subdirectory.  It will exist if elementName was added before. */
 
-        dirEntry = zipCache_searchDirList(dirEntry, curName, curSize, isClass);
+        index = zci->index;
+        if (NULL != index) {
+            dirEntry = zipCache_indexLookup(index, dirEntry, curName, curSize, isClass, TRUE);
+        } else {
+            dirEntry = zipCache_searchDirList(dirEntry, curName, curSize, isClass);
+        }
         if (!dirEntry)
             return NOT_FOUND;
         curName += prefixSize;
@@ -774,6 +956,11 @@ void zipCache_kill(J9ZipCache* zipCache)
     PORT_ACCESS_FROM_PORT(portLib);
 
     zipCache_freeChunks(portLib, zce);
+    zipCache_freeIndex(portLib, zci->index);
+    zipCache_freeIndex(portLib, zci->droppedIndex);
+    if (NULL != zci->zipFileMapping) {
+        j9mmap_unmap_file(zci->zipFileMapping);
+    }
     if (-1 != zci->zipFileFd) {
         j9file_close(zci->zipFileFd);
     }
@@ -980,6 +1167,196 @@ J9ZipFileEntry* zipCache_searchFileList(J9ZipDirEntry* dirEntry, const char* nam
     return NULL;
 }
 
+/* Hashes one path component of an element together with the directory containing it. */
+
+static U_32 zipCache_hashName(J9ZipDirEntry* parent, const char* namePtr, UDATA nameSize, BOOLEAN isClass)
+{
+    U_32 hash = 2166136261U ^ (U_32)((UDATA)parent >> 3);
+    UDATA i;
+
+    for (i = 0; i < nameSize; i++) {
+        hash = (hash ^ (U_8)namePtr[i]) * 16777619U;
+    }
+    if (isClass) {
+        hash ^= 0x9E3779B9U;
+    }
+    /* FNV leaves the low bits poorly mixed, and the low bits select the slot */
+    hash ^= hash >> 15;
+    hash *= 0x2C1B3C6DU;
+    hash ^= hash >> 12;
+    return hash;
+}
+
+/* Allocates an empty directory index with size slots.  size must be a power of two. */
+
+static J9ZipCacheIndex* zipCache_allocateIndex(J9PortLibrary* portLib, UDATA size)
+{
+    J9ZipCacheIndex* index;
+    UDATA bytes = sizeof(J9ZipCacheIndex) + (size * sizeof(J9ZipCacheIndexSlot));
+    PORT_ACCESS_FROM_PORT(portLib);
+
+    index = (J9ZipCacheIndex*)j9mem_allocate_memory(bytes, J9MEM_CATEGORY_VM_JCL);
+    if (NULL == index) {
+        return NULL;
+    }
+    memset(index, 0, bytes);
+    index->slots = (J9ZipCacheIndexSlot*)(index + 1);
+    index->size = size;
+    return index;
+}
+
+/* Frees a directory index along with every slot array it has outgrown. */
+
+static void zipCache_freeIndex(J9PortLibrary* portLib, J9ZipCacheIndex* index)
+{
+    PORT_ACCESS_FROM_PORT(portLib);
+
+    while (NULL != index) {
+        J9ZipCacheIndex* retired = index->retired;
+        j9mem_free_memory(index);
+        index = retired;
+    }
+}
+
+/*
+ * Discards the directory index of zci.  Subsequent lookups search the lists linearly.
+ * A lookup may still be running against the index, so it is only moved to the
+ * droppedIndex list, which is freed when the cache is killed.
+ */
+
+static void zipCache_dropIndex(J9ZipCacheInternal* zci)
+{
+    J9ZipCacheIndex* index = zci->index;
+    J9ZipCacheIndex* last = index;
+
+    if (NULL == index) {
+        return;
+    }
+    zci->index = NULL;
+    while (NULL != last->retired) {
+        last = last->retired;
+    }
+    last->retired = zci->droppedIndex;
+    zci->droppedIndex = index;
+}
+
+/* Looks up the file (or directory, if isDir) named namePtr[0..nameSize-1] */
+/* with the specified isClass value in the directory parent. */
+
+static void* zipCache_indexLookup(
+    J9ZipCacheIndex* index, J9ZipDirEntry* parent, const char* namePtr, UDATA nameSize, BOOLEAN isClass, U_32 isDir)
+{
+    U_32 hash = zipCache_hashName(parent, namePtr, nameSize, isClass);
+    UDATA classBit = isClass ? ISCLASS_BIT : 0;
+    UDATA mask = index->size - 1;
+    UDATA i;
+
+    for (i = hash & mask; NULL != index->slots[i].entry; i = (i + 1) & mask) {
+        J9ZipCacheIndexSlot* slot = &index->slots[i];
+
+        if ((slot->hash != hash) || (slot->parent != parent) || (slot->isDir != isDir)) {
+            continue;
+        }
+        if (isDir) {
+            J9ZipDirEntry* entry = (J9ZipDirEntry*)slot->entry;
+            const char* name = J9ZIPDIRENTRY_NAME(entry);
+            if (!strncmp(name, namePtr, nameSize) && !name[nameSize]
+                && ((entry->zipFileOffset & ISCLASS_BIT) == classBit)) {
+                return entry;
+            }
+        } else {
+            J9ZipFileEntry* entry = (J9ZipFileEntry*)slot->entry;
+            if ((entry->nameLength == nameSize) && !memcmp(J9ZIPFILEENTRY_NAME(entry), namePtr, nameSize)
+                && ((entry->zipFileOffset & ISCLASS_BIT) == classBit)) {
+                return entry;
+            }
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Adds entry, a child of parent, to the directory index of zci.  The caller
+ * must have checked that the element is not already indexed.  When the index
+ * grows, the outgrown slot array is retired rather than freed, since lookups
+ * may be running against it.  Returns FALSE if the index could not grow.
+ */
+
+static BOOLEAN zipCache_indexInsert(J9ZipCacheInternal* zci, J9ZipDirEntry* parent, void* entry, U_32 hash, U_32 isDir)
+{
+    J9ZipCacheIndex* index = zci->index;
+    J9ZipCacheIndexSlot* slot;
+    UDATA mask;
+    UDATA i;
+
+    if (ZIP_INDEX_NEEDS_GROWTH(index)) {
+        J9ZipCacheIndex* newIndex = zipCache_allocateIndex(zci->info.portLib, index->size * 2);
+        UDATA j;
+
+        if (NULL == newIndex) {
+            return FALSE;
+        }
+        mask = newIndex->size - 1;
+        for (j = 0; j < index->size; j++) {
+            J9ZipCacheIndexSlot* oldSlot = &index->slots[j];
+            if (NULL != oldSlot->entry) {
+                for (i = oldSlot->hash & mask; NULL != newIndex->slots[i].entry; i = (i + 1) & mask)
+                    /* nothing */;
+                newIndex->slots[i] = *oldSlot;
+            }
+        }
+        newIndex->count = index->count;
+        newIndex->retired = index;
+        zci->index = newIndex;
+        index = newIndex;
+    }
+
+    mask = index->size - 1;
+    for (i = hash & mask; NULL != index->slots[i].entry; i = (i + 1) & mask)
+        /* nothing */;
+    slot = &index->slots[i];
+    slot->parent = parent;
+    slot->hash = hash;
+    slot->isDir = isDir;
+    slot->entry = entry;
+    index->count += 1;
+    return TRUE;
+}
+
+/* Adds every file and directory below dirEntry to the directory index of zci. */
+
+static BOOLEAN zipCache_indexDirEntry(J9ZipCacheInternal* zci, J9ZipDirEntry* dirEntry)
+{
+    J9ZipFileRecord* record = ZIP_SRP_GET(dirEntry->fileList, J9ZipFileRecord*);
+    J9ZipDirEntry* subDir = ZIP_SRP_GET(dirEntry->dirList, J9ZipDirEntry*);
+
+    while (record) {
+        J9ZipFileEntry* entry = record->entry;
+        UDATA i;
+
+        for (i = 0; i < record->entryCount; i++) {
+            BOOLEAN isClass = (entry->zipFileOffset & ISCLASS_BIT) != 0;
+            U_32 hash = zipCache_hashName(dirEntry, J9ZIPFILEENTRY_NAME(entry), entry->nameLength, isClass);
+            if (!zipCache_indexInsert(zci, dirEntry, entry, hash, FALSE)) {
+                return FALSE;
+            }
+            entry = J9ZIPFILEENTRY_NEXT(entry);
+        }
+        record = ZIP_SRP_GET(record->next, J9ZipFileRecord*);
+    }
+
+    while (subDir) {
+        const char* name = J9ZIPDIRENTRY_NAME(subDir);
+        BOOLEAN isClass = (subDir->zipFileOffset & ISCLASS_BIT) != 0;
+        U_32 hash = zipCache_hashName(dirEntry, name, strlen(name), isClass);
+        if (!zipCache_indexInsert(zci, dirEntry, subDir, hash, TRUE) || !zipCache_indexDirEntry(zci, subDir)) {
+            return FALSE;
+        }
+        subDir = ZIP_SRP_GET(subDir->next, J9ZipDirEntry*);
+    }
+    return TRUE;
+}
+
 /**
  * Searches for a directory named elementName in zipCache and if found provides
  * a handle to it that can be used to enumerate through all of the directory's files.
@@ -70,8 +70,8 @@ struct workBuffer {
 
 static I_32 zip_populateCache(
     J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipCentralEnd* endEntry, IDATA startCentralDir);
-static I_32 inflateData(
-    struct workBuffer* workBuf, U_8* inputBuffer, U_32 inputBufferSize, U_8* outputBuffer, U_32 outputBufferSize);
+static I_32 inflateData(struct workBuffer* workBuf, U_8* inputBuffer, U_32 inputBufferSize, U_8* outputBuffer,
+    U_32 outputBufferSize, BOOLEAN inputIsMapped);
 I_32 scanForDataDescriptor(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* zipEntry);
 void zdatafree(void* opaque, void* address);
 static I_32 readZipEntry(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry* zipEntry, const char* filename,
@@ -199,15 +199,60 @@ static VMINLINE BOOLEAN isSeekFailure(I_64 seekResult, I_64 expectedValue)
  */
 static VMINLINE BOOLEAN isOutside4Gig(I_64 value) { return (value < 0) || (value > UINT32_MAX); }
 
+typedef struct ZipMappedCopyArgs {
+    U_8* destination;
+    U_8* source;
+    U_32 length;
+} ZipMappedCopyArgs;
+
+/* Handler for faults raised while reading a mapped zip file, e.g. after it was truncated. */
+static UDATA mappedReadFaultHandler(struct J9PortLibrary* portLib, U_32 gpType, void* gpInfo, void* userData)
+{
+    return J9PORT_SIG_EXCEPTION_RETURN;
+}
+
+static UDATA protectedMappedCopy(struct J9PortLibrary* portLib, void* arg)
+{
+    ZipMappedCopyArgs* args = (ZipMappedCopyArgs*)arg;
+    memcpy(args->destination, args->source, args->length);
+    return 0;
+}
+
+static UDATA protectedInflate(struct J9PortLibrary* portLib, void* arg)
+{
+    return (UDATA)(IDATA)inflateFunc((z_stream*)arg, Z_SYNC_FLUSH);
+}
+
+/*
+        Copies length bytes out of a mapped zip file.
+        Returns 0 on success or ZIP_ERR_FILE_READ_ERROR if reading the mapping faulted.
+*/
+static I_32 copyMappedData(J9PortLibrary* portLib, U_8* destination, U_8* source, U_32 length)
+{
+    PORT_ACCESS_FROM_PORT(portLib);
+    ZipMappedCopyArgs args;
+    UDATA unused = 0;
+
+    args.destination = destination;
+    args.source = source;
+    args.length = length;
+    if (0 != j9sig_protect(protectedMappedCopy, &args, mappedReadFaultHandler, NULL, ZIP_MAPPED_READ_SIG_FLAGS,
+            &unused)) {
+        return ZIP_ERR_FILE_READ_ERROR;
+    }
+    return 0;
+}
+
 /*
         Returns 0 on success or one of the following:
                         ZIP_ERR_UNSUPPORTED_FILE_TYPE
                         ZIP_ERR_FILE_CORRUPT
                         ZIP_ERR_OUT_OF_MEMORY
                         ZIP_ERR_INTERNAL_ERROR
+                        ZIP_ERR_FILE_READ_ERROR if inputIsMapped and reading the input faulted
 */
-static I_32 inflateData(
-    struct workBuffer* workBuf, U_8* inputBuffer, U_32 inputBufferSize, U_8* outputBuffer, U_32 outputBufferSize)
+static I_32 inflateData(struct workBuffer* workBuf, U_8* inputBuffer, U_32 inputBufferSize, U_8* outputBuffer,
+    U_32 outputBufferSize, BOOLEAN inputIsMapped)
 {
     PORT_ACCESS_FROM_PORT(workBuf->portLib);
 
@@ -230,7 +275,18 @@ static I_32 inflateData(
         return -1;
 
     /* Inflate the data. */
-    err = inflateFunc(&stream, Z_SYNC_FLUSH);
+    if (inputIsMapped) {
+        UDATA protectResult = 0;
+        if (0 != j9sig_protect(protectedInflate, &stream, mappedReadFaultHandler, NULL, ZIP_MAPPED_READ_SIG_FLAGS,
+                &protectResult)) {
+            /* The stream is left mid-inflate, which inflateEnd() tolerates. */
+            inflateEndFunc(&stream);
+            return ZIP_ERR_FILE_READ_ERROR;
+        }
+        err = (I_32)(IDATA)protectResult;
+    } else {
+        err = inflateFunc(&stream, Z_SYNC_FLUSH);
+    }
 
     /* Clean up the stream. */
     inflateEndFunc(&stream);
@@ -1361,6 +1417,7 @@ I_32 zip_setupCache(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipCache* cach
             J9ZipCacheInternal* zci = (J9ZipCacheInternal*)zipFile->cache;
             zci->zipFileFd = zipFile->fd;
             zci->zipFileType = zipFile->type;
+            zipCache_mapZipFile(zipFile->cache);
         }
     }
 
@@ -1401,9 +1458,11 @@ finished:
  */
 I_32 zip_readCacheData(J9PortLibrary* portLib, J9ZipFile* zipFile)
 {
+    PORT_ACCESS_FROM_PORT(portLib);
     I_32 result = 0;
     J9ZipCentralEnd endEntry;
     IDATA startCentralDir;
+    U_64 startTime;
 
     /* zip_setupCache() must have already been called. */
     if (!zipFile->cachePool || !zipFile->cache) {
@@ -1416,12 +1475,18 @@ I_32 zip_readCacheData(J9PortLibrary* portLib, J9ZipFile* zipFile)
         return 0;
     }
 
+    startTime = j9time_hires_clock();
+
     /* Find and read the end-of-central-dir record. */
     result = scanForCentralEnd(portLib, zipFile, &endEntry);
     if (result == 0) {
         startCentralDir = (IDATA)((UDATA)endEntry.dirOffset);
         zipCache_setStartCentralDir(zipFile->cache, startCentralDir);
         result = zip_populateCache(portLib, zipFile, &endEntry, startCentralDir);
+        if (result == 0) {
+            zipCache_setPopulateTime(zipFile->cache,
+                j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+        }
     }
 
 finished:
@@ -1828,11 +1893,16 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 
     I_32 result;
     U_8* dataBuffer;
+    U_8* mappedData = NULL;
     struct workBuffer wb;
     I_64 seekResult;
 
     ENTER();
 
+    if (NULL != zipFile->cache) {
+        mappedData = zipCache_getMappedData(zipFile->cache, entry->dataPointer, entry->compressedSize);
+    }
+
     wb.portLib = portLib;
     wb.bufferStart = wb.bufferEnd = wb.currentAlloc = 0;
 
@@ -1862,6 +1932,13 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
 
     if (entry->compressionMethod == ZIP_CM_Stored) {
         IDATA readResult = 0;
+        if (NULL != mappedData) {
+            /* The zip file is mapped, the file pointer is left untouched. If the mapping faults, read the file. */
+            if (0 == copyMappedData(portLib, dataBuffer, mappedData, entry->compressedSize)) {
+                EXIT();
+                return 0;
+            }
+        }
         /* No compression - just read the data in. */
         if (zipFile->pointer != entry->dataPointer) {
             zipFile->pointer = (U_32)entry->dataPointer;
@@ -1885,8 +1962,8 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
     if (entry->compressionMethod == ZIP_CM_Deflated) {
         U_8* readBuffer;
 
-        /* Read the file contents. */
-        if (entry->compressedSize < ZIP_WORK_BUFFER_SIZE) {
+        /* Read the file contents. When the zip file is mapped, only zlib allocates from the work buffer. */
+        if ((NULL != mappedData) || (entry->compressedSize < ZIP_WORK_BUFFER_SIZE)) {
             J9ZipCachePool* cachePool = zipFile->cachePool;
             if (cachePool != NULL) {
                 /* The buffer is allocated in zip_populateCache() */
@@ -1898,6 +1975,18 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
                 }
             }
         }
+        if (NULL != mappedData) {
+            /* Inflate straight from the mapped zip file, no intermediate read buffer is needed.
+             * If the mapping faults, the file was truncated; fall back to reading it.
+             */
+            result = inflateData(&wb, mappedData, entry->compressedSize, dataBuffer, entry->uncompressedSize, TRUE);
+            if (ZIP_ERR_FILE_READ_ERROR != result) {
+                if (result)
+                    goto finished;
+                EXIT();
+                return 0;
+            }
+        }
         readBuffer = zdataalloc(&wb, 1, entry->compressedSize);
         if (!readBuffer) {
             result = ZIP_ERR_OUT_OF_MEMORY;
@@ -1921,7 +2010,7 @@ I_32 zip_getZipEntryData(J9PortLibrary* portLib, J9ZipFile* zipFile, J9ZipEntry*
         zipFile->pointer += entry->compressedSize;
 
         /* Deflate the data. */
-        result = inflateData(&wb, readBuffer, entry->compressedSize, dataBuffer, entry->uncompressedSize);
+        result = inflateData(&wb, readBuffer, entry->compressedSize, dataBuffer, entry->uncompressedSize, FALSE);
         zdatafree(&wb, readBuffer);
         if (result)
             goto finished;
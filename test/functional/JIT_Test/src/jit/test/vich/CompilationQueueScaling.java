@@ -0,0 +1,264 @@
+/*******************************************************************************
+ * Copyright (c) 2018, 2018 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+package jit.test.vich;
+
+import java.io.BufferedReader;
+import java.io.ByteArrayOutputStream;
+import java.io.File;
+import java.io.FileReader;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.InputStreamReader;
+import java.lang.management.ManagementFactory;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+import jit.test.vich.utils.Timer;
+
+/**
+ * Measures how long compilation requests wait in the compilation queue.
+ * The workloads run in a child JVM with -Xjit:verbose={compilationThreads},
+ * which writes the enqueue-to-start latency of every compilation thread
+ * to the verbose log at shutdown.
+ *
+ * The trickle workload makes a few methods hot at a time, so the queue is
+ * mostly empty and each request wakes one compilation thread sleeping on the
+ * empty queue. Every copy of {@link Payload} must still get compiled.
+ *
+ * The flood workload fills the queue from a growing number of application
+ * threads. Every thread loads its own copies of {@link Payload}, so each copy
+ * brings new J9Methods and therefore new compilation requests.
+ */
+public class CompilationQueueScaling {
+	private static Logger logger = Logger.getLogger(CompilationQueueScaling.class);
+	private static final String PAYLOAD_NAME = Payload.class.getName();
+	private static final int LOADERS_PER_THREAD = 64;
+	private static final int INVOCATIONS_PER_COPY = 2000;
+	private static final int TRICKLE_COPIES = 64;
+	private static final int TRICKLE_PAUSE_MS = 20;
+	private static final Pattern QUEUE_TIME_STATS =
+		Pattern.compile("dequeued (\\d+) requests: avgQueueTime=(\\d+) ms maxQueueTime=(\\d+) ms");
+
+	public static class Payload implements Runnable {
+		private int state;
+
+		private int step1(int x) { return x * 31 + 7; }
+		private int step2(int x) { return (x >>> 3) ^ x; }
+		private int step3(int x) { return x % 1021; }
+		private int step4(int x) { return step1(x) + step2(x) - step3(x); }
+
+		public void run() {
+			state = step4(state + 1);
+		}
+	}
+
+	static class PayloadLoader extends ClassLoader {
+		private final byte[] bytes;
+
+		PayloadLoader(ClassLoader parent, byte[] bytes) {
+			super(parent);
+			this.bytes = bytes;
+		}
+
+		protected synchronized Class loadClass(String name, boolean resolve) throws ClassNotFoundException {
+			if (!PAYLOAD_NAME.equals(name)) {
+				return super.loadClass(name, resolve);
+			}
+			Class c = findLoadedClass(name);
+			if (c == null) {
+				c = defineClass(name, bytes, 0, bytes.length);
+			}
+			if (resolve) {
+				resolveClass(c);
+			}
+			return c;
+		}
+	}
+
+	private static byte[] readPayloadBytes() throws IOException {
+		String resource = PAYLOAD_NAME.replace('.', '/') + ".class";
+		InputStream in = CompilationQueueScaling.class.getClassLoader().getResourceAsStream(resource);
+		if (in == null) {
+			throw new IOException("cannot find " + resource);
+		}
+		try {
+			ByteArrayOutputStream out = new ByteArrayOutputStream();
+			byte[] buffer = new byte[4096];
+			for (int n = in.read(buffer); n > 0; n = in.read(buffer)) {
+				out.write(buffer, 0, n);
+			}
+			return out.toByteArray();
+		} finally {
+			in.close();
+		}
+	}
+
+	private static void drive(final byte[] bytes, int numThreads) throws Exception {
+		final ClassLoader parent = CompilationQueueScaling.class.getClassLoader();
+		final Throwable[] failure = new Throwable[1];
+		Thread[] threads = new Thread[numThreads];
+		for (int t = 0; t < numThreads; t++) {
+			threads[t] = new Thread() {
+				public void run() {
+					try {
+						for (int l = 0; l < LOADERS_PER_THREAD; l++) {
+							Class c = new PayloadLoader(parent, bytes).loadClass(PAYLOAD_NAME);
+							Runnable r = (Runnable)c.newInstance();
+							for (int i = 0; i < INVOCATIONS_PER_COPY; i++) {
+								r.run();
+							}
+						}
+					} catch (Throwable e) {
+						synchronized (failure) {
+							failure[0] = e;
+						}
+					}
+				}
+			};
+		}
+		for (int t = 0; t < numThreads; t++) {
+			threads[t].start();
+		}
+		for (int t = 0; t < numThreads; t++) {
+			threads[t].join();
+		}
+		if (failure[0] != null) {
+			throw new RuntimeException(failure[0]);
+		}
+	}
+
+	private static void trickle(byte[] bytes) throws Exception {
+		ClassLoader parent = CompilationQueueScaling.class.getClassLoader();
+		for (int l = 0; l < TRICKLE_COPIES; l++) {
+			Class c = new PayloadLoader(parent, bytes).loadClass(PAYLOAD_NAME);
+			Runnable r = (Runnable)c.newInstance();
+			for (int i = 0; i < INVOCATIONS_PER_COPY; i++) {
+				r.run();
+			}
+			/* let the compilation threads drain the queue and go back to sleep */
+			Thread.sleep(TRICKLE_PAUSE_MS);
+		}
+	}
+
+	private static void flood(byte[] bytes) throws Exception {
+		Timer timer = new Timer();
+		int maxThreads = Math.max(2, Runtime.getRuntime().availableProcessors());
+		for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+			timer.reset();
+			drive(bytes, numThreads);
+			timer.mark();
+			int copies = numThreads * LOADERS_PER_THREAD;
+			System.out.println(numThreads + " threads, " + copies + " payload copies = " + Long.toString(timer.delta())
+				+ " ms (" + (timer.delta() * 1000 / copies) + " us per copy)");
+		}
+	}
+
+	/**
+	 * Entry point of the child JVM.
+	 * @param args the workload to run, "trickle" or "flood"
+	 */
+	public static void main(String[] args) throws Exception {
+		byte[] bytes = readPayloadBytes();
+		if ("trickle".equals(args[0])) {
+			trickle(bytes);
+		} else {
+			flood(bytes);
+		}
+	}
+
+	private static boolean isJITDisabled() {
+		for (Object arg : ManagementFactory.getRuntimeMXBean().getInputArguments()) {
+			if ("-Xint".equals(arg) || "-Xnojit".equals(arg)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * Runs the given workload in a child JVM and returns the queue time statistics
+	 * of all its compilation threads: {requests dequeued, total queue time, max queue time}.
+	 */
+	private static long[] runWorkload(String workload) throws Exception {
+		File logDir = File.createTempFile("queueScaling", "");
+		Assert.assertTrue(logDir.delete() && logDir.mkdir(), "cannot create " + logDir);
+		String logPrefix = "vlog." + workload;
+		String java = System.getProperty("java.home") + File.separator + "bin" + File.separator + "java";
+		ProcessBuilder builder = new ProcessBuilder(java,
+			"-Xjit:count=100,verbose={compilationThreads},vlog=" + new File(logDir, logPrefix).getPath(),
+			"-cp", System.getProperty("java.class.path"), CompilationQueueScaling.class.getName(), workload);
+		builder.redirectErrorStream(true);
+		Process child = builder.start();
+		BufferedReader output = new BufferedReader(new InputStreamReader(child.getInputStream()));
+		for (String line = output.readLine(); line != null; line = output.readLine()) {
+			logger.info(workload + ": " + line);
+		}
+		Assert.assertEquals(child.waitFor(), 0, workload + " workload failed");
+
+		long[] stats = new long[3];
+		File[] logs = logDir.listFiles();
+		for (int f = 0; f < logs.length; f++) {
+			if (logs[f].getName().startsWith(logPrefix)) {
+				BufferedReader log = new BufferedReader(new FileReader(logs[f]));
+				try {
+					for (String line = log.readLine(); line != null; line = log.readLine()) {
+						Matcher matcher = QUEUE_TIME_STATS.matcher(line);
+						if (matcher.find()) {
+							long dequeued = Long.parseLong(matcher.group(1));
+							stats[0] += dequeued;
+							stats[1] += dequeued * Long.parseLong(matcher.group(2));
+							stats[2] = Math.max(stats[2], Long.parseLong(matcher.group(3)));
+						}
+					}
+				} finally {
+					log.close();
+				}
+			}
+			logs[f].delete();
+		}
+		logDir.delete();
+		Assert.assertTrue(stats[0] > 0, "no queue time statistics in the verbose log of the " + workload + " workload");
+		logger.info(workload + ": " + stats[0] + " requests dequeued, avgQueueTime=" + (stats[1] / stats[0])
+			+ " ms maxQueueTime=" + stats[2] + " ms");
+		return stats;
+	}
+
+@Test(groups = { "level.extended","component.jit" })
+public void testCompilationQueueScaling() throws Exception {
+	if (isJITDisabled()) {
+		logger.info("JIT disabled, nothing to measure");
+		return;
+	}
+	/* the queue times are only reported; each copy of run() is hot enough to be compiled */
+	long[] trickle = runWorkload("trickle");
+	Assert.assertTrue(trickle[0] >= TRICKLE_COPIES, "only " + trickle[0] + " requests were compiled for "
+		+ TRICKLE_COPIES + " payload copies queued into an almost empty compilation queue");
+	long[] flood = runWorkload("flood");
+	Assert.assertTrue(flood[0] >= LOADERS_PER_THREAD, "only " + flood[0] + " requests were compiled for the "
+		+ "flood workload");
+	return;
+}
+}
@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+/**
+ * Allocates from the bottom of a stack much deeper than the allocation site sampling depth, so that every sampled
+ * allocation walks a stack with more frames than the sampler records (-Xtgc:allocationSites).
+ * Command line parameters (all optional):
+ * --depth N Number of frames to recurse before allocating (default 1000)
+ * --allocations N Number of arrays allocated at the bottom of the stack (default 200000)
+ */
+public class AllocationSiteSampling
+{
+	public static volatile Object _garbage;
+
+	public static void main(String[] args)
+	{
+		int depth = _intArgument(args, "--depth", 1000);
+		int allocations = _intArgument(args, "--allocations", 200000);
+
+		if ((depth < 1) || (allocations < 1))
+		{
+			System.err.println("--depth and --allocations must be positive.");
+			System.exit(1);
+		}
+
+		long allocated = _recurse(depth, allocations);
+		if (allocated != allocations)
+		{
+			System.out.println("FAIL: allocated " + allocated + " arrays instead of " + allocations);
+			System.exit(2);
+		}
+		System.out.println("Successful test run!");
+	}
+
+	private static long _recurse(int depth, int allocations)
+	{
+		if (0 == depth)
+		{
+			return _allocate(allocations);
+		}
+		return _recurse(depth - 1, allocations);
+	}
+
+	private static long _allocate(int allocations)
+	{
+		long count = 0;
+		for (int i = 0; i < allocations; i++)
+		{
+			/* sizes up to 16KB, so a share of the arrays goes through the out-of-line (sampled) path */
+			_garbage = new byte[(i % 64) * 256];
+			count += 1;
+		}
+		return count;
+	}
+
+	private static int _intArgument(String[] args, String argument, int defaultValue)
+	{
+		for (int i = 0; i < (args.length - 1); i++)
+		{
+			if (args[i].equals(argument))
+			{
+				return Integer.parseInt(args[i + 1]);
+			}
+		}
+		return defaultValue;
+	}
+}
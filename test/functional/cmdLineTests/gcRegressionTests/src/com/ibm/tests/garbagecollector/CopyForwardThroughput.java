@@ -0,0 +1,264 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+import java.util.List;
+
+/**
+ * Copy-forward throughput microbenchmark.  Each round builds a fresh linked list and a fresh binary tree, keeps them
+ * live while allocating garbage until the collector has run a few times (so the new structures are copied by partial
+ * collections), then verifies both structures.  The collection time spent per live megabyte is reported so that runs
+ * with different collector options (for example -XXgc:tarokCopyForwardPrefetchWindow=) can be compared.
+ * Command line parameters (all optional):
+ * --list Only build linked lists
+ * --tree Only build trees
+ * --rounds N Number of rounds to run (default 10)
+ * --liveMB N Approximate size of the live structures built in each round, in megabytes (default 32)
+ * --gcthreads N Number of GC threads the VM was started with, used to report the throughput per thread (default 1)
+ */
+public class CopyForwardThroughput
+{
+	/* approximate size of a ListNode or TreeNode with its payload, used to size the structures */
+	private static final int NODE_BYTES = 48;
+	private static final int COLLECTIONS_PER_ROUND = 3;
+
+	public static ListNode _list;
+	public static TreeNode _tree;
+	public static Object _garbage;
+
+	static class ListNode
+	{
+		ListNode next;
+		long value;
+		long payload1;
+		long payload2;
+
+		ListNode(long value, ListNode next)
+		{
+			this.value = value;
+			this.next = next;
+			this.payload1 = value * 3;
+			this.payload2 = value * 7;
+		}
+	}
+
+	static class TreeNode
+	{
+		TreeNode left;
+		TreeNode right;
+		long value;
+		long payload;
+
+		TreeNode(long value)
+		{
+			this.value = value;
+			this.payload = value * 5;
+		}
+	}
+
+	public static void main(String[] args)
+	{
+		boolean buildList = !_match(args, "--tree");
+		boolean buildTree = !_match(args, "--list");
+		int rounds = _intArgument(args, "--rounds", 10);
+		int liveMB = _intArgument(args, "--liveMB", 32);
+		int gcThreads = _intArgument(args, "--gcthreads", 1);
+
+		if (!buildList && !buildTree)
+		{
+			System.err.println("--list and --tree are mutually exclusive.");
+			System.exit(1);
+		}
+		if ((rounds < 1) || (liveMB < 1) || (gcThreads < 1))
+		{
+			System.err.println("--rounds, --liveMB and --gcthreads must be positive.");
+			System.exit(1);
+		}
+
+		int structures = (buildList ? 1 : 0) + (buildTree ? 1 : 0);
+		int nodesPerStructure = (int)(((long)liveMB * 1024 * 1024) / NODE_BYTES / structures);
+		boolean pass = true;
+		long totalCollections = 0;
+		long totalCollectionMillis = 0;
+
+		for (int round = 0; pass && (round < rounds); round++)
+		{
+			_list = buildList ? buildList(nodesPerStructure) : null;
+			_tree = buildTree ? buildTree(0, nodesPerStructure) : null;
+
+			long startCount = collectionCount();
+			long startMillis = collectionMillis();
+			while (collectionCount() < (startCount + COLLECTIONS_PER_ROUND))
+			{
+				for (int i = 0; i < 1024; i++)
+				{
+					_garbage = new byte[1024];
+				}
+			}
+			long collections = collectionCount() - startCount;
+			long millis = collectionMillis() - startMillis;
+			totalCollections += collections;
+			totalCollectionMillis += millis;
+
+			if (buildList && !verifyList(_list, nodesPerStructure))
+			{
+				System.out.println("FAIL: linked list corrupted in round " + round);
+				pass = false;
+			}
+			if (buildTree && (_checksum(nodesPerStructure) != verifyTree(_tree)))
+			{
+				System.out.println("FAIL: tree corrupted in round " + round);
+				pass = false;
+			}
+			System.out.println("round " + round + ": " + collections + " collections in " + millis + "ms");
+		}
+		_list = null;
+		_tree = null;
+
+		if (pass)
+		{
+			double seconds = Math.max(totalCollectionMillis, 1) / 1000.0;
+			double copiedMB = (double)liveMB * rounds;
+			System.out.println("live MB per round: " + liveMB + ", collections: " + totalCollections + ", collection time: "
+					+ totalCollectionMillis + "ms");
+			System.out.println("throughput: " + (copiedMB / seconds) + " MB/s, " + (copiedMB / seconds / gcThreads)
+					+ " MB/s per GC thread");
+			System.out.println("Successful test run!");
+		}
+		else
+		{
+			System.exit(2);
+		}
+	}
+
+	private static ListNode buildList(int nodes)
+	{
+		ListNode head = null;
+		for (int i = nodes - 1; i >= 0; i--)
+		{
+			head = new ListNode(i, head);
+		}
+		return head;
+	}
+
+	private static boolean verifyList(ListNode head, int nodes)
+	{
+		long expected = 0;
+		for (ListNode node = head; null != node; node = node.next)
+		{
+			if ((expected != node.value) || ((expected * 3) != node.payload1) || ((expected * 7) != node.payload2))
+			{
+				return false;
+			}
+			expected += 1;
+		}
+		return nodes == expected;
+	}
+
+	/* builds a balanced tree holding the values [low, high) */
+	private static TreeNode buildTree(long low, long high)
+	{
+		TreeNode root = null;
+		if (low < high)
+		{
+			long middle = low + ((high - low) / 2);
+			root = new TreeNode(middle);
+			root.left = buildTree(low, middle);
+			root.right = buildTree(middle + 1, high);
+		}
+		return root;
+	}
+
+	/* returns the sum of the values in the tree, or -1 if any node is corrupted */
+	private static long verifyTree(TreeNode root)
+	{
+		long sum = 0;
+		if (null != root)
+		{
+			if ((root.value * 5) != root.payload)
+			{
+				return -1;
+			}
+			long left = verifyTree(root.left);
+			long right = verifyTree(root.right);
+			if ((-1 == left) || (-1 == right))
+			{
+				return -1;
+			}
+			sum = root.value + left + right;
+		}
+		return sum;
+	}
+
+	private static long _checksum(long nodes)
+	{
+		return (nodes * (nodes - 1)) / 2;
+	}
+
+	private static long collectionCount()
+	{
+		long count = 0;
+		List<GarbageCollectorMXBean> beans = ManagementFactory.getGarbageCollectorMXBeans();
+		for (GarbageCollectorMXBean bean : beans)
+		{
+			count += Math.max(bean.getCollectionCount(), 0);
+		}
+		return count;
+	}
+
+	private static long collectionMillis()
+	{
+		long millis = 0;
+		List<GarbageCollectorMXBean> beans = ManagementFactory.getGarbageCollectorMXBeans();
+		for (GarbageCollectorMXBean bean : beans)
+		{
+			millis += Math.max(bean.getCollectionTime(), 0);
+		}
+		return millis;
+	}
+
+	private static boolean _match(String[] args, String argument)
+	{
+		for (int i = 0; i < args.length; i++)
+		{
+			if (args[i].equals(argument))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	private static int _intArgument(String[] args, String argument, int defaultValue)
+	{
+		for (int i = 0; i < (args.length - 1); i++)
+		{
+			if (args[i].equals(argument))
+			{
+				return Integer.parseInt(args[i + 1]);
+			}
+		}
+		return defaultValue;
+	}
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+/**
+ * Multi-threaded String.intern() microbenchmark.  Each thread repeatedly interns fresh copies of the strings of a
+ * shared vocabulary (as a parser would intern element names), checks that every copy interns to the same canonical
+ * string, and allocates garbage so that the collector runs and clears interned strings which are no longer referenced.
+ * The intern rate is reported so that runs with different string table options (for example
+ * -XXgc:stringTableIndexBuckets=) can be compared.
+ * Command line parameters (all optional):
+ * --threads N Number of interning threads (default 4)
+ * --words N Number of distinct strings in the vocabulary (default 20000)
+ * --iterations N Number of strings each thread interns (default 2000000)
+ */
+public class InternThroughput
+{
+	public static volatile Object _garbage;
+
+	public static void main(String[] args) throws InterruptedException
+	{
+		int threadCount = _intArgument(args, "--threads", 4);
+		int words = _intArgument(args, "--words", 20000);
+		final int iterations = _intArgument(args, "--iterations", 2000000);
+
+		if ((threadCount < 1) || (words < 1) || (iterations < 1))
+		{
+			System.err.println("--threads, --words and --iterations must be positive.");
+			System.exit(1);
+		}
+
+		final char[][] vocabulary = new char[words][];
+		final String[] canonical = new String[words];
+		for (int i = 0; i < words; i++)
+		{
+			vocabulary[i] = ("element" + i + "_" + Integer.toHexString(i * 31)).toCharArray();
+			canonical[i] = new String(vocabulary[i]).intern();
+		}
+
+		final boolean[] failed = new boolean[threadCount];
+		Thread[] threads = new Thread[threadCount];
+		for (int t = 0; t < threadCount; t++)
+		{
+			final int id = t;
+			threads[t] = new Thread()
+			{
+				public void run()
+				{
+					int word = id;
+					for (int i = 0; i < iterations; i++)
+					{
+						word = (word + 7919) % vocabulary.length;
+						String interned = new String(vocabulary[word]).intern();
+						if (interned != canonical[word])
+						{
+							failed[id] = true;
+							return;
+						}
+						/* interned strings nobody keeps alive are cleared by the next collection */
+						if (0 == (i % 64))
+						{
+							_garbage = (new String(vocabulary[word]) + "_" + i).intern();
+						}
+					}
+				}
+			};
+		}
+
+		long start = System.nanoTime();
+		for (int t = 0; t < threadCount; t++)
+		{
+			threads[t].start();
+		}
+		for (int t = 0; t < threadCount; t++)
+		{
+			threads[t].join();
+		}
+		long millis = Math.max((System.nanoTime() - start) / 1000000, 1);
+
+		for (int t = 0; t < threadCount; t++)
+		{
+			if (failed[t])
+			{
+				System.out.println("FAIL: thread " + t + " interned a string to a different object");
+				System.exit(2);
+			}
+		}
+		long interned = (long)iterations * threadCount;
+		System.out.println("interned " + interned + " strings with " + threadCount + " threads in " + millis + "ms");
+		System.out.println("throughput: " + ((interned * 1000) / millis) + " interns/s");
+		System.out.println("Successful test run!");
+	}
+
+	private static int _intArgument(String[] args, String argument, int defaultValue)
+	{
+		for (int i = 0; i < (args.length - 1); i++)
+		{
+			if (args[i].equals(argument))
+			{
+				return Integer.parseInt(args[i + 1]);
+			}
+		}
+		return defaultValue;
+	}
+}
@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+/**
+ * Keeps many equal Strings with distinct value arrays alive across collections, so that a collector deduplicating
+ * String values (-Xgc:stringDeduplication) shares their arrays, and checks that every String keeps its contents while
+ * its value array is replaced and the duplicates are collected.
+ * Command line parameters (all optional):
+ * --words N Number of distinct String contents (default 1000)
+ * --copies N Number of live Strings with each content (default 50)
+ * --rounds N Number of times the live Strings are checked, with garbage allocated in between (default 20)
+ */
+public class StringDeduplication
+{
+	public static volatile Object _garbage;
+
+	public static void main(String[] args)
+	{
+		int words = _intArgument(args, "--words", 1000);
+		int copies = _intArgument(args, "--copies", 50);
+		int rounds = _intArgument(args, "--rounds", 20);
+
+		if ((words < 1) || (copies < 1) || (rounds < 1))
+		{
+			System.err.println("--words, --copies and --rounds must be positive.");
+			System.exit(1);
+		}
+
+		String[] expected = new String[words];
+		String[] live = new String[words * copies];
+		for (int i = 0; i < words; i++)
+		{
+			/* half of the contents cannot be stored compressed, so both value encodings are exercised */
+			expected[i] = ((0 == (i % 2)) ? "word" : "w\u00f6rd\u20ac") + i + "_" + Integer.toHexString(i * 7919);
+			for (int c = 0; c < copies; c++)
+			{
+				/* each copy gets an array of its own */
+				live[(c * words) + i] = new String(expected[i].toCharArray());
+			}
+		}
+
+		for (int round = 0; round < rounds; round++)
+		{
+			/* allocate enough garbage for several collections, so the live Strings age and are deduplicated */
+			for (int i = 0; i < 200000; i++)
+			{
+				_garbage = new char[64];
+			}
+			System.gc();
+			for (int s = 0; s < live.length; s++)
+			{
+				String string = live[s];
+				String content = expected[s % words];
+				if ((string.length() != content.length()) || !string.equals(content)
+					|| (string.hashCode() != content.hashCode()))
+				{
+					System.out.println("FAIL: round " + round + " string " + s + " is \"" + string + "\" instead of \""
+						+ content + "\"");
+					System.exit(2);
+				}
+			}
+		}
+		System.out.println("Successful test run!");
+	}
+
+	private static int _intArgument(String[] args, String argument, int defaultValue)
+	{
+		for (int i = 0; i < (args.length - 1); i++)
+		{
+			if (args[i].equals(argument))
+			{
+				return Integer.parseInt(args[i + 1]);
+			}
+		}
+		return defaultValue;
+	}
+}